@@ -1,60 +1,62 @@
-#-------------------------------------------------
-#
-# Project created by QtCreator 2018-06-03T02:18:00
-#
-#-------------------------------------------------
-
-QT       += core gui network
-
-greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
-
-TARGET = Lpz3ncLittleHelper
-TEMPLATE = app
-
-# The following define makes your compiler emit warnings if you use
-# any feature of Qt which has been marked as deprecated (the exact warnings
-# depend on your compiler). Please consult the documentation of the
-# deprecated API in order to know how to port your code away from it.
-DEFINES += QT_DEPRECATED_WARNINGS
-
-# You can also make your code fail to compile if you use deprecated APIs.
-# In order to do so, uncomment the following line.
-# You can also select to disable deprecated APIs only up to a certain version of Qt.
-#DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
-
-INCLUDEPATH +="framelesswindow"
-
-SOURCES += \
-        main.cpp \
-    loginwindow.cpp \
-    splashscreen.cpp \
-               framelesswindow/framelesswindow.cpp \
-               framelesswindow/windowdragger.cpp \
-               DarkStyle.cpp \
-    mainwindowcontent.cpp \
-    iconrightstyleditemdelegate.cpp \
-    addchanneldialog.cpp \
-    twitchconnector.cpp
-
-HEADERS += \
-    loginwindow.h \
-    splashscreen.h \
-               framelesswindow/framelesswindow.h \
-               framelesswindow/windowdragger.h \
-               DarkStyle.h \
-    mainwindowcontent.h \
-    iconrightstyleditemdelegate.h \
-    addchanneldialog.h \
-    twitchconnector.h
-
-FORMS += \
-    loginwindow.ui \
-    splashscreen.ui \
-framelesswindow/framelesswindow.ui \
-    mainwindowcontent.ui \
-    addchanneldialog.ui
-
-RESOURCES += \
-    resources.qrc \
-darkstyle.qrc \
-               framelesswindow.qrc
+#-------------------------------------------------
+#
+# Project created by QtCreator 2018-06-03T02:18:00
+#
+#-------------------------------------------------
+
+QT       += core gui network
+
+greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
+
+TARGET = Lpz3ncLittleHelper
+TEMPLATE = app
+
+# The following define makes your compiler emit warnings if you use
+# any feature of Qt which has been marked as deprecated (the exact warnings
+# depend on your compiler). Please consult the documentation of the
+# deprecated API in order to know how to port your code away from it.
+DEFINES += QT_DEPRECATED_WARNINGS
+
+# You can also make your code fail to compile if you use deprecated APIs.
+# In order to do so, uncomment the following line.
+# You can also select to disable deprecated APIs only up to a certain version of Qt.
+#DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
+
+INCLUDEPATH +="framelesswindow"
+
+include(twitchcore.pri)
+
+SOURCES += \
+        main.cpp \
+    loginwindow.cpp \
+    splashscreen.cpp \
+               framelesswindow/framelesswindow.cpp \
+               framelesswindow/windowdragger.cpp \
+               DarkStyle.cpp \
+    mainwindowcontent.cpp \
+    iconrightstyleditemdelegate.cpp \
+    addchanneldialog.cpp \
+    settingswriter.cpp
+
+HEADERS += \
+    loginwindow.h \
+    splashscreen.h \
+               framelesswindow/framelesswindow.h \
+               framelesswindow/windowdragger.h \
+               DarkStyle.h \
+    mainwindowcontent.h \
+    iconrightstyleditemdelegate.h \
+    addchanneldialog.h \
+    settingswriter.h
+
+FORMS += \
+    loginwindow.ui \
+    splashscreen.ui \
+framelesswindow/framelesswindow.ui \
+    mainwindowcontent.ui \
+    addchanneldialog.ui
+
+RESOURCES += \
+    resources.qrc \
+darkstyle.qrc \
+               framelesswindow.qrc
@@ -0,0 +1,583 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    accountconnection.cpp
+ * /author  Hackspider
+ * /brief   Source file of the connection of a further moderator account
+ */
+
+/* Necessary dependencies to the standard library */
+#include <string.h>
+
+/* Necessary internal dependencies */
+#include "accountconnection.h"
+
+/* Interval in milliseconds of the keepalive of the account */
+#define ACCOUNT_PING_INTERVAL 180000
+
+/* Interval in milliseconds between the probe joins (twitch permits 20 joins per 10 seconds) */
+#define ACCOUNT_PROBE_INTERVAL 600
+
+/**
+ * /brief AccountConnection definition
+ */
+AccountConnection::AccountConnection(
+                                      QString connectURL,
+                                      quint16 port,
+                                      QString loginName,
+                                      QString loginPass,
+                                      QObject *parent)
+    : QObject(parent),
+    mSocket(nullptr),
+    mConnectURL(connectURL),
+    mPort(port),
+    mLoginName(loginName),
+    mLoginPass(loginPass),
+    mPingTimer(nullptr),
+    mCommandTimer(nullptr),
+    mProbeTimer(nullptr),
+    mState(DISCONNECTED),
+    mLoginRejected(false)
+{
+    /* Socket and timers are children, so they follow the account to its thread */
+    createSocket();
+    mPingTimer = new QTimer(this);
+    mCommandTimer = new QTimer(this);
+    mProbeTimer = new QTimer(this);
+
+    /* Start the monotonic clock of the command queue */
+    mClock.start();
+
+    mPingTimer->setInterval(ACCOUNT_PING_INTERVAL);
+    connect(mPingTimer, SIGNAL(timeout()), this, SLOT(pingTimer()));
+
+    /* Pump the queued moderation commands while there are any */
+    mCommandTimer->setInterval(COMMAND_PUMP_INTERVAL);
+    connect(mCommandTimer, SIGNAL(timeout()), this, SLOT(commandTimer()));
+
+    /* Join the channels one by one to learn the moderator status */
+    mProbeTimer->setInterval(ACCOUNT_PROBE_INTERVAL);
+    connect(mProbeTimer, SIGNAL(timeout()), this, SLOT(probeTimer()));
+}
+
+/**
+ * /brief createSocket definition
+ */
+void AccountConnection::createSocket()
+{
+    mSocket = new QTcpSocket(this);
+
+    /* Connect the tcp socket signals to corresponding methods */
+    connect(mSocket, SIGNAL(connected()),                         this, SLOT(connected()));
+    connect(mSocket, SIGNAL(disconnected()),                      this, SLOT(disconnected()));
+    connect(mSocket, SIGNAL(error(QAbstractSocket::SocketError)), this, SLOT(error(QAbstractSocket::SocketError)));
+    connect(mSocket, SIGNAL(readyRead()),                         this, SLOT(readyRead()));
+}
+
+/**
+ * /brief ~AccountConnection definition
+ */
+AccountConnection::~AccountConnection()
+{
+    /* The last state change must not reach the owner while it is destroyed */
+    if (mSocket != nullptr)
+    {
+        mSocket->disconnect(this);
+        mSocket->abort();
+    }
+}
+
+/**
+ * /brief Connect definition
+ */
+void AccountConnection::Connect()
+{
+    if ( mSocket->state() != QAbstractSocket::UnconnectedState )
+    {
+        return;
+    }
+
+    /* Try the credentials again, a line of the last connection is never continued */
+    mLoginRejected = false;
+    mReadBuffer.clear();
+    setState(CONNECTING);
+
+    mSocket->connectToHost( mConnectURL, mPort );
+}
+
+/**
+ * /brief Disconnect definition
+ */
+void AccountConnection::Disconnect()
+{
+    mSocket->disconnectFromHost();
+}
+
+/**
+ * /brief SetCredentials definition
+ */
+void AccountConnection::SetCredentials(QString loginName, QString loginPass)
+{
+    mLoginName = loginName;
+    mLoginPass = loginPass;
+}
+
+/**
+ * /brief TakeSocket definition
+ */
+QTcpSocket* AccountConnection::TakeSocket(QByteArray* readBuffer)
+{
+    QTcpSocket* socket = mSocket;
+    socket->disconnect(this);
+    socket->setParent(nullptr);
+    *readBuffer = mReadBuffer;
+    mReadBuffer.clear();
+
+    /* Continue disconnected on a new socket, the handed over connection isn't lost */
+    createSocket();
+    mState = DISCONNECTED;
+    mModerator.clear();
+    mProbeQueue.clear();
+    mProbing.clear();
+    mCommandQueue.Requeue();
+    mCommandTimer->stop();
+    mPingTimer->stop();
+    mProbeTimer->stop();
+
+    return socket;
+}
+
+/**
+ * /brief SetChannels definition
+ */
+void AccountConnection::SetChannels(const QSet<QString>& channels)
+{
+    /* Give up the queued commands of the removed channels */
+    foreach (const QString& channel, mChannels - channels)
+    {
+        mModerator.remove(channel);
+        mProbeQueue.removeAll(channel);
+        foreach (const QueuedCommand& removed, mCommandQueue.RemoveChannel(channel))
+        {
+            emit commandFailed(removed.command, removed.userName, removed.channel, "channel removed");
+        }
+    }
+
+    /* Probe the moderator status in the added channels (after the connect all channels are probed) */
+    if (mState == CONNECTED)
+    {
+        foreach (const QString& channel, channels - mChannels)
+        {
+            mProbeQueue.append(channel);
+        }
+        if ( !mProbeQueue.isEmpty() && !mProbeTimer->isActive() )
+        {
+            mProbeTimer->start();
+        }
+    }
+
+    mChannels = channels;
+}
+
+/**
+ * /brief AddCommands definition
+ */
+void AccountConnection::AddCommands(const QSet<QString>& channels, const QString& command, const QString& userName)
+{
+    mCommandQueue.Add(channels, command, userName);
+    pumpCommands();
+}
+
+/**
+ * /brief TakeCommands definition
+ */
+QList<QueuedCommand> AccountConnection::TakeCommands()
+{
+    mCommandTimer->stop();
+
+    return mCommandQueue.TakeAll();
+}
+
+/**
+ * /brief MayModerate definition
+ */
+bool AccountConnection::MayModerate(const QString& channel) const
+{
+    /* A channel without a reported status counts as moderated */
+    QHash<QString, bool>::const_iterator entry = mModerator.constFind(channel);
+    return ( entry == mModerator.constEnd() || entry.value() );
+}
+
+/**
+ * /brief IsModeratorKnown definition
+ */
+bool AccountConnection::IsModeratorKnown(const QString& channel) const
+{
+    return mModerator.contains(channel);
+}
+
+/**
+ * /brief GetUnmoderatedCount definition
+ */
+int AccountConnection::GetUnmoderatedCount() const
+{
+    int count = 0;
+    foreach (bool moderator, mModerator)
+    {
+        if ( !moderator )
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * /brief GetLoginName definition
+ */
+QString AccountConnection::GetLoginName() const
+{
+    return mLoginName;
+}
+
+/**
+ * /brief GetState definition
+ */
+ConnectionState AccountConnection::GetState() const
+{
+    return mState;
+}
+
+/**
+ * /brief IsLoginRejected definition
+ */
+bool AccountConnection::IsLoginRejected() const
+{
+    return mLoginRejected;
+}
+
+/**
+ * /brief GetCommandQueueMetrics definition
+ */
+CommandQueueMetrics AccountConnection::GetCommandQueueMetrics() const
+{
+    return mCommandQueue.Metrics();
+}
+
+/**
+ * /brief connected definition
+ */
+void AccountConnection::connected()
+{
+    /* Write pass and nick with a single write, the answers to the commands are tagged notices */
+    QByteArray login = "PASS " + mLoginPass.toUtf8() + "\r\n" +
+                       "NICK " + mLoginName.toUtf8() + "\r\n" +
+                       "CAP REQ :twitch.tv/tags twitch.tv/commands\r\n";
+    mSocket->write(login);
+}
+
+/**
+ * /brief disconnected definition
+ */
+void AccountConnection::disconnected()
+{
+    setState(DISCONNECTED);
+}
+
+/**
+ * /brief error definition
+ */
+void AccountConnection::error(QAbstractSocket::SocketError error)
+{
+    Q_UNUSED(error);
+
+    /* A failed connect never reaches disconnected() */
+    if ( mState == CONNECTING && mSocket->state() == QAbstractSocket::UnconnectedState )
+    {
+        setState(DISCONNECTED);
+        return;
+    }
+
+    /* In case of error disconnect from host */
+    mSocket->disconnectFromHost();
+}
+
+/**
+ * /brief readyRead definition
+ */
+void AccountConnection::readyRead()
+{
+    ProcessData(mSocket->readAll());
+}
+
+/**
+ * /brief ProcessData definition
+ */
+void AccountConnection::ProcessData(const QByteArray& data)
+{
+    /* Append the data to the incomplete line of the last read */
+    mReadBuffer.append(data);
+
+    const char* buffer = mReadBuffer.constData();
+    int length = mReadBuffer.size();
+    int start = 0;
+
+    /* Iterate over all complete lines received */
+    const char* lineEnd = (const char*)memchr(buffer, '\n', length);
+    while (lineEnd != nullptr)
+    {
+        int end = (int)(lineEnd - buffer);
+
+        IrcMessage message;
+        if ( message.Parse(buffer + start, end - start) )
+        {
+            processMessage(message);
+        }
+
+        start = end + 1;
+        lineEnd = (const char*)memchr(buffer + start, '\n', length - start);
+    }
+
+    /* Keep only the incomplete line for the next read */
+    if (start >= length)
+    {
+        mReadBuffer.clear();
+    }
+    else if (start > 0)
+    {
+        mReadBuffer = mReadBuffer.mid(start);
+    }
+}
+
+/**
+ * /brief processMessage definition
+ */
+void AccountConnection::processMessage(const IrcMessage& message)
+{
+    QLatin1String command = message.Command();
+
+    /* Successful connection message */
+    if ( command == QLatin1String("001") )
+    {
+        setState(CONNECTED);
+        mPingTimer->start();
+
+        /* Learn the moderator status in every channel */
+        mProbeQueue = mChannels.values();
+        if ( !mProbeQueue.isEmpty() )
+        {
+            mProbeTimer->start();
+        }
+
+        /* Send the commands which waited for the connection */
+        pumpCommands();
+    }
+    /* Oauth failed, trying again with the same credentials won't help */
+    else if ( command == QLatin1String("NOTICE") &&
+              message.Param(0) == QLatin1String("*") &&
+              ( message.Trailing() == QLatin1String("Improperly formatted auth") ||
+                message.Trailing() == QLatin1String("Login authentication failed") ) )
+    {
+        mLoginRejected = true;
+        setState(DISCONNECTED);
+        mSocket->disconnectFromHost();
+    }
+    /* Notice of a channel, e.g. the answer to a moderation command */
+    else if ( command == QLatin1String("NOTICE") &&
+              message.Param(0).size() > 1 && message.Param(0).data()[0] == '#' )
+    {
+        QueuedCommand answered;
+        CommandResult result = mCommandQueue.Answer(message.Channel(0), message.Tag(QLatin1String("msg-id")), mClock.elapsed(), &answered);
+
+        /* Commands are not permitted in the channel, so don't send any more */
+        if ( message.Tag(QLatin1String("msg-id")) == QLatin1String("no_permission") )
+        {
+            setModerator(QString(message.Channel(0)), false);
+        }
+
+        if ( result == COMMAND_ACKNOWLEDGED )
+        {
+            emit commandAcknowledged(answered.command, answered.userName, answered.channel);
+        }
+        else if ( result == COMMAND_REJECTED )
+        {
+            emit commandFailed(answered.command, answered.userName, answered.channel,
+                               QString::fromUtf8(message.Trailing().data(), message.Trailing().size()));
+        }
+    }
+    /* Badges of the account in a channel, sent after the join and after every message of the account */
+    else if ( command == QLatin1String("USERSTATE") )
+    {
+        QString channel = QString(message.Channel(0));
+        QLatin1String badges = message.Tag(QLatin1String("badges"));
+        const QByteArray badgeList = QByteArray::fromRawData(badges.data(), badges.size());
+
+        /* The probe is done, the chat of the channel is of no interest */
+        if ( mProbing.remove(channel) )
+        {
+            sendData("PART #" + channel.toUtf8() + "\r\n");
+        }
+
+        if ( mChannels.contains(channel) )
+        {
+            setModerator(channel,
+                         message.Tag(QLatin1String("mod")) == QLatin1String("1") ||
+                         badgeList.contains("moderator/") ||
+                         badgeList.contains("broadcaster/"));
+        }
+    }
+    /* Keepalive of the twitch service */
+    else if ( command == QLatin1String("PING") )
+    {
+        sendData("PONG :" + QByteArray(message.Trailing().data(), message.Trailing().size()) + "\r\n");
+    }
+}
+
+/**
+ * /brief setModerator definition
+ */
+void AccountConnection::setModerator(const QString& channel, bool moderator)
+{
+    mModerator.insert(channel, moderator);
+
+    /* The owner routes the queued commands of the channel to another account */
+    if ( !moderator )
+    {
+        foreach (const QueuedCommand& removed, mCommandQueue.RemoveChannel(channel))
+        {
+            emit commandFailed(removed.command, removed.userName, removed.channel, "not a moderator");
+        }
+    }
+}
+
+/**
+ * /brief setState definition
+ */
+void AccountConnection::setState(ConnectionState state)
+{
+    if (mState == state)
+    {
+        return;
+    }
+    mState = state;
+
+    /* The moderator status is learned again by the next connection */
+    mModerator.clear();
+    mProbeQueue.clear();
+    mProbing.clear();
+    mProbeTimer->stop();
+
+    /* The commands waiting for an answer are sent again by the next connection */
+    if (state != CONNECTED)
+    {
+        mCommandQueue.Requeue();
+        mCommandTimer->stop();
+        mPingTimer->stop();
+    }
+
+    emit stateChanged(state);
+}
+
+/**
+ * /brief sendData definition
+ */
+void AccountConnection::sendData(const QByteArray& data)
+{
+    /* Nothing can be sent without a connection (e.g. while parsing test data) */
+    if (mSocket->state() != QAbstractSocket::ConnectedState)
+    {
+        return;
+    }
+
+    mSocket->write(data);
+}
+
+/**
+ * /brief pumpCommands definition
+ */
+void AccountConnection::pumpCommands()
+{
+    /* The queue is kept until the next connection */
+    if (mState != CONNECTED)
+    {
+        mCommandTimer->stop();
+        return;
+    }
+
+    /* Write the commands the rate allows with a single write to tcp socket */
+    QList<QueuedCommand> failed;
+    QByteArray commands = mCommandQueue.Take(mClock.elapsed(), mChannels, &failed);
+    if ( !commands.isEmpty() )
+    {
+        sendData(commands);
+    }
+
+    foreach (const QueuedCommand& command, failed)
+    {
+        emit commandFailed(command.command, command.userName, command.channel, "no answer");
+    }
+
+    /* Keep pumping only while there are pending or unanswered commands */
+    if ( mCommandQueue.IsEmpty() )
+    {
+        mCommandTimer->stop();
+    }
+    else if ( !mCommandTimer->isActive() )
+    {
+        mCommandTimer->start();
+    }
+}
+
+/**
+ * /brief pingTimer definition
+ */
+void AccountConnection::pingTimer()
+{
+    if (mState == CONNECTED)
+    {
+        sendData("PING\r\n");
+    }
+}
+
+/**
+ * /brief commandTimer definition
+ */
+void AccountConnection::commandTimer()
+{
+    pumpCommands();
+}
+
+/**
+ * /brief probeTimer definition
+ */
+void AccountConnection::probeTimer()
+{
+    if ( mState != CONNECTED || mProbeQueue.isEmpty() )
+    {
+        mProbeTimer->stop();
+        return;
+    }
+
+    /* Join the next channel, it is left again by the answer with the badges of the account */
+    QString channel = mProbeQueue.takeFirst();
+    mProbing.insert(channel);
+    sendData("JOIN #" + channel.toUtf8() + "\r\n");
+}
@@ -0,0 +1,300 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    accountconnection.h
+ * /author  Hackspider
+ * /brief   Header file of the connection of a further moderator account
+ */
+
+/* Include Guard */
+#ifndef ACCOUNTCONNECTION_H
+#define ACCOUNTCONNECTION_H
+
+/* Necessary dependencies to Qt framework */
+#include <QObject>
+#include <QTcpSocket>
+#include <QTimer>
+#include <QSet>
+#include <QHash>
+#include <QStringList>
+#include <QElapsedTimer>
+
+/* Necessary internal dependencies */
+#include "commandqueue.h"
+#include "ircmessage.h"
+
+/* Type to distinguish the twitch connection state */
+typedef enum
+{
+    DISCONNECTED = 0,
+    CONNECTING,
+    CONNECTED,
+} ConnectionState;
+
+/**
+ * /brief  The AccountConnection class declaration. Derived from QObject class.
+ *
+ * A lean connection of a further account which only sends the moderation
+ * commands routed to it: socket, login, keepalive and its own command queue
+ * with its own rate limit. It joins no channel and keeps none of the chat
+ * state (history, indexes, detectors) of the TwitchConnector, which owns the
+ * accounts and routes the commands. Commands the account may not send are
+ * handed back by commandFailed. The moderator status of the account is probed
+ * per channel by a short join, which is left again once twitch reported the
+ * badges of the account (USERSTATE).
+ */
+class AccountConnection : public QObject
+{
+    Q_OBJECT
+public:
+    /**
+     * /brief  Constructor of the AccountConnection class
+     * /param  connectURL  Url to twitch service to connect to
+     * /param  port        Port of the twitch service to connect to
+     * /param  loginName   Username of the account
+     * /param  loginPass   OAuth2 token of the account
+     * /param  parent      Parent of the AccountConnection object according to Qt's object tree
+     */
+    explicit AccountConnection( QString connectURL,
+                                quint16 port,
+                                QString loginName,
+                                QString loginPass,
+                                QObject *parent = nullptr);
+
+    /**
+     * /brief  Destructor of the AccountConnection class
+     */
+    virtual ~AccountConnection(void);
+
+    /**
+     * /brief  Method to connect to the twitch service (nothing happens while the socket is still connected or closing)
+     */
+    void Connect(void);
+
+    /**
+     * /brief  Method to disconnect from the twitch service
+     */
+    void Disconnect(void);
+
+    /**
+     * /brief  Method to set the credentials used by the next connect
+     * /param  loginName  Username of the account
+     * /param  loginPass  OAuth2 token of the account
+     */
+    void SetCredentials(QString loginName, QString loginPass);
+
+    /**
+     * /brief   Method to hand the logged in socket over to another connection. The account continues disconnected on a new
+     *          socket without notifying about the state change, since the connection lives on.
+     * /param   readBuffer  Receives the incomplete line read from the socket so far
+     * /return  Returns the socket without parent, the caller takes the ownership
+     */
+    QTcpSocket* TakeSocket(QByteArray* readBuffer);
+
+    /**
+     * /brief  Method to set the channels commands may be sent to, the queued commands of removed channels are given up
+     * /param  channels  Set of channel names
+     */
+    void SetChannels(const QSet<QString>& channels);
+
+    /**
+     * /brief  Method to queue a moderation command for a set of channels
+     * /param  channels  Set of channels the command shall be sent to
+     * /param  command   Moderation command (e.g. ".ban")
+     * /param  userName  Name of the user the command applies to
+     */
+    void AddCommands(const QSet<QString>& channels, const QString& command, const QString& userName);
+
+    /**
+     * /brief   Method to take all queued and unanswered commands (e.g. to route them to another account)
+     * /return  Returns the commands in the order they have been queued
+     */
+    QList<QueuedCommand> TakeCommands(void);
+
+    /**
+     * /brief   Method to check if the account may send moderation commands to a channel
+     * /param   channel  Name of the channel
+     * /return  Returns false if twitch reported that the account isn't a moderator of the channel
+     */
+    bool MayModerate(const QString& channel) const;
+
+    /**
+     * /brief   Method to check if the moderator status of the account in a channel has been reported already
+     * /param   channel  Name of the channel
+     * /return  Returns false while the channel hasn't been probed yet
+     */
+    bool IsModeratorKnown(const QString& channel) const;
+
+    /**
+     * /brief   Method to get the number of channels where the account isn't a moderator
+     * /return  Returns the number of channels
+     */
+    int GetUnmoderatedCount(void) const;
+
+    /**
+     * /brief   Method to get the login name of the account
+     * /return  Returns the login name
+     */
+    QString GetLoginName(void) const;
+
+    /**
+     * /brief   Method to get the connection state
+     * /return  Returns the connection state
+     */
+    ConnectionState GetState(void) const;
+
+    /**
+     * /brief   Method to check if twitch rejected the credentials of the account, it isn't connected again automatically then
+     * /return  Returns true if the last login has been rejected
+     */
+    bool IsLoginRejected(void) const;
+
+    /**
+     * /brief   Method to get the state of the command queue
+     * /return  Returns the metrics of the command queue
+     */
+    CommandQueueMetrics GetCommandQueueMetrics(void) const;
+
+    /**
+     * /brief  Method to parse raw data as received from the twitch service (used by readyRead and tests)
+     * /param  data  Raw data containing one or more lines of the twitch service
+     */
+    void ProcessData(const QByteArray& data);
+
+signals:
+    /**
+     * /brief  Signal emitted if the connection state changed
+     * /param  state  New connection state
+     */
+    void stateChanged(ConnectionState state);
+
+    /**
+     * /brief  Signal emitted if a queued moderation command won't be sent by this account anymore
+     * /param  command   Moderation command (e.g. ".ban")
+     * /param  userName  Name of the user the command applies to
+     * /param  channel   Channel of the command
+     * /param  reason    Answer of the twitch service or the reason the command has been given up
+     */
+    void commandFailed(QString command, QString userName, QString channel, QString reason);
+
+    /**
+     * /brief  Signal emitted if the twitch service acknowledged a moderation command of this account
+     * /param  command   Moderation command (e.g. ".ban")
+     * /param  userName  Name of the user the command applies to
+     * /param  channel   Channel of the command
+     */
+    void commandAcknowledged(QString command, QString userName, QString channel);
+
+private slots:
+    /**
+     * /brief  Method will be called if the tcp socket has been connected, sends the login
+     */
+    void connected(void);
+
+    /**
+     * /brief  Method will be called if the tcp socket has been disconnected
+     */
+    void disconnected(void);
+
+    /**
+     * /brief  Method will be called if an error occurred on the tcp socket
+     * /param  error  Error of the tcp socket
+     */
+    void error(QAbstractSocket::SocketError error);
+
+    /**
+     * /brief  Method will be called if data is available on the tcp socket
+     */
+    void readyRead(void);
+
+    /**
+     * /brief  Method will be called cyclic to keep the connection alive
+     */
+    void pingTimer(void);
+
+    /**
+     * /brief  Method will be called cyclic while commands are queued
+     */
+    void commandTimer(void);
+
+    /**
+     * /brief  Method will be called cyclic while channels wait for the probe of the moderator status
+     */
+    void probeTimer(void);
+
+private:
+    /**
+     * /brief  Internally used method to set the connection state and to notify about the change
+     * /param  state  New connection state
+     */
+    void setState(ConnectionState state);
+
+    /**
+     * /brief  Internally used method to handle a single tokenized line of the twitch service
+     * /param  message  Tokenized line
+     */
+    void processMessage(const IrcMessage& message);
+
+    /**
+     * /brief  Internally used method to write data to the tcp socket
+     * /param  data  Raw data to be sent
+     */
+    void sendData(const QByteArray& data);
+
+    /**
+     * /brief  Internally used method to send the queued moderation commands the rate allows
+     */
+    void pumpCommands(void);
+
+    /**
+     * /brief  Internally used method to set the moderator status of the account in a channel
+     * /param  channel    Name of the channel
+     * /param  moderator  True if moderation commands are permitted in the channel
+     */
+    void setModerator(const QString& channel, bool moderator);
+
+    /**
+     * /brief  Internally used method to create the tcp socket and to connect its signals
+     */
+    void createSocket(void);
+
+    /**
+     * /brief Internal used variables
+     */
+    QTcpSocket* mSocket;
+    QString mConnectURL;
+    quint16 mPort;
+    QString mLoginName;
+    QString mLoginPass;
+    QTimer* mPingTimer;
+    QTimer* mCommandTimer;
+    QTimer* mProbeTimer;
+    ConnectionState mState;
+    bool mLoginRejected;
+    QSet<QString> mChannels;
+    QHash<QString, bool> mModerator;
+    QStringList mProbeQueue;
+    QSet<QString> mProbing;
+    QByteArray mReadBuffer;
+    CommandQueue mCommandQueue;
+    QElapsedTimer mClock;
+};
+
+#endif /* ACCOUNTCONNECTION_H */
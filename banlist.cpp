@@ -0,0 +1,456 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    banlist.cpp
+ * /author  Hackspider
+ * /brief   Source file of the memory mapped banlist
+ */
+
+/* Necessary dependencies to the standard library */
+#include <string.h>
+#include <algorithm>
+
+/* Necessary dependencies to Qt framework */
+#include <QSaveFile>
+#include <QVector>
+#include <QtEndian>
+
+/* Necessary internal dependencies */
+#include "banlist.h"
+
+/* Maximum number of bucket bits (bounds the size of the bucket table) */
+#define BANLIST_MAX_BUCKET_BITS 24
+
+/**
+ * /brief  Type of a name while the banlist is built
+ */
+typedef struct
+{
+    quint64 hash;
+    QByteArray name;
+} BanListName;
+
+/**
+ * /brief  Helper to sort the names by their hash and their name
+ * /param  left   First name
+ * /param  right  Second name
+ * /return Returns true if the first name is sorted before the second one
+ */
+static bool lessName(const BanListName& left, const BanListName& right)
+{
+    return ( left.hash < right.hash || ( left.hash == right.hash && left.name < right.name ) );
+}
+
+/**
+ * /brief  Helper to convert an ASCII letter to lower case
+ * /param  byte  Character
+ * /return Returns the lower case character
+ */
+static inline uchar lowerByte(uchar byte)
+{
+    return ( byte >= 'A' && byte <= 'Z' ) ? (uchar)(byte + ('a' - 'A')) : byte;
+}
+
+/**
+ * /brief BanList definition
+ */
+BanList::BanList()
+    : mData(nullptr),
+    mSize(0),
+    mCount(0),
+    mBucketBits(0),
+    mBuckets(nullptr),
+    mEntries(nullptr),
+    mNames(nullptr),
+    mNamesSize(0),
+    mLookups(0),
+    mFiltered(0),
+    mHits(0)
+{
+}
+
+/**
+ * /brief ~BanList definition
+ */
+BanList::~BanList()
+{
+    /* Unmap the file */
+    Close();
+}
+
+/**
+ * /brief Open definition
+ */
+bool BanList::Open(const QString& fileName)
+{
+    Close();
+
+    mFile.setFileName(fileName);
+    if ( !mFile.open(QIODevice::ReadOnly) )
+    {
+        return false;
+    }
+
+    /* Map the whole file, nothing is read or parsed */
+    qint64 size = mFile.size();
+    const uchar* data = (size >= BANLIST_HEADER_SIZE) ? mFile.map(0, size) : nullptr;
+    if ( data == nullptr || 0 != memcmp(data, BANLIST_FILE_MAGIC, 8) )
+    {
+        Close();
+        return false;
+    }
+
+    quint32 count = qFromLittleEndian<quint32>(data + 8);
+    quint32 bucketBits = qFromLittleEndian<quint32>(data + 12);
+
+    /* Check that the tables fit into the file */
+    qint64 bucketsSize = ( ((qint64)1 << qMin(bucketBits, (quint32)BANLIST_MAX_BUCKET_BITS)) + 1 ) * 4;
+    qint64 entriesSize = (qint64)count * BANLIST_ENTRY_SIZE;
+    if ( bucketBits > BANLIST_MAX_BUCKET_BITS || BANLIST_HEADER_SIZE + bucketsSize + entriesSize > size )
+    {
+        Close();
+        return false;
+    }
+
+    mData = data;
+    mSize = size;
+    mCount = count;
+    mBucketBits = bucketBits;
+    mBuckets = data + BANLIST_HEADER_SIZE;
+    mEntries = mBuckets + bucketsSize;
+    mNames = mEntries + entriesSize;
+    mNamesSize = size - (BANLIST_HEADER_SIZE + bucketsSize + entriesSize);
+
+    return true;
+}
+
+/**
+ * /brief Close definition
+ */
+void BanList::Close()
+{
+    /* Unmapping is done by closing the file */
+    mFile.close();
+
+    mData = nullptr;
+    mSize = 0;
+    mCount = 0;
+    mBucketBits = 0;
+    mBuckets = nullptr;
+    mEntries = nullptr;
+    mNames = nullptr;
+    mNamesSize = 0;
+    mFilter = BloomFilter();
+}
+
+/**
+ * /brief IsOpen definition
+ */
+bool BanList::IsOpen() const
+{
+    return ( mData != nullptr );
+}
+
+/**
+ * /brief Count definition
+ */
+quint32 BanList::Count() const
+{
+    return mCount;
+}
+
+/**
+ * /brief Hash definition
+ */
+quint64 BanList::Hash(const char* data, int length)
+{
+    /* FNV-1a of the lower case name */
+    quint64 hash = 0xCBF29CE484222325ULL;
+    for (int i=0; i<length; i++)
+    {
+        hash ^= lowerByte((uchar)data[i]);
+        hash *= 0x100000001B3ULL;
+    }
+
+    return hash;
+}
+
+/**
+ * /brief Contains definition
+ */
+bool BanList::Contains(QLatin1String userName) const
+{
+    if ( mData == nullptr || mCount == 0 )
+    {
+        return false;
+    }
+
+    quint64 hash = Hash(userName.data(), userName.size());
+    mLookups++;
+
+    /* Almost all names which are not on the list are rejected by the filter */
+    if ( !mFilter.MayContain(hash) )
+    {
+        mFiltered++;
+        return false;
+    }
+
+    /* The top bits of the hash select the bucket */
+    quint32 bucket = (mBucketBits > 0) ? (quint32)(hash >> (64 - mBucketBits)) : 0;
+    quint32 first = qFromLittleEndian<quint32>(mBuckets + bucket * 4);
+    quint32 last = qMin(qFromLittleEndian<quint32>(mBuckets + (bucket + 1) * 4), mCount);
+
+    /* Binary search of the first entry with the hash within the bucket */
+    while (first < last)
+    {
+        quint32 middle = first + (last - first) / 2;
+        if ( qFromLittleEndian<quint64>(mEntries + middle * BANLIST_ENTRY_SIZE) < hash )
+        {
+            first = middle + 1;
+        }
+        else
+        {
+            last = middle;
+        }
+    }
+
+    /* Compare the names of all entries with the hash */
+    for (quint32 i=first; i<mCount; i++)
+    {
+        const uchar* entry = mEntries + i * BANLIST_ENTRY_SIZE;
+        if ( qFromLittleEndian<quint64>(entry) != hash )
+        {
+            break;
+        }
+
+        quint32 offset = qFromLittleEndian<quint32>(entry + 8);
+        quint32 length = qFromLittleEndian<quint32>(entry + 12);
+        if ( length != (quint32)userName.size() || (qint64)offset + length > mNamesSize )
+        {
+            continue;
+        }
+
+        const uchar* name = mNames + offset;
+        quint32 j = 0;
+        while ( j < length && name[j] == lowerByte((uchar)userName.data()[j]) )
+        {
+            j++;
+        }
+
+        if (j == length)
+        {
+            mHits++;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * /brief BuildFilter definition
+ */
+void BanList::BuildFilter(double falsePositiveRate, qint64 maxBytes)
+{
+    BloomFilter filter;
+    filter.Reset(mCount, falsePositiveRate, maxBytes);
+
+    /* Insert the hashes of the index, the names are not touched */
+    for (quint32 i=0; i<mCount; i++)
+    {
+        filter.Insert( qFromLittleEndian<quint64>(mEntries + i * BANLIST_ENTRY_SIZE) );
+    }
+
+    mFilter = filter;
+}
+
+/**
+ * /brief Metrics definition
+ */
+BanListMetrics BanList::Metrics() const
+{
+    BanListMetrics metrics;
+    metrics.count = mCount;
+    metrics.filterBytes = mFilter.SizeBytes();
+    metrics.filterRate = mFilter.IsEmpty() ? 1.0 : mFilter.EstimatedFalsePositiveRate();
+    metrics.lookups = mLookups;
+    metrics.filtered = mFiltered;
+    metrics.hits = mHits;
+
+    return metrics;
+}
+
+/**
+ * /brief Build definition
+ */
+bool BanList::Build(const QList<QByteArray>& names, const QString& fileName)
+{
+    /* Normalize and hash all names */
+    QVector<BanListName> sorted;
+    sorted.reserve(names.count());
+    foreach (const QByteArray& name, names)
+    {
+        BanListName entry;
+        entry.name = name.trimmed();
+        if ( entry.name.isEmpty() )
+        {
+            continue;
+        }
+
+        /* Fold ASCII only, the same way Hash and Contains do */
+        char* data = entry.name.data();
+        for (int i=0; i<entry.name.size(); i++)
+        {
+            data[i] = (char)lowerByte((uchar)data[i]);
+        }
+        entry.hash = Hash(entry.name.constData(), entry.name.size());
+        sorted.append(entry);
+    }
+
+    /* Sort by hash and drop duplicates */
+    std::sort(sorted.begin(), sorted.end(), lessName);
+    int count = 0;
+    for (int i=0; i<sorted.count(); i++)
+    {
+        if ( count == 0 || sorted.at(i).hash != sorted.at(count - 1).hash || sorted.at(i).name != sorted.at(count - 1).name )
+        {
+            sorted[count++] = sorted.at(i);
+        }
+    }
+    sorted.resize(count);
+
+    /* About one entry per bucket */
+    quint32 bucketBits = 0;
+    while ( bucketBits < BANLIST_MAX_BUCKET_BITS && ((qint64)1 << bucketBits) < count )
+    {
+        bucketBits++;
+    }
+    quint32 bucketCount = (quint32)1 << bucketBits;
+
+    /* Header */
+    QByteArray header(BANLIST_HEADER_SIZE, '\0');
+    memcpy(header.data(), BANLIST_FILE_MAGIC, 8);
+    qToLittleEndian<quint32>((quint32)count, header.data() + 8);
+    qToLittleEndian<quint32>(bucketBits, header.data() + 12);
+
+    /* Bucket table: index of the first entry of every bucket */
+    QByteArray buckets((bucketCount + 1) * 4, '\0');
+    int entry = 0;
+    for (quint32 bucket=0; bucket<=bucketCount; bucket++)
+    {
+        while ( entry < count && bucket < bucketCount &&
+                (bucketBits > 0 ? (quint32)(sorted.at(entry).hash >> (64 - bucketBits)) : 0) < bucket )
+        {
+            entry++;
+        }
+        qToLittleEndian<quint32>( (bucket < bucketCount) ? (quint32)entry : (quint32)count, buckets.data() + bucket * 4 );
+    }
+
+    /* Entries and names */
+    QByteArray entries(count * BANLIST_ENTRY_SIZE, '\0');
+    QByteArray nameData;
+    for (int i=0; i<count; i++)
+    {
+        char* data = entries.data() + i * BANLIST_ENTRY_SIZE;
+        qToLittleEndian<quint64>(sorted.at(i).hash, data);
+        qToLittleEndian<quint32>((quint32)nameData.size(), data + 8);
+        qToLittleEndian<quint32>((quint32)sorted.at(i).name.size(), data + 12);
+        nameData.append(sorted.at(i).name);
+    }
+
+    /* Write to a temporary file, the banlist file is only replaced if all data has been written */
+    QSaveFile file(fileName);
+    if ( !file.open(QIODevice::WriteOnly) )
+    {
+        return false;
+    }
+
+    file.write(header);
+    file.write(buckets);
+    file.write(entries);
+    file.write(nameData);
+
+    return file.commit();
+}
+
+/**
+ * /brief BanListLoader definition
+ */
+BanListLoader::BanListLoader(QObject *parent)
+    : QThread(parent),
+    mFalsePositiveRate(BANLIST_DEFAULT_FILTER_RATE),
+    mMaxBytes(BANLIST_DEFAULT_FILTER_BYTES),
+    mBanList(nullptr)
+{
+}
+
+/**
+ * /brief ~BanListLoader definition
+ */
+BanListLoader::~BanListLoader()
+{
+    /* Wait for a running load and drop a banlist which hasn't been taken */
+    wait();
+    delete mBanList;
+}
+
+/**
+ * /brief Load definition
+ */
+void BanListLoader::Load(const QString& fileName, double falsePositiveRate, qint64 maxBytes)
+{
+    /* Drop a banlist which hasn't been taken */
+    delete mBanList;
+    mBanList = nullptr;
+
+    mFileName = fileName;
+    mFalsePositiveRate = falsePositiveRate;
+    mMaxBytes = maxBytes;
+
+    start(QThread::LowPriority);
+}
+
+/**
+ * /brief TakeBanList definition
+ */
+BanList* BanListLoader::TakeBanList()
+{
+    BanList* banList = mBanList;
+    mBanList = nullptr;
+    return banList;
+}
+
+/**
+ * /brief run definition
+ */
+void BanListLoader::run()
+{
+    BanList* banList = new BanList();
+
+    /* Map the file and build the filter */
+    if ( !banList->Open(mFileName) )
+    {
+        delete banList;
+        return;
+    }
+    banList->BuildFilter(mFalsePositiveRate, mMaxBytes);
+
+    mBanList = banList;
+}
@@ -0,0 +1,228 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    banlist.h
+ * /author  Hackspider
+ * /brief   Header file of the memory mapped banlist
+ */
+
+/* Include Guard */
+#ifndef BANLIST_H
+#define BANLIST_H
+
+/* Necessary dependencies to Qt framework */
+#include <QByteArray>
+#include <QFile>
+#include <QList>
+#include <QString>
+#include <QThread>
+
+/* Necessary internal dependencies */
+#include "bloomfilter.h"
+
+/* Magic bytes at the beginning of every banlist file */
+#define BANLIST_FILE_MAGIC "LPZBAN01"
+
+/* Size of the file header: magic, number of names, number of bucket bits */
+#define BANLIST_HEADER_SIZE 16
+
+/* Size of an index entry: hash, offset and length of the name */
+#define BANLIST_ENTRY_SIZE 16
+
+/* Default target false positive rate of the prefilter */
+#define BANLIST_DEFAULT_FILTER_RATE 0.01
+
+/* Default memory budget of the prefilter in bytes */
+#define BANLIST_DEFAULT_FILTER_BYTES (16 * 1024 * 1024)
+
+/* Type of the metrics of a banlist */
+typedef struct
+{
+    quint32 count;
+    qint64 filterBytes;
+    double filterRate;
+    quint64 lookups;
+    quint64 filtered;
+    quint64 hits;
+} BanListMetrics;
+
+/**
+ * /brief  The BanList class declaration.
+ *
+ * A banlist file is built once from a text list by the banlist builder and
+ * memory mapped as is, so opening it costs nothing regardless of its size.
+ * The file contains the 64 bit hashes of all names in sorted order, a bucket
+ * table indexed by the top bits of the hash and the names themselves:
+ *
+ *     header   magic (8 bytes), count (uint32), bucket bits (uint32)
+ *     buckets  (2^bits + 1) * uint32 index of the first entry of the bucket
+ *     entries  count * (hash (uint64), name offset (uint32), name length (uint32))
+ *     names    lower case names
+ *
+ * All numbers are little endian. A lookup hashes the name, reads two bucket
+ * bounds and searches the few entries in between, without any allocation.
+ * An optional bloom filter built from the hashes rejects almost all names
+ * which are not on the list before the index is touched.
+ */
+class BanList
+{
+public:
+    /**
+     * /brief  Constructor of the BanList class
+     */
+    BanList(void);
+
+    /**
+     * /brief  Destructor of the BanList class
+     */
+    ~BanList(void);
+
+    /**
+     * /brief   Method to map a banlist file, replaces the previously mapped file
+     * /param   fileName  Name of the banlist file
+     * /return  Returns true if the file could be mapped and is a banlist file
+     */
+    bool Open(const QString& fileName);
+
+    /**
+     * /brief  Method to unmap the banlist file
+     */
+    void Close(void);
+
+    /**
+     * /brief   Method to check if a banlist file is mapped
+     * /return  Returns true if a banlist file is mapped
+     */
+    bool IsOpen(void) const;
+
+    /**
+     * /brief   Method to get the number of names of the banlist
+     * /return  Returns the number of names
+     */
+    quint32 Count(void) const;
+
+    /**
+     * /brief   Method to check if a name is on the banlist (case insensitive for ASCII)
+     * /param   userName  Name of the user
+     * /return  Returns true if the name is on the banlist
+     */
+    bool Contains(QLatin1String userName) const;
+
+    /**
+     * /brief  Method to build the bloom filter in front of the lookup from the mapped hashes
+     * /param  falsePositiveRate  Target rate of false positives of the filter
+     * /param  maxBytes           Memory budget of the filter
+     */
+    void BuildFilter(double falsePositiveRate, qint64 maxBytes);
+
+    /**
+     * /brief   Method to get the size of the banlist, of the filter and the lookup counters
+     * /return  Returns the metrics of the banlist
+     */
+    BanListMetrics Metrics(void) const;
+
+    /**
+     * /brief   Method to build a banlist file
+     * /param   names     Names of the banlist (empty and duplicate names are ignored)
+     * /param   fileName  Name of the banlist file
+     * /return  Returns true if the file has been written
+     */
+    static bool Build(const QList<QByteArray>& names, const QString& fileName);
+
+    /**
+     * /brief   Method to calculate the hash of a name as used by the banlist file
+     * /param   data    Pointer to the name
+     * /param   length  Length of the name
+     * /return  Returns the 64 bit hash of the lower case name
+     */
+    static quint64 Hash(const char* data, int length);
+
+private:
+    /**
+     * /brief Internal used variables
+     */
+    QFile mFile;
+    const uchar* mData;
+    qint64 mSize;
+    quint32 mCount;
+    quint32 mBucketBits;
+    const uchar* mBuckets;
+    const uchar* mEntries;
+    const uchar* mNames;
+    qint64 mNamesSize;
+    BloomFilter mFilter;
+    mutable quint64 mLookups;
+    mutable quint64 mFiltered;
+    mutable quint64 mHits;
+};
+
+/**
+ * /brief  The BanListLoader class declaration. Derived from QThread class.
+ *
+ * Maps a banlist file and builds its filter in the background. The owner
+ * takes the ready banlist once the thread has finished and swaps it with the
+ * banlist in use, so lookups never wait for a reload.
+ */
+class BanListLoader : public QThread
+{
+    Q_OBJECT
+public:
+    /**
+     * /brief  Constructor of the BanListLoader class
+     * /param  parent  Parent of the BanListLoader object according to Qt's object tree
+     */
+    explicit BanListLoader(QObject *parent = nullptr);
+
+    /**
+     * /brief  Destructor of the BanListLoader class
+     */
+    virtual ~BanListLoader(void);
+
+    /**
+     * /brief  Method to start loading a banlist in the background (must not be called while running)
+     * /param  fileName           Name of the banlist file
+     * /param  falsePositiveRate  Target rate of false positives of the filter
+     * /param  maxBytes           Memory budget of the filter
+     */
+    void Load(const QString& fileName, double falsePositiveRate, qint64 maxBytes);
+
+    /**
+     * /brief   Method to take the loaded banlist after the thread has finished
+     * /return  Returns the banlist (owned by the caller) or nullptr if the file couldn't be mapped
+     */
+    BanList* TakeBanList(void);
+
+protected:
+    /**
+     * /brief  Loader thread which maps the file and builds the filter
+     */
+    void run(void);
+
+private:
+    /**
+     * /brief Internal used variables
+     */
+    QString mFileName;
+    double mFalsePositiveRate;
+    qint64 mMaxBytes;
+    BanList* mBanList;
+};
+
+#endif /* BANLIST_H */
@@ -0,0 +1,108 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    banstate.cpp
+ * /author  Hackspider
+ * /brief   Source file of the index of the channels a user is banned in
+ */
+
+/* Necessary internal dependencies */
+#include "banstate.h"
+
+/**
+ * /brief BanState definition
+ */
+BanState::BanState()
+    : mCount(0)
+{
+    /* Nothing to do here */
+}
+
+/**
+ * /brief Add definition
+ */
+void BanState::Add(const QString& userName, const QString& channel)
+{
+    QSet<QString>& channels = mBans[userName.toLower()];
+    if ( !channels.contains(channel) )
+    {
+        channels.insert(channel);
+        mCount++;
+    }
+}
+
+/**
+ * /brief Add definition
+ */
+void BanState::Add(const QString& userName, const QSet<QString>& channels)
+{
+    foreach (const QString& channel, channels)
+    {
+        Add(userName, channel);
+    }
+}
+
+/**
+ * /brief Remove definition
+ */
+void BanState::Remove(const QString& userName, const QString& channel)
+{
+    QHash<QString, QSet<QString> >::iterator entry = mBans.find(userName.toLower());
+    if ( entry == mBans.end() )
+    {
+        return;
+    }
+
+    if ( entry.value().remove(channel) )
+    {
+        mCount--;
+    }
+
+    /* Forget users without any ban */
+    if ( entry.value().isEmpty() )
+    {
+        mBans.erase(entry);
+    }
+}
+
+/**
+ * /brief IsBanned definition
+ */
+bool BanState::IsBanned(const QString& userName, const QString& channel) const
+{
+    QHash<QString, QSet<QString> >::const_iterator entry = mBans.constFind(userName.toLower());
+    return ( entry != mBans.constEnd() && entry.value().contains(channel) );
+}
+
+/**
+ * /brief Channels definition
+ */
+QSet<QString> BanState::Channels(const QString& userName) const
+{
+    return mBans.value(userName.toLower());
+}
+
+/**
+ * /brief Count definition
+ */
+int BanState::Count() const
+{
+    return mCount;
+}
@@ -0,0 +1,102 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    banstate.h
+ * /author  Hackspider
+ * /brief   Header file of the index of the channels a user is banned in
+ */
+
+/* Include Guard */
+#ifndef BANSTATE_H
+#define BANSTATE_H
+
+/* Necessary dependencies to Qt framework */
+#include <QHash>
+#include <QSet>
+#include <QString>
+
+/**
+ * /brief  The BanState class declaration.
+ *
+ * Keeps the channels every user is known to be banned in, as loaded from the
+ * ban history and confirmed by the twitch service (acknowledged bans and
+ * CLEARCHAT messages of other moderators). The channels of a user are answered
+ * with a single hash lookup, so a ban fan-out can skip the channels where the
+ * ban is already in place. User names are case insensitive.
+ */
+class BanState
+{
+public:
+    /**
+     * /brief  Constructor of the BanState class
+     */
+    BanState(void);
+
+    /**
+     * /brief  Method to add the ban of a user in a channel
+     * /param  userName  Name of the user
+     * /param  channel   Name of the channel
+     */
+    void Add(const QString& userName, const QString& channel);
+
+    /**
+     * /brief  Method to add the bans of a user in a set of channels
+     * /param  userName  Name of the user
+     * /param  channels  Set of channels
+     */
+    void Add(const QString& userName, const QSet<QString>& channels);
+
+    /**
+     * /brief  Method to remove the ban of a user in a channel
+     * /param  userName  Name of the user
+     * /param  channel   Name of the channel
+     */
+    void Remove(const QString& userName, const QString& channel);
+
+    /**
+     * /brief   Method to check if a user is known to be banned in a channel
+     * /param   userName  Name of the user
+     * /param   channel   Name of the channel
+     * /return  Returns true if the ban is known
+     */
+    bool IsBanned(const QString& userName, const QString& channel) const;
+
+    /**
+     * /brief   Method to get the channels a user is known to be banned in
+     * /param   userName  Name of the user
+     * /return  Returns the set of channels (empty if no ban is known)
+     */
+    QSet<QString> Channels(const QString& userName) const;
+
+    /**
+     * /brief   Method to get the number of known bans
+     * /return  Returns the number of (user, channel) pairs
+     */
+    int Count(void) const;
+
+private:
+    /**
+     * /brief Internal used variables
+     */
+    QHash<QString, QSet<QString> > mBans;
+    int mCount;
+};
+
+#endif /* BANSTATE_H */
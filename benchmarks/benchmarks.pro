@@ -0,0 +1,32 @@
+#-------------------------------------------------
+#
+# Benchmark suite of the twitch connector, models and persistence
+#
+# Run "make benchmark" to write the results as xml to benchmark_results.xml
+#
+#-------------------------------------------------
+
+QT       += core gui network testlib
+
+TARGET = benchmarks
+TEMPLATE = app
+CONFIG += console testcase
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+INCLUDEPATH += ..
+
+include(../twitchcore.pri)
+
+SOURCES += \
+    connectorbenchmark.cpp \
+    ../settingswriter.cpp
+
+HEADERS += \
+    ../settingswriter.h
+
+# Run all benchmarks and write the results in a machine-readable format
+benchmark.commands = $$OUT_PWD/$$TARGET -o benchmark_results.xml,xml
+benchmark.depends = $$TARGET
+QMAKE_EXTRA_TARGETS += benchmark
@@ -0,0 +1,1053 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    connectorbenchmark.cpp
+ * /author  Hackspider
+ * /brief   Benchmark suite of the twitch connector, models and persistence
+ */
+
+/* Necessary dependencies to Qt framework */
+#include <QtTest>
+#include <QStandardItemModel>
+#include <QSettings>
+#include <QTemporaryDir>
+#include <QFile>
+
+/* Necessary internal dependencies */
+#include "twitchconnector.h"
+#include "settingswriter.h"
+#include "keywordmatcher.h"
+#include "spamwavedetector.h"
+#include "ratetracker.h"
+#include "raiddetector.h"
+#include "presenceindex.h"
+#include "usernameindex.h"
+#include "messagehistory.h"
+#include "chatindex.h"
+#include "trafficlog.h"
+#include "tracer.h"
+#include "banlist.h"
+#include "usernamematcher.h"
+
+/* Environment variable which may point to a recorded corpus of raw twitch traffic */
+#define CORPUS_ENVIRONMENT "LPZ_BENCH_CORPUS"
+
+/**
+ * /brief  The ConnectorBenchmark class declaration. Derived from QObject class.
+ */
+class ConnectorBenchmark : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    /**
+     * /brief  Benchmark of the parser with a corpus of raw twitch traffic
+     */
+    void parseCorpus_data(void);
+    void parseCorpus(void);
+
+    /**
+     * /brief  Benchmark of the keyword matcher with a growing number of terms
+     */
+    void matchKeywords_data(void);
+    void matchKeywords(void);
+
+    /**
+     * /brief  Benchmark of the spam wave detection of chat messages from many channels
+     */
+    void detectSpamWave_data(void);
+    void detectSpamWave(void);
+
+    /**
+     * /brief  Benchmark of the message rate tracking of many distinct users
+     */
+    void trackRate_data(void);
+    void trackRate(void);
+
+    /**
+     * /brief  Benchmark of the raid detection of joins spread over many channels
+     */
+    void detectRaid_data(void);
+    void detectRaid(void);
+
+    /**
+     * /brief  Benchmark of the lookup of the channels of users in large channels
+     */
+    void lookupPresence_data(void);
+    void lookupPresence(void);
+
+    /**
+     * /brief  Benchmark of the username completion over a large number of seen users
+     */
+    void completeUsername_data(void);
+    void completeUsername(void);
+
+    /**
+     * /brief  Benchmark of keeping the recent messages of many distinct users
+     */
+    void recordMessageHistory_data(void);
+    void recordMessageHistory(void);
+
+    /**
+     * /brief  Benchmark of the search of half an hour of chat by user and by words
+     */
+    void searchChat_data(void);
+    void searchChat(void);
+
+    /**
+     * /brief  Benchmark of the network path of the traffic log while the writer thread writes the files
+     */
+    void appendTrafficLog_data(void);
+    void appendTrafficLog(void);
+
+    /**
+     * /brief  Benchmark of the parser with the trace spans disabled and enabled
+     */
+    void traceSpans_data(void);
+    void traceSpans(void);
+
+    /**
+     * /brief  Benchmark of the lookup of users in a large banlist
+     */
+    void banListLookup_data(void);
+    void banListLookup(void);
+
+    /**
+     * /brief  Benchmark of the matching of users against many username patterns
+     */
+    void matchUsernamePatterns_data(void);
+    void matchUsernamePatterns(void);
+
+    /**
+     * /brief  Benchmark of the bookkeeping of a ban fan-out through the command queue until every channel has acknowledged
+     */
+    void queueBan_data(void);
+    void queueBan(void);
+
+    /**
+     * /brief  Benchmark of the persistence of the user model
+     */
+    void writeUserSettings_data(void);
+    void writeUserSettings(void);
+
+    /**
+     * /brief  Benchmark of adding and sorting channels of the channel model
+     */
+    void channelModelAppend_data(void);
+    void channelModelAppend(void);
+
+    /**
+     * /brief  Benchmark of a channel join confirmation against a large number of channels
+     */
+    void channelModelJoin_data(void);
+    void channelModelJoin(void);
+
+private:
+    /**
+     * /brief   Helper to create a synthetic corpus of raw twitch traffic
+     * /param   lines     Number of lines of the corpus
+     * /param   channels  Number of different channels in the corpus
+     * /return  Returns the raw corpus
+     */
+    static QByteArray createCorpus(int lines, int channels);
+
+    /**
+     * /brief   Helper to create a set of channel names
+     * /param   count  Number of channels
+     * /return  Returns the set of channel names
+     */
+    static QSet<QString> createChannels(int count);
+
+    /**
+     * /brief  Helper to fill the channel model with channels
+     * /param  model  Pointer to the channel model
+     * /param  count  Number of channels
+     */
+    static void fillChannelModel(QStandardItemModel* model, int count);
+};
+
+/**
+ * /brief createCorpus definition
+ */
+QByteArray ConnectorBenchmark::createCorpus(int lines, int channels)
+{
+    QByteArray corpus;
+
+    for (int i=0; i<lines; i++)
+    {
+        QByteArray channel = "channel" + QByteArray::number(i % channels);
+        QByteArray user = "user" + QByteArray::number(i);
+
+        /* Mostly chat messages with some join confirmations and parts in between */
+        if ( 0 == (i % 50) )
+        {
+            corpus.append(":bot.tmi.twitch.tv 353 bot = #" + channel + " :bot " + user + "\r\n");
+            corpus.append(":bot.tmi.twitch.tv 366 bot #" + channel + " :End of /NAMES list\r\n");
+        }
+        else if ( 0 == (i % 97) )
+        {
+            corpus.append(":" + user + "!" + user + "@" + user + ".tmi.twitch.tv PART #" + channel + "\r\n");
+        }
+        else
+        {
+            corpus.append(":" + user + "!" + user + "@" + user + ".tmi.twitch.tv PRIVMSG #" + channel + " :Kappa this is chat message number " + QByteArray::number(i) + "\r\n");
+        }
+    }
+
+    return corpus;
+}
+
+/**
+ * /brief createChannels definition
+ */
+QSet<QString> ConnectorBenchmark::createChannels(int count)
+{
+    QSet<QString> channels;
+
+    for (int i=0; i<count; i++)
+    {
+        channels.insert(QString("channel%1").arg(i));
+    }
+
+    return channels;
+}
+
+/**
+ * /brief fillChannelModel definition
+ */
+void ConnectorBenchmark::fillChannelModel(QStandardItemModel* model, int count)
+{
+    for (int i=0; i<count; i++)
+    {
+        QStandardItem* channel = new QStandardItem(QString("channel%1").arg(i));
+        channel->setCheckable(true);
+        channel->setCheckState(Qt::Checked);
+        model->appendRow(channel);
+    }
+}
+
+/**
+ * /brief parseCorpus_data definition
+ */
+void ConnectorBenchmark::parseCorpus_data()
+{
+    QTest::addColumn<QByteArray>("corpus");
+
+    /* Prefer a recorded corpus if available */
+    QString corpusPath = QString::fromLocal8Bit(qgetenv(CORPUS_ENVIRONMENT));
+    if ( !corpusPath.isEmpty() )
+    {
+        QFile corpusFile(corpusPath);
+        if ( corpusFile.open(QIODevice::ReadOnly) )
+        {
+            QTest::newRow("recorded") << corpusFile.readAll();
+        }
+    }
+
+    QTest::newRow("1k lines")   << createCorpus(1000,   10);
+    QTest::newRow("10k lines")  << createCorpus(10000,  100);
+}
+
+/**
+ * /brief parseCorpus definition
+ */
+void ConnectorBenchmark::parseCorpus()
+{
+    QFETCH(QByteArray, corpus);
+
+    TwitchConnector connector("localhost", 6667, "bot", "oauth:bot");
+    connector.SetChannels(createChannels(100));
+
+    QBENCHMARK
+    {
+        connector.ProcessData(corpus);
+    }
+}
+
+/**
+ * /brief matchKeywords_data definition
+ */
+void ConnectorBenchmark::matchKeywords_data()
+{
+    QTest::addColumn<int>("termCount");
+
+    QTest::newRow("10 terms")   << 10;
+    QTest::newRow("100 terms")  << 100;
+    QTest::newRow("1000 terms") << 1000;
+}
+
+/**
+ * /brief matchKeywords definition
+ */
+void ConnectorBenchmark::matchKeywords()
+{
+    QFETCH(int, termCount);
+
+    QStringList terms;
+    for (int i=0; i<termCount; i++)
+    {
+        terms << QString("spamterm%1").arg(i);
+    }
+
+    KeywordMatcher matcher;
+    matcher.Compile(terms);
+
+    /* Messages without any hit force a scan of the whole text */
+    QList<QByteArray> messages;
+    for (int i=0; i<1000; i++)
+    {
+        messages << "Kappa this is a perfectly normal chat message number " + QByteArray::number(i);
+    }
+
+    int hits = 0;
+    QBENCHMARK
+    {
+        for (int i=0; i<messages.count(); i++)
+        {
+            if ( matcher.Match(messages.at(i).constData(), messages.at(i).size()) >= 0 )
+            {
+                hits++;
+            }
+        }
+    }
+
+    QCOMPARE(hits, 0);
+}
+
+/**
+ * /brief detectSpamWave_data definition
+ */
+void ConnectorBenchmark::detectSpamWave_data()
+{
+    QTest::addColumn<int>("channelCount");
+
+    QTest::newRow("10 channels")   << 10;
+    QTest::newRow("100 channels")  << 100;
+    QTest::newRow("1000 channels") << 1000;
+}
+
+/**
+ * /brief detectSpamWave definition
+ */
+void ConnectorBenchmark::detectSpamWave()
+{
+    QFETCH(int, channelCount);
+
+    static const char* words[] = { "kappa", "pog", "lol", "gg", "nice", "play", "what", "was",
+                                   "that", "clutch", "stream", "today", "chat", "hype", "boss", "fight",
+                                   "again", "why", "so", "good", "bad", "lag", "wow", "omg",
+                                   "first", "time", "here", "love", "this", "game", "music", "song",
+                                   "name", "please", "help", "the", "a", "is", "it", "no" };
+
+    /* Every tenth message is a copy of the same spam, the copies rotate through all channels */
+    QList<QByteArray> channels;
+    QList<QByteArray> messages;
+    quint32 seed = 1;
+    for (int i=0; i<10000; i++)
+    {
+        if (i % 10 == 0)
+        {
+            channels << "channel" + QByteArray::number((i / 10) % channelCount);
+            messages << "Buy cheap followers and viewers at spam dot example " + QByteArray::number(i % 3);
+        }
+        else
+        {
+            /* Normal chat is made of random words, so it doesn't form a wave by itself */
+            QByteArray message;
+            for (int w=0; w<8; w++)
+            {
+                seed = seed * 1103515245 + 12345;
+                message += (w > 0) ? " " : "";
+                message += words[(seed >> 16) % (sizeof(words) / sizeof(words[0]))];
+            }
+            channels << "channel" + QByteArray::number(i % channelCount);
+            messages << message;
+        }
+    }
+
+    int spamAuthors = 0;
+    int chatAuthors = 0;
+    QBENCHMARK
+    {
+        SpamWaveDetector detector;
+        QStringList users;
+        QSet<QString> waveChannels;
+        spamAuthors = 0;
+        chatAuthors = 0;
+
+        for (int i=0; i<messages.count(); i++)
+        {
+            QByteArray userName = "user" + QByteArray::number(i);
+            if ( detector.Add(QLatin1String(userName.constData(), userName.size()),
+                              QLatin1String(channels.at(i).constData(), channels.at(i).size()),
+                              messages.at(i).constData(), messages.at(i).size(), i, &users, &waveChannels) )
+            {
+                /* The authors are named after the index of their message */
+                foreach (const QString& user, users)
+                {
+                    if (user.mid(4).toInt() % 10 == 0)
+                    {
+                        spamAuthors++;
+                    }
+                    else
+                    {
+                        chatAuthors++;
+                    }
+                }
+            }
+        }
+    }
+
+    /* Every spam author is reported once, nobody else */
+    QCOMPARE(spamAuthors, messages.count() / 10);
+    QCOMPARE(chatAuthors, 0);
+}
+
+/**
+ * /brief trackRate_data definition
+ */
+void ConnectorBenchmark::trackRate_data()
+{
+    QTest::addColumn<int>("userCount");
+
+    QTest::newRow("1k users")   << 1000;
+    QTest::newRow("100k users") << 100000;
+    QTest::newRow("1M users")   << 1000000;
+}
+
+/**
+ * /brief trackRate definition
+ */
+void ConnectorBenchmark::trackRate()
+{
+    QFETCH(int, userCount);
+
+    QList<QByteArray> userNames;
+    for (int i=0; i<100000; i++)
+    {
+        userNames << "user" + QByteArray::number( (i * 7919) % userCount );
+    }
+
+    RateTracker tracker;
+    qint64 timestamp = 0;
+
+    QBENCHMARK
+    {
+        for (int i=0; i<userNames.count(); i++)
+        {
+            tracker.Record(QLatin1String(userNames.at(i).constData(), userNames.at(i).size()), timestamp + i / 100, nullptr, nullptr);
+        }
+        timestamp += 1000;
+    }
+
+    QVERIFY( !tracker.TopUsers(10, timestamp).isEmpty() );
+}
+
+/**
+ * /brief detectRaid_data definition
+ */
+void ConnectorBenchmark::detectRaid_data()
+{
+    QTest::addColumn<int>("channelCount");
+
+    QTest::newRow("1 channel")      << 1;
+    QTest::newRow("100 channels")   << 100;
+}
+
+/**
+ * /brief detectRaid definition
+ */
+void ConnectorBenchmark::detectRaid()
+{
+    QFETCH(int, channelCount);
+
+    QList<QByteArray> channels;
+    for (int i=0; i<channelCount; i++)
+    {
+        channels << "channel" + QByteArray::number(i);
+    }
+
+    QList<QByteArray> users;
+    for (int i=0; i<10000; i++)
+    {
+        users << "user" + QByteArray::number(i);
+    }
+
+    RaidDetector detector;
+    QStringList raidUsers;
+    qint64 timestamp = 0;
+
+    /* 10000 joins per second */
+    QBENCHMARK
+    {
+        for (int i=0; i<users.count(); i++)
+        {
+            const QByteArray& channel = channels.at(i % channelCount);
+            raidUsers.clear();
+            detector.Add(QLatin1String(channel.constData(), channel.size()),
+                         QLatin1String(users.at(i).constData(), users.at(i).size()),
+                         timestamp + i / 10, &raidUsers, nullptr, nullptr);
+        }
+        timestamp += 1000;
+    }
+}
+
+/**
+ * /brief lookupPresence_data definition
+ */
+void ConnectorBenchmark::lookupPresence_data()
+{
+    QTest::addColumn<int>("channelCount");
+    QTest::addColumn<int>("memberCount");
+
+    QTest::newRow("10 channels, 1k members")    << 10 << 1000;
+    QTest::newRow("50 channels, 20k members")   << 50 << 20000;
+}
+
+/**
+ * /brief lookupPresence definition
+ */
+void ConnectorBenchmark::lookupPresence()
+{
+    QFETCH(int, channelCount);
+    QFETCH(int, memberCount);
+
+    /* The members of neighbouring channels overlap by half */
+    PresenceIndex index;
+    for (int c=0; c<channelCount; c++)
+    {
+        QByteArray channel = "channel" + QByteArray::number(c);
+        for (int i=0; i<memberCount; i++)
+        {
+            QByteArray user = "user" + QByteArray::number(c * memberCount / 2 + i);
+            index.Join(QLatin1String(channel.constData(), channel.size()), QLatin1String(user.constData(), user.size()));
+        }
+    }
+
+    QStringList users;
+    for (int i=0; i<1000; i++)
+    {
+        users << "user" + QString::number( (i * 7919) % (channelCount * memberCount) );
+    }
+
+    int present = 0;
+    QBENCHMARK
+    {
+        foreach (const QString& user, users)
+        {
+            present += index.Channels(user).count();
+        }
+    }
+
+    QVERIFY(present > 0);
+}
+
+/**
+ * /brief completeUsername_data definition
+ */
+void ConnectorBenchmark::completeUsername_data()
+{
+    QTest::addColumn<int>("userCount");
+
+    QTest::newRow("100k users")  << 100000;
+    QTest::newRow("1M users")    << 1000000;
+}
+
+/**
+ * /brief completeUsername definition
+ */
+void ConnectorBenchmark::completeUsername()
+{
+    QFETCH(int, userCount);
+
+    UsernameIndex index;
+    for (int i=0; i<userCount; i++)
+    {
+        index.Add("user" + QString::number( (i * 7919LL) % userCount ), false);
+    }
+
+    QStringList prefixes;
+    for (int i=0; i<1000; i++)
+    {
+        prefixes << "user" + QString::number(i);
+    }
+
+    int completions = 0;
+    QBENCHMARK
+    {
+        foreach (const QString& prefix, prefixes)
+        {
+            completions += index.Complete(prefix, 20).count();
+        }
+    }
+
+    QVERIFY(completions > 0);
+}
+
+/**
+ * /brief recordMessageHistory_data definition
+ */
+void ConnectorBenchmark::recordMessageHistory_data()
+{
+    QTest::addColumn<int>("userCount");
+
+    QTest::newRow("1k users")    << 1000;
+    QTest::newRow("100k users")  << 100000;
+}
+
+/**
+ * /brief recordMessageHistory definition
+ */
+void ConnectorBenchmark::recordMessageHistory()
+{
+    QFETCH(int, userCount);
+
+    QList<QByteArray> users;
+    for (int i=0; i<userCount; i++)
+    {
+        users << "user" + QByteArray::number(i);
+    }
+
+    QByteArray channel = "channel0";
+    QByteArray text = "buy followers, primes and viewers at example.com";
+
+    MessageHistory history;
+    qint64 timestamp = 1528000000000LL;
+    QBENCHMARK
+    {
+        foreach (const QByteArray& user, users)
+        {
+            history.Record(QLatin1String(user.constData(), user.size()),
+                           QLatin1String(channel.constData(), channel.size()),
+                           text.constData(), text.size(), timestamp++);
+        }
+    }
+
+    QVERIFY( !history.Snapshot(QString(users.last())).isEmpty() );
+}
+
+/**
+ * /brief searchChat_data definition
+ */
+void ConnectorBenchmark::searchChat_data()
+{
+    QTest::addColumn<int>("messageCount");
+    QTest::addColumn<bool>("byUser");
+
+    QTest::newRow("100k messages, user")   << 100000  << true;
+    QTest::newRow("100k messages, words")  << 100000  << false;
+    QTest::newRow("1M messages, user")     << 1000000 << true;
+    QTest::newRow("1M messages, words")    << 1000000 << false;
+}
+
+/**
+ * /brief searchChat definition
+ */
+void ConnectorBenchmark::searchChat()
+{
+    QFETCH(int, messageCount);
+    QFETCH(bool, byUser);
+
+    /* The messages are spread evenly over the last 30 minutes */
+    ChatIndex index;
+    QByteArray channel = "channel0";
+    qint64 start = QDateTime::currentMSecsSinceEpoch() - 30LL * 60 * 1000;
+    for (int i=0; i<messageCount; i++)
+    {
+        QByteArray user = "user" + QByteArray::number(i % 20000);
+        QByteArray text = "Kappa this is chat message word" + QByteArray::number(i % 1000) + " number " + QByteArray::number(i);
+        index.Add(QLatin1String(user.constData(), user.size()),
+                  QLatin1String(channel.constData(), channel.size()),
+                  text.constData(), text.size(), start + (30LL * 60 * 1000 * i) / messageCount);
+    }
+
+    int hits = 0;
+    QBENCHMARK
+    {
+        for (int i=0; i<100; i++)
+        {
+            if (byUser)
+            {
+                hits += index.Search(QString("user%1").arg(i * 199), QString(), start).count();
+            }
+            else
+            {
+                hits += index.Search(QString(), QString("chat word%1").arg(i), start).count();
+            }
+        }
+    }
+
+    QVERIFY(hits > 0);
+}
+
+/**
+ * /brief appendTrafficLog_data definition
+ */
+void ConnectorBenchmark::appendTrafficLog_data()
+{
+    QTest::addColumn<bool>("compress");
+
+    QTest::newRow("plain")       << false;
+    QTest::newRow("compressed")  << true;
+}
+
+/**
+ * /brief appendTrafficLog definition
+ */
+void ConnectorBenchmark::appendTrafficLog()
+{
+    QFETCH(bool, compress);
+
+    QTemporaryDir directory;
+    QVERIFY( directory.isValid() );
+
+    /* Reads of about 4 kB as delivered by the socket */
+    QList<QByteArray> reads;
+    QByteArray corpus = createCorpus(10000, 100);
+    for (int i=0; i<corpus.size(); i+=4096)
+    {
+        reads << corpus.mid(i, 4096);
+    }
+
+    TrafficLog log;
+    QVERIFY( log.Start(directory.filePath("traffic"), TRAFFIC_LOG_DEFAULT_MAX_BYTES, 0, compress) );
+
+    QBENCHMARK
+    {
+        foreach (const QByteArray& data, reads)
+        {
+            log.Append(RECORD_INBOUND, data);
+        }
+    }
+
+    log.Stop();
+
+    /* Dropped reads are counted, everything else has been written */
+    TrafficLogMetrics metrics = log.Metrics();
+    QVERIFY( metrics.records + metrics.droppedRecords > 0 );
+    QVERIFY( metrics.files > 0 );
+}
+
+/**
+ * /brief traceSpans_data definition
+ */
+void ConnectorBenchmark::traceSpans_data()
+{
+    QTest::addColumn<bool>("enabled");
+
+    QTest::newRow("tracing off")  << false;
+    QTest::newRow("tracing on")   << true;
+}
+
+/**
+ * /brief traceSpans definition
+ */
+void ConnectorBenchmark::traceSpans()
+{
+    QFETCH(bool, enabled);
+
+    QByteArray corpus = createCorpus(100000, 100);
+    TwitchConnector connector("localhost", 6667, "bot", "oauth:bot");
+
+    Tracer::SetEnabled(enabled);
+    QBENCHMARK
+    {
+        connector.ProcessData(corpus);
+    }
+    Tracer::SetEnabled(false);
+
+    QTemporaryDir directory;
+    QVERIFY( directory.isValid() );
+    int count = Tracer::WriteChromeTrace(directory.filePath("trace.json"));
+    QVERIFY( enabled ? (count > 0) : (count >= 0) );
+}
+
+/**
+ * /brief banListLookup_data definition
+ */
+void ConnectorBenchmark::banListLookup_data()
+{
+    QTest::addColumn<int>("nameCount");
+    QTest::addColumn<bool>("filtered");
+
+    QTest::newRow("10k names")          << 10000   << false;
+    QTest::newRow("1M names")           << 1000000 << false;
+    QTest::newRow("1M names filtered")  << 1000000 << true;
+}
+
+/**
+ * /brief banListLookup definition
+ */
+void ConnectorBenchmark::banListLookup()
+{
+    QFETCH(int, nameCount);
+    QFETCH(bool, filtered);
+
+    QTemporaryDir directory;
+    QVERIFY( directory.isValid() );
+
+    QList<QByteArray> names;
+    for (int i=0; i<nameCount; i++)
+    {
+        names << "bot" + QByteArray::number(i);
+    }
+
+    QString fileName = directory.path() + "/banlist.bin";
+    QVERIFY( BanList::Build(names, fileName) );
+
+    BanList banList;
+    QVERIFY( banList.Open(fileName) );
+
+    if (filtered)
+    {
+        banList.BuildFilter(BANLIST_DEFAULT_FILTER_RATE, BANLIST_DEFAULT_FILTER_BYTES);
+    }
+
+    /* Half of the users are on the banlist */
+    QList<QByteArray> users;
+    for (int i=0; i<10000; i++)
+    {
+        users << ( (i % 2 == 0) ? "bot" : "user" ) + QByteArray::number( (i * 7919) % nameCount );
+    }
+
+    int hits = 0;
+    QBENCHMARK
+    {
+        for (int i=0; i<users.count(); i++)
+        {
+            if ( banList.Contains(QLatin1String(users.at(i).constData(), users.at(i).size())) )
+            {
+                hits++;
+            }
+        }
+    }
+
+    QVERIFY(hits > 0);
+}
+
+/**
+ * /brief matchUsernamePatterns_data definition
+ */
+void ConnectorBenchmark::matchUsernamePatterns_data()
+{
+    QTest::addColumn<int>("patternCount");
+
+    QTest::newRow("10 patterns")    << 10;
+    QTest::newRow("100 patterns")   << 100;
+    QTest::newRow("1000 patterns")  << 1000;
+}
+
+/**
+ * /brief matchUsernamePatterns definition
+ */
+void ConnectorBenchmark::matchUsernamePatterns()
+{
+    QFETCH(int, patternCount);
+
+    /* Typical bot name families: a fixed prefix followed by digits or anything */
+    QStringList patterns;
+    for (int i=0; i<patternCount; i++)
+    {
+        patterns << ( (i % 2 == 0) ? QString("bot%1_[0-9]+").arg(i) : QString("spam%1*").arg(i) );
+    }
+
+    UsernameMatcher matcher;
+    QString errorString;
+    QVERIFY2( matcher.Compile(patterns, &errorString), qPrintable(errorString) );
+
+    /* A few of the users match a pattern */
+    QList<QByteArray> users;
+    for (int i=0; i<10000; i++)
+    {
+        users << ( (i % 10 == 0) ? "bot" + QByteArray::number( (i / 10 % patternCount) & ~1 ) + "_" + QByteArray::number(i)
+                                 : "viewer" + QByteArray::number(i) );
+    }
+
+    int hits = 0;
+    QBENCHMARK
+    {
+        for (int i=0; i<users.count(); i++)
+        {
+            if ( matcher.Match(users.at(i).constData(), users.at(i).size()) >= 0 )
+            {
+                hits++;
+            }
+        }
+    }
+
+    QVERIFY(hits > 0);
+}
+
+/**
+ * /brief queueBan_data definition
+ */
+void ConnectorBenchmark::queueBan_data()
+{
+    QTest::addColumn<int>("channelCount");
+
+    QTest::newRow("10 channels")   << 10;
+    QTest::newRow("100 channels")  << 100;
+    QTest::newRow("1000 channels") << 1000;
+}
+
+/**
+ * /brief queueBan definition
+ */
+void ConnectorBenchmark::queueBan()
+{
+    QFETCH(int, channelCount);
+
+    QSet<QString> channels = createChannels(channelCount);
+    CommandQueue queue;
+    QList<QueuedCommand> failed;
+    qint64 now = 0;
+    int sent = 0;
+
+    QBENCHMARK
+    {
+        queue.Add(channels, ".ban", "some_troll_user");
+
+        /* Let enough time pass between the takes to refill the token bucket and acknowledge every sent command */
+        while ( !queue.IsEmpty() )
+        {
+            now += 60000;
+            QList<QByteArray> commands = queue.Take(now, channels, &failed).split('\n');
+            foreach (const QByteArray& command, commands)
+            {
+                /* PRIVMSG #<channel> :.ban <user> */
+                int separator = command.indexOf(" :");
+                if ( separator > 9 )
+                {
+                    queue.Answer(QLatin1String(command.constData() + 9, separator - 9), QLatin1String("ban_success"), now, nullptr);
+                    sent++;
+                }
+            }
+        }
+    }
+
+    QVERIFY(sent > 0);
+    QVERIFY(failed.isEmpty());
+}
+
+/**
+ * /brief writeUserSettings_data definition
+ */
+void ConnectorBenchmark::writeUserSettings_data()
+{
+    QTest::addColumn<int>("rowCount");
+
+    QTest::newRow("1k rows")   << 1000;
+    QTest::newRow("10k rows")  << 10000;
+    QTest::newRow("100k rows") << 100000;
+}
+
+/**
+ * /brief writeUserSettings definition
+ */
+void ConnectorBenchmark::writeUserSettings()
+{
+    QFETCH(int, rowCount);
+
+    QTemporaryDir configDir;
+    QVERIFY(configDir.isValid());
+
+    QSettings settings(configDir.filePath("config.ini"), QSettings::IniFormat);
+    QStandardItemModel userModel;
+
+    for (int i=0; i<rowCount; i++)
+    {
+        QList<QStandardItem*> userRow;
+        userRow << new QStandardItem("2018.06.03 02:18:00")
+                << new QStandardItem(QString("user%1").arg(i))
+                << new QStandardItem("channel0;channel1;channel2")
+                << new QStandardItem("spam")
+                << new QStandardItem("https://clips.twitch.tv/")
+                << new QStandardItem("2018.06.03 02:17:58 #channel0: buy followers at example.com");
+        userModel.appendRow(userRow);
+    }
+
+    QBENCHMARK
+    {
+        SettingsWriter::WriteUsers(&settings, &userModel);
+        settings.sync();
+    }
+}
+
+/**
+ * /brief channelModelAppend_data definition
+ */
+void ConnectorBenchmark::channelModelAppend_data()
+{
+    QTest::addColumn<int>("channelCount");
+
+    QTest::newRow("100 channels")   << 100;
+    QTest::newRow("1000 channels")  << 1000;
+    QTest::newRow("10000 channels") << 10000;
+}
+
+/**
+ * /brief channelModelAppend definition
+ */
+void ConnectorBenchmark::channelModelAppend()
+{
+    QFETCH(int, channelCount);
+
+    QBENCHMARK
+    {
+        QStandardItemModel channelModel;
+        fillChannelModel(&channelModel, channelCount);
+        channelModel.sort(0);
+    }
+}
+
+/**
+ * /brief channelModelJoin_data definition
+ */
+void ConnectorBenchmark::channelModelJoin_data()
+{
+    QTest::addColumn<int>("channelCount");
+
+    QTest::newRow("100 channels")   << 100;
+    QTest::newRow("1000 channels")  << 1000;
+    QTest::newRow("10000 channels") << 10000;
+}
+
+/**
+ * /brief channelModelJoin definition
+ */
+void ConnectorBenchmark::channelModelJoin()
+{
+    QFETCH(int, channelCount);
+
+    TwitchConnector connector("localhost", 6667, "bot", "oauth:bot");
+    connector.SetChannels(createChannels(channelCount));
+
+    /* Confirm the join of the last channel to force a full lookup */
+    QByteArray joinConfirmation = ":bot.tmi.twitch.tv 366 bot #channel" + QByteArray::number(channelCount - 1) + " :End of /NAMES list\r\n";
+
+    QBENCHMARK
+    {
+        connector.ProcessData(joinConfirmation);
+    }
+}
+
+QTEST_MAIN(ConnectorBenchmark)
+
+#include "connectorbenchmark.moc"
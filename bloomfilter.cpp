@@ -0,0 +1,182 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    bloomfilter.cpp
+ * /author  Hackspider
+ * /brief   Source file of the blocked bloom filter
+ */
+
+/* Necessary dependencies to the standard library */
+#include <math.h>
+
+/* Necessary internal dependencies */
+#include "bloomfilter.h"
+
+/* Odd constants which derive the bit of every word from the lower half of the hash */
+static const quint32 bloomSalt[BLOOM_BLOCK_WORDS] =
+{
+    0x47B6137BU, 0x44974D91U, 0x8824AD5BU, 0xA2B7289DU,
+    0x705495C7U, 0x2DF1424BU, 0x9EFC4947U, 0x5C6BFB31U
+};
+
+/**
+ * /brief  Helper to spread the bits of a hash of unknown quality (finalizer of splitmix64)
+ * /param  hash  Hash of the key
+ * /return Returns the mixed hash
+ */
+static inline quint64 mixHash(quint64 hash)
+{
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+    return hash ^ (hash >> 31);
+}
+
+/**
+ * /brief  Helper to estimate the false positive rate of a split block filter
+ * /param  keysPerBlock  Average number of keys per block
+ * /return Returns the rate of false positives, averaged over the poisson distributed load of the blocks
+ */
+static double estimateRate(double keysPerBlock)
+{
+    /* All words of such a block are full, and exp(-keysPerBlock) underflows a little above */
+    if (keysPerBlock > BLOOM_SATURATED_KEYS)
+    {
+        return 1.0;
+    }
+
+    double rate = 0.0;
+    double probability = exp(-keysPerBlock);
+    int maxKeys = (int)(keysPerBlock * 4) + 64;
+
+    for (int keys=0; keys<maxKeys; keys++)
+    {
+        /* A word of a block with the given number of keys has a bit set with this probability */
+        rate += probability * pow(1.0 - pow(1.0 - 1.0 / 32, keys), BLOOM_BLOCK_WORDS);
+        probability *= keysPerBlock / (keys + 1);
+    }
+
+    return rate;
+}
+
+/**
+ * /brief BloomFilter definition
+ */
+BloomFilter::BloomFilter()
+    : mBlockCount(0),
+    mKeyCount(0)
+{
+}
+
+/**
+ * /brief Reset definition
+ */
+void BloomFilter::Reset(quint32 count, double falsePositiveRate, qint64 maxBytes)
+{
+    /* Bits per key of a classic filter with eight bits per key for the target rate */
+    double rate = qBound(1e-6, falsePositiveRate, 0.5);
+    double bitsPerKey = -BLOOM_BLOCK_WORDS / log(1.0 - pow(rate, 1.0 / BLOOM_BLOCK_WORDS));
+    qint64 blocks = qMax((qint64)1, (qint64)ceil( (double)count * bitsPerKey / (BLOOM_BLOCK_WORDS * 32) ));
+
+    /* The blocks are loaded unevenly, so grow until the target rate is reached */
+    qint64 maxBlocks = qBound((qint64)1, maxBytes / (BLOOM_BLOCK_WORDS * 4), (qint64)0x0FFFFFFF);
+    while ( blocks < maxBlocks && estimateRate((double)count / blocks) > rate )
+    {
+        blocks += blocks / 32 + 1;
+    }
+    blocks = qMin(blocks, maxBlocks);
+
+    mBlockCount = (quint32)blocks;
+    mKeyCount = count;
+    mWords.fill(0, (int)(mBlockCount * BLOOM_BLOCK_WORDS));
+}
+
+/**
+ * /brief Insert definition
+ */
+void BloomFilter::Insert(quint64 hash)
+{
+    if (mBlockCount == 0)
+    {
+        return;
+    }
+
+    /* The upper half of the hash selects the block (multiply shift instead of a modulo) */
+    hash = mixHash(hash);
+    quint32* block = mWords.data() + (quint32)( ((hash >> 32) * mBlockCount) >> 32 ) * BLOOM_BLOCK_WORDS;
+    quint32 key = (quint32)hash;
+
+    for (int i=0; i<BLOOM_BLOCK_WORDS; i++)
+    {
+        block[i] |= 1U << ( (key * bloomSalt[i]) >> 27 );
+    }
+}
+
+/**
+ * /brief MayContain definition
+ */
+bool BloomFilter::MayContain(quint64 hash) const
+{
+    if (mBlockCount == 0)
+    {
+        return true;
+    }
+
+    hash = mixHash(hash);
+    const quint32* block = mWords.constData() + (quint32)( ((hash >> 32) * mBlockCount) >> 32 ) * BLOOM_BLOCK_WORDS;
+    quint32 key = (quint32)hash;
+
+    /* Test all words without an early exit, so the loop can be vectorized */
+    quint32 missing = 0;
+    for (int i=0; i<BLOOM_BLOCK_WORDS; i++)
+    {
+        missing |= ~block[i] & ( 1U << ( (key * bloomSalt[i]) >> 27 ) );
+    }
+
+    return ( missing == 0 );
+}
+
+/**
+ * /brief IsEmpty definition
+ */
+bool BloomFilter::IsEmpty() const
+{
+    return ( mBlockCount == 0 );
+}
+
+/**
+ * /brief SizeBytes definition
+ */
+qint64 BloomFilter::SizeBytes() const
+{
+    return (qint64)mWords.count() * 4;
+}
+
+/**
+ * /brief EstimatedFalsePositiveRate definition
+ */
+double BloomFilter::EstimatedFalsePositiveRate() const
+{
+    if (mBlockCount == 0)
+    {
+        return 1.0;
+    }
+
+    return estimateRate((double)mKeyCount / mBlockCount);
+}
@@ -0,0 +1,105 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    bloomfilter.h
+ * /author  Hackspider
+ * /brief   Header file of the blocked bloom filter
+ */
+
+/* Include Guard */
+#ifndef BLOOMFILTER_H
+#define BLOOMFILTER_H
+
+/* Necessary dependencies to Qt framework */
+#include <QVector>
+
+/* Number of 32 bit words of a block (one block is 256 bits, half a cache line) */
+#define BLOOM_BLOCK_WORDS 8
+
+/* Average number of keys per block above which every lookup is estimated as a false positive */
+#define BLOOM_SATURATED_KEYS 700.0
+
+/**
+ * /brief  The BloomFilter class declaration.
+ *
+ * Split block bloom filter: a key selects one 256 bit block by the upper half
+ * of its hash and sets exactly one bit in each of the eight 32 bit words of
+ * the block by the lower half. A lookup touches a single block and tests the
+ * eight words without branches, which the compiler turns into a few vector
+ * instructions. A negative answer is exact, a positive answer has to be
+ * confirmed by the exact lookup.
+ */
+class BloomFilter
+{
+public:
+    /**
+     * /brief  Constructor of the BloomFilter class
+     */
+    BloomFilter(void);
+
+    /**
+     * /brief  Method to size the filter for a number of keys and to clear it
+     * /param  count              Number of keys that will be inserted
+     * /param  falsePositiveRate  Target rate of false positives (e.g. 0.01)
+     * /param  maxBytes           Memory budget of the filter, wins over the target rate
+     */
+    void Reset(quint32 count, double falsePositiveRate, qint64 maxBytes);
+
+    /**
+     * /brief  Method to insert a key
+     * /param  hash  64 bit hash of the key
+     */
+    void Insert(quint64 hash);
+
+    /**
+     * /brief   Method to check if a key may have been inserted
+     * /param   hash  64 bit hash of the key
+     * /return  Returns false if the key has certainly not been inserted
+     */
+    bool MayContain(quint64 hash) const;
+
+    /**
+     * /brief   Method to check if the filter has been sized
+     * /return  Returns true if the filter has no blocks
+     */
+    bool IsEmpty(void) const;
+
+    /**
+     * /brief   Method to get the memory used by the filter
+     * /return  Returns the size of the filter in bytes
+     */
+    qint64 SizeBytes(void) const;
+
+    /**
+     * /brief   Method to estimate the false positive rate for the number of keys the filter has been sized for
+     * /return  Returns the estimated rate of false positives
+     */
+    double EstimatedFalsePositiveRate(void) const;
+
+private:
+    /**
+     * /brief Internal used variables
+     */
+    QVector<quint32> mWords;
+    quint32 mBlockCount;
+    quint32 mKeyCount;
+};
+
+#endif /* BLOOMFILTER_H */
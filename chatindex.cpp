@@ -0,0 +1,318 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    chatindex.cpp
+ * /author  Hackspider
+ * /brief   Source file of the time partitioned index of the recent chat messages
+ */
+
+/* Necessary dependencies to the standard library */
+#include <algorithm>
+
+/* Necessary internal dependencies */
+#include "chatindex.h"
+
+/**
+ * /brief  Helper to convert an ASCII letter to lower case
+ * /param  byte  Character
+ * /return Returns the lower case character
+ */
+static inline uchar lowerByte(uchar byte)
+{
+    return ( byte >= 'A' && byte <= 'Z' ) ? (uchar)(byte + ('a' - 'A')) : byte;
+}
+
+/**
+ * /brief ChatIndex definition
+ */
+ChatIndex::ChatIndex()
+{
+    mPartitions.resize(CHAT_INDEX_PARTITIONS);
+    Clear();
+}
+
+/**
+ * /brief Add definition
+ */
+void ChatIndex::Add(QLatin1String userName, QLatin1String channel, const char* data, int length, qint64 timestamp)
+{
+    if ( userName.size() == 0 || timestamp < 0 )
+    {
+        return;
+    }
+
+    qint64 number = timestamp / (CHAT_INDEX_PARTITION * 1000);
+    ChatIndexPartition& partition = mPartitions[ (int)(number % CHAT_INDEX_PARTITIONS) ];
+
+    /* Ignore messages of a minute which has been dropped already */
+    if ( partition.number > number )
+    {
+        return;
+    }
+
+    /* A new minute drops the partitions which are out of the covered time at once */
+    if ( partition.number != number )
+    {
+        for (int i=0; i<mPartitions.count(); i++)
+        {
+            ChatIndexPartition& old = mPartitions[i];
+            if ( old.number >= 0 && old.number <= number - CHAT_INDEX_PARTITIONS )
+            {
+                old.number = -1;
+                old.arena.clear();
+                old.messages.clear();
+                old.users.clear();
+                old.tokens.clear();
+            }
+        }
+
+        partition.number = number;
+    }
+
+    if ( partition.messages.count() >= CHAT_INDEX_MAX_MESSAGES )
+    {
+        return;
+    }
+
+    int index = partition.messages.count();
+
+    /* Store channel, user and text one after the other */
+    ChatIndexMessage message;
+    message.timestamp = timestamp;
+    message.offset = partition.arena.size();
+    message.channelLength = (quint16)qMin(channel.size(), 0xFFFF);
+    message.userLength = (quint16)qMin(userName.size(), 0xFFFF);
+    message.textLength = length;
+    partition.arena.append(channel.data(), message.channelLength);
+    partition.arena.append(userName.data(), message.userLength);
+    partition.arena.append(data, length);
+    partition.messages.append(message);
+
+    /* Posting list of the user, the key is only copied for a new user */
+    QByteArray user = QByteArray::fromRawData(userName.data(), userName.size());
+    QHash<QByteArray, QVector<int> >::iterator users = partition.users.find(user);
+    if ( users == partition.users.end() )
+    {
+        users = partition.users.insert(QByteArray(userName.data(), userName.size()), QVector<int>());
+    }
+    users.value().append(index);
+
+    /* Posting lists of the words, every word is listed once per message */
+    QList<QByteArray> tokens = tokenize(data, length);
+    foreach (const QByteArray& token, tokens)
+    {
+        QHash<QByteArray, QVector<int> >::iterator postings = partition.tokens.find(token);
+        if ( postings == partition.tokens.end() )
+        {
+            postings = partition.tokens.insert(QByteArray(token.constData(), token.size()), QVector<int>());
+        }
+
+        if ( postings.value().isEmpty() || postings.value().last() != index )
+        {
+            postings.value().append(index);
+        }
+    }
+}
+
+/**
+ * /brief Search definition
+ */
+QList<ChatIndexHit> ChatIndex::Search(const QString& userName, const QString& terms, qint64 since) const
+{
+    QList<ChatIndexHit> hits;
+
+    QByteArray user = userName.trimmed().toLower().toUtf8();
+    QByteArray encodedTerms = terms.toUtf8();
+    QList<QByteArray> tokens = tokenize(encodedTerms.constData(), encodedTerms.size());
+
+    if ( user.isEmpty() && tokens.isEmpty() )
+    {
+        return hits;
+    }
+
+    /* Newest partition first */
+    QVector<const ChatIndexPartition*> partitions;
+    for (int i=0; i<mPartitions.count(); i++)
+    {
+        const ChatIndexPartition& partition = mPartitions.at(i);
+        if ( partition.number >= 0 && (partition.number + 1) * CHAT_INDEX_PARTITION * 1000 > since )
+        {
+            partitions.append(&partition);
+        }
+    }
+    std::sort(partitions.begin(), partitions.end(), [](const ChatIndexPartition* a, const ChatIndexPartition* b) { return a->number > b->number; });
+
+    foreach (const ChatIndexPartition* partition, partitions)
+    {
+        /* Collect the posting lists, a missing list means no message of the minute matches */
+        QVector<const QVector<int>*> lists;
+        bool missing = false;
+
+        if ( !user.isEmpty() )
+        {
+            QHash<QByteArray, QVector<int> >::const_iterator users = partition->users.constFind(user);
+            missing |= ( users == partition->users.constEnd() );
+            if (!missing)
+            {
+                lists.append(&users.value());
+            }
+        }
+
+        foreach (const QByteArray& token, tokens)
+        {
+            QHash<QByteArray, QVector<int> >::const_iterator postings = partition->tokens.constFind(token);
+            if ( postings == partition->tokens.constEnd() )
+            {
+                missing = true;
+                break;
+            }
+            lists.append(&postings.value());
+        }
+
+        if (missing)
+        {
+            continue;
+        }
+
+        /* Walk the shortest list backwards and look the messages up in the others */
+        std::sort(lists.begin(), lists.end(), [](const QVector<int>* a, const QVector<int>* b) { return a->count() < b->count(); });
+        const QVector<int>& shortest = *lists.first();
+
+        for (int i=shortest.count()-1; i>=0; i--)
+        {
+            int index = shortest.at(i);
+
+            bool matches = true;
+            for (int l=1; l<lists.count() && matches; l++)
+            {
+                matches = std::binary_search(lists.at(l)->constBegin(), lists.at(l)->constEnd(), index);
+            }
+
+            const ChatIndexMessage& message = partition->messages.at(index);
+            if ( !matches || message.timestamp < since )
+            {
+                continue;
+            }
+
+            const char* data = partition->arena.constData() + message.offset;
+
+            ChatIndexHit hit;
+            hit.timestamp = message.timestamp;
+            hit.channel = QString::fromUtf8(data, message.channelLength);
+            hit.userName = QString::fromUtf8(data + message.channelLength, message.userLength);
+            hit.text = QString::fromUtf8(data + message.channelLength + message.userLength, message.textLength);
+            hits.append(hit);
+
+            if ( hits.count() >= CHAT_INDEX_MAX_HITS )
+            {
+                return hits;
+            }
+        }
+    }
+
+    return hits;
+}
+
+/**
+ * /brief Count definition
+ */
+int ChatIndex::Count() const
+{
+    int count = 0;
+
+    for (int i=0; i<mPartitions.count(); i++)
+    {
+        count += mPartitions.at(i).messages.count();
+    }
+
+    return count;
+}
+
+/**
+ * /brief Clear definition
+ */
+void ChatIndex::Clear()
+{
+    for (int i=0; i<mPartitions.count(); i++)
+    {
+        ChatIndexPartition& partition = mPartitions[i];
+        partition.number = -1;
+        partition.arena.clear();
+        partition.messages.clear();
+        partition.users.clear();
+        partition.tokens.clear();
+    }
+}
+
+/**
+ * /brief tokenize definition
+ */
+QList<QByteArray> ChatIndex::tokenize(const char* data, int length)
+{
+    QList<QByteArray> tokens;
+    int start = -1;
+    bool upper = false;
+
+    /* Letters, digits and all bytes of non ASCII characters form words */
+    for (int i=0; i<=length; i++)
+    {
+        unsigned char byte = (i < length) ? (unsigned char)data[i] : 0;
+        bool word = ( byte >= 'a' && byte <= 'z' ) || ( byte >= '0' && byte <= '9' ) || ( byte >= 'A' && byte <= 'Z' ) || byte >= 0x80;
+
+        if (word)
+        {
+            if (start < 0)
+            {
+                start = i;
+                upper = false;
+            }
+            upper |= ( byte >= 'A' && byte <= 'Z' );
+            continue;
+        }
+
+        if (start < 0)
+        {
+            continue;
+        }
+
+        /* Single characters are not indexed */
+        int size = qMin(i - start, CHAT_INDEX_TOKEN_LENGTH);
+        if ( size > 1 )
+        {
+            if (upper)
+            {
+                /* Only ASCII letters are folded, QByteArray::toLower() treats the bytes as Latin-1 and breaks utf-8 */
+                QByteArray token(data + start, size);
+                for (int j=0; j<size; j++)
+                {
+                    token[j] = (char)lowerByte((uchar)token.at(j));
+                }
+                tokens.append(token);
+            }
+            else
+            {
+                tokens.append( QByteArray::fromRawData(data + start, size) );
+            }
+        }
+        start = -1;
+    }
+
+    return tokens;
+}
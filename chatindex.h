@@ -0,0 +1,144 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    chatindex.h
+ * /author  Hackspider
+ * /brief   Header file of the time partitioned index of the recent chat messages
+ */
+
+/* Include Guard */
+#ifndef CHATINDEX_H
+#define CHATINDEX_H
+
+/* Necessary dependencies to Qt framework */
+#include <QByteArray>
+#include <QHash>
+#include <QList>
+#include <QString>
+#include <QVector>
+
+/* Length of a partition in seconds */
+#define CHAT_INDEX_PARTITION 60
+
+/* Number of partitions, the index covers the last (CHAT_INDEX_PARTITIONS - 1) minutes at least */
+#define CHAT_INDEX_PARTITIONS 31
+
+/* Maximum number of messages of a partition, further messages of the minute are not indexed */
+#define CHAT_INDEX_MAX_MESSAGES 200000
+
+/* Maximum number of hits of a search */
+#define CHAT_INDEX_MAX_HITS 1000
+
+/* Maximum length of an indexed token, longer tokens are cut */
+#define CHAT_INDEX_TOKEN_LENGTH 32
+
+/* Type of an indexed message, channel, user and text are stored one after the other in the arena */
+typedef struct
+{
+    qint64 timestamp;
+    int offset;
+    quint16 channelLength;
+    quint16 userLength;
+    int textLength;
+} ChatIndexMessage;
+
+/* Type of a partition with the messages of one minute */
+typedef struct
+{
+    qint64 number;
+    QByteArray arena;
+    QVector<ChatIndexMessage> messages;
+    QHash<QByteArray, QVector<int> > users;
+    QHash<QByteArray, QVector<int> > tokens;
+} ChatIndexPartition;
+
+/* Type of a message found by a search */
+typedef struct
+{
+    qint64 timestamp;
+    QString channel;
+    QString userName;
+    QString text;
+} ChatIndexHit;
+
+/**
+ * /brief  The ChatIndex class declaration.
+ *
+ * Indexes every chat message by its author and by the words of its text.
+ * The messages of every minute go into their own partition with its own
+ * posting lists (message numbers in ascending order), so a search only
+ * intersects the posting lists of the asked user and words per partition.
+ * The partitions are kept in a ring: a new minute reuses the partition of
+ * the oldest minute, which drops all its messages at once.
+ */
+class ChatIndex
+{
+public:
+    /**
+     * /brief  Constructor of the ChatIndex class
+     */
+    ChatIndex(void);
+
+    /**
+     * /brief  Method to index a chat message
+     * /param  userName   Author of the message
+     * /param  channel    Channel of the message
+     * /param  data       Pointer to the utf-8 text of the message
+     * /param  length     Length of the text
+     * /param  timestamp  Time of the message in milliseconds since epoch
+     */
+    void Add(QLatin1String userName, QLatin1String channel, const char* data, int length, qint64 timestamp);
+
+    /**
+     * /brief   Method to search the indexed messages
+     * /param   userName  Author of the messages (case insensitive), empty for all authors
+     * /param   terms     Words which all have to occur in a message (case insensitive for ASCII), empty for all messages
+     * /param   since     Time of the oldest message in milliseconds since epoch
+     * /return  Returns up to CHAT_INDEX_MAX_HITS messages, the newest first (empty if neither user nor words are given)
+     */
+    QList<ChatIndexHit> Search(const QString& userName, const QString& terms, qint64 since) const;
+
+    /**
+     * /brief   Method to get the number of indexed messages
+     * /return  Returns the number of messages of all partitions
+     */
+    int Count(void) const;
+
+    /**
+     * /brief  Method to drop all messages
+     */
+    void Clear(void);
+
+private:
+    /**
+     * /brief   Internally used method to split a text into lower case words
+     * /param   data    Pointer to the utf-8 text
+     * /param   length  Length of the text
+     * /return  Returns the words (pointing into the text if they are lower case already)
+     */
+    static QList<QByteArray> tokenize(const char* data, int length);
+
+    /**
+     * /brief Internal used variables
+     */
+    QVector<ChatIndexPartition> mPartitions;
+};
+
+#endif /* CHATINDEX_H */
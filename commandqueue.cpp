@@ -0,0 +1,352 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    commandqueue.cpp
+ * /author  Hackspider
+ * /brief   Source file of the rate adaptive queue of moderation commands
+ */
+
+/* Necessary internal dependencies */
+#include "commandqueue.h"
+
+/**
+ * /brief CommandQueue definition
+ */
+CommandQueue::CommandQueue()
+    : mInFlightCount(0),
+    mRate(COMMAND_INITIAL_RATE),
+    mTokens(COMMAND_BURST),
+    mLastRefill(0),
+    mSent(0),
+    mAcknowledged(0),
+    mRateLimited(0),
+    mRetried(0),
+    mFailed(0)
+{
+    /* Nothing to do here */
+}
+
+/**
+ * /brief Add definition
+ */
+void CommandQueue::Add(const QSet<QString>& channels, const QString& command, const QString& userName)
+{
+    foreach (const QString& channel, channels)
+    {
+        QueuedCommand queued;
+        queued.channel = channel;
+        queued.command = command;
+        queued.userName = userName;
+        queued.attempts = 0;
+        queued.sentAt = 0;
+
+        /* A command which is already pending is not queued twice */
+        QString queuedKey = key(queued);
+        if ( mPendingKeys.contains(queuedKey) )
+        {
+            continue;
+        }
+
+        mPendingKeys.insert(queuedKey);
+        mPending.append(queued);
+    }
+}
+
+/**
+ * /brief Take definition
+ */
+QByteArray CommandQueue::Take(qint64 now, const QSet<QString>& channels, QList<QueuedCommand>* failed)
+{
+    refill(now);
+
+    /* Commands without answer are sent again, the oldest command of a channel expires first */
+    QHash<QString, QQueue<QueuedCommand> >::iterator channel = mInFlight.begin();
+    while ( channel != mInFlight.end() )
+    {
+        QQueue<QueuedCommand>& queue = channel.value();
+        while ( !queue.isEmpty() && queue.head().sentAt <= now - COMMAND_ACK_TIMEOUT )
+        {
+            QueuedCommand expired = queue.dequeue();
+            mInFlightCount--;
+            expired.attempts++;
+
+            if ( expired.attempts >= COMMAND_MAX_ATTEMPTS )
+            {
+                /* Give the command up */
+                mFailed++;
+                failed->append(expired);
+            }
+            else if ( !mPendingKeys.contains(key(expired)) )
+            {
+                mRetried++;
+                mPendingKeys.insert(key(expired));
+                mPending.prepend(expired);
+            }
+        }
+
+        if ( queue.isEmpty() )
+        {
+            channel = mInFlight.erase(channel);
+        }
+        else
+        {
+            ++channel;
+        }
+    }
+
+    /* Send the pending commands in order as long as there are tokens */
+    QByteArray encoded;
+    QList<QueuedCommand>::iterator pending = mPending.begin();
+    while ( pending != mPending.end() && mTokens >= 1.0 )
+    {
+        /* Commands of channels which aren't joined or are backed off wait */
+        QHash<QString, CommandBackoff>::const_iterator backoff = mBackoff.constFind(pending->channel);
+        if ( !channels.contains(pending->channel) ||
+             ( backoff != mBackoff.constEnd() && backoff.value().notBefore > now ) )
+        {
+            ++pending;
+            continue;
+        }
+
+        encoded.append("PRIVMSG #");
+        encoded.append(pending->channel.toUtf8());
+        encoded.append(" :");
+        encoded.append(pending->command.toUtf8());
+        encoded.append(' ');
+        encoded.append(pending->userName.toUtf8());
+        encoded.append("\r\n");
+
+        /* Wait for the answer */
+        pending->sentAt = now;
+        mInFlight[pending->channel].enqueue(*pending);
+        mInFlightCount++;
+        mPendingKeys.remove(key(*pending));
+        pending = mPending.erase(pending);
+
+        mTokens -= 1.0;
+        mSent++;
+    }
+
+    return encoded;
+}
+
+/**
+ * /brief Answer definition
+ */
+CommandResult CommandQueue::Answer(QLatin1String channel, QLatin1String msgId, qint64 now, QueuedCommand* command)
+{
+    CommandResult result = Classify(msgId);
+    if ( result == COMMAND_UNRELATED )
+    {
+        return COMMAND_UNRELATED;
+    }
+
+    /* The answer belongs to the oldest unanswered command of the channel */
+    QString channelName(channel);
+    QHash<QString, QQueue<QueuedCommand> >::iterator queue = mInFlight.find(channelName);
+    if ( queue == mInFlight.end() )
+    {
+        return COMMAND_UNRELATED;
+    }
+
+    QueuedCommand answered = queue.value().dequeue();
+    mInFlightCount--;
+    if ( queue.value().isEmpty() )
+    {
+        mInFlight.erase(queue);
+    }
+
+    if ( command != nullptr )
+    {
+        *command = answered;
+    }
+
+    if ( result == COMMAND_ACKNOWLEDGED )
+    {
+        /* Additive increase, about COMMAND_RATE_INCREASE per second at the current rate */
+        mAcknowledged++;
+        mRate = qMin(COMMAND_MAX_RATE, mRate + COMMAND_RATE_INCREASE / mRate);
+        mBackoff.remove(channelName);
+    }
+    else if ( result == COMMAND_RATE_LIMITED )
+    {
+        /* Multiplicative decrease and no burst until the bucket has been refilled */
+        mRateLimited++;
+        mRate = qMax(COMMAND_MIN_RATE, mRate / 2.0);
+        mTokens = 0.0;
+
+        /* Back the channel off exponentially */
+        CommandBackoff& backoff = mBackoff[channelName];
+        backoff.backoff = (backoff.backoff > 0) ? qMin((qint64)COMMAND_MAX_BACKOFF, backoff.backoff * 2) : COMMAND_INITIAL_BACKOFF;
+        backoff.notBefore = now + backoff.backoff;
+
+        /* The command hasn't been executed, send it again first */
+        if ( !mPendingKeys.contains(key(answered)) )
+        {
+            mRetried++;
+            mPendingKeys.insert(key(answered));
+            mPending.prepend(answered);
+        }
+    }
+    else
+    {
+        mFailed++;
+    }
+
+    return result;
+}
+
+/**
+ * /brief Requeue definition
+ */
+void CommandQueue::Requeue()
+{
+    /* The answers of the lost connection will never arrive, keep the order of the channels */
+    QList<QueuedCommand> unanswered;
+    foreach (const QQueue<QueuedCommand>& queue, mInFlight)
+    {
+        foreach (const QueuedCommand& command, queue)
+        {
+            if ( !mPendingKeys.contains(key(command)) )
+            {
+                mPendingKeys.insert(key(command));
+                unanswered.append(command);
+            }
+        }
+    }
+
+    mRetried += unanswered.count();
+    mPending = unanswered + mPending;
+    mInFlight.clear();
+    mInFlightCount = 0;
+}
+
+/**
+ * /brief RemoveChannel definition
+ */
+QList<QueuedCommand> CommandQueue::RemoveChannel(const QString& channel)
+{
+    QList<QueuedCommand> removed = mInFlight.take(channel);
+    mInFlightCount -= removed.count();
+    mBackoff.remove(channel);
+
+    QList<QueuedCommand>::iterator pending = mPending.begin();
+    while ( pending != mPending.end() )
+    {
+        if ( pending->channel == channel )
+        {
+            mPendingKeys.remove(key(*pending));
+            removed.append(*pending);
+            pending = mPending.erase(pending);
+        }
+        else
+        {
+            ++pending;
+        }
+    }
+
+    return removed;
+}
+
+/**
+ * /brief TakeAll definition
+ */
+QList<QueuedCommand> CommandQueue::TakeAll()
+{
+    /* The answers of the unanswered commands are not awaited anymore */
+    Requeue();
+
+    QList<QueuedCommand> taken = mPending;
+    mPending.clear();
+    mPendingKeys.clear();
+    mBackoff.clear();
+
+    return taken;
+}
+
+/**
+ * /brief IsEmpty definition
+ */
+bool CommandQueue::IsEmpty() const
+{
+    return mPending.isEmpty() && mInFlightCount == 0;
+}
+
+/**
+ * /brief Metrics definition
+ */
+CommandQueueMetrics CommandQueue::Metrics() const
+{
+    CommandQueueMetrics metrics;
+    metrics.pending = mPending.count();
+    metrics.inFlight = mInFlightCount;
+    metrics.rate = mRate;
+    metrics.sent = mSent;
+    metrics.acknowledged = mAcknowledged;
+    metrics.rateLimited = mRateLimited;
+    metrics.retried = mRetried;
+    metrics.failed = mFailed;
+
+    return metrics;
+}
+
+/**
+ * /brief Classify definition
+ */
+CommandResult CommandQueue::Classify(QLatin1String msgId)
+{
+    const QByteArray id = QByteArray::fromRawData(msgId.data(), msgId.size());
+
+    if ( id == "msg_ratelimit" )
+    {
+        return COMMAND_RATE_LIMITED;
+    }
+
+    /* e.g. ban_success, already_banned or bad_unban_no_ban, the channel is in the requested state */
+    if ( id.endsWith("_success") || id.startsWith("already_") || id == "bad_unban_no_ban" )
+    {
+        return COMMAND_ACKNOWLEDGED;
+    }
+
+    /* e.g. no_permission, bad_ban_mod or usage_ban, sending the command again won't help */
+    if ( id.startsWith("bad_") || id.startsWith("usage_") || id == "no_permission" || id == "msg_channel_suspended" )
+    {
+        return COMMAND_REJECTED;
+    }
+
+    return COMMAND_UNRELATED;
+}
+
+/**
+ * /brief refill definition
+ */
+void CommandQueue::refill(qint64 now)
+{
+    mTokens = qMin((double)COMMAND_BURST, mTokens + mRate * (now - mLastRefill) / 1000.0);
+    mLastRefill = now;
+}
+
+/**
+ * /brief key definition
+ */
+QString CommandQueue::key(const QueuedCommand& command)
+{
+    return command.channel + ' ' + command.command + ' ' + command.userName;
+}
@@ -0,0 +1,218 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    commandqueue.h
+ * /author  Hackspider
+ * /brief   Header file of the rate adaptive queue of moderation commands
+ */
+
+/* Include Guard */
+#ifndef COMMANDQUEUE_H
+#define COMMANDQUEUE_H
+
+/* Necessary dependencies to Qt framework */
+#include <QByteArray>
+#include <QHash>
+#include <QQueue>
+#include <QSet>
+#include <QStringList>
+
+/* Initial send rate in commands per second (below the moderator limit of 100 commands per 30 seconds) */
+#define COMMAND_INITIAL_RATE 3.0
+
+/* Bounds of the learned send rate in commands per second */
+#define COMMAND_MIN_RATE 0.5
+#define COMMAND_MAX_RATE 250.0
+
+/* Additive increase of the send rate in commands per second for every second of acknowledged commands */
+#define COMMAND_RATE_INCREASE 0.5
+
+/* Number of commands which may be sent at once after an idle time */
+#define COMMAND_BURST 20
+
+/* Initial and maximum backoff of a channel in milliseconds after a rate limit notice */
+#define COMMAND_INITIAL_BACKOFF 1000
+#define COMMAND_MAX_BACKOFF 60000
+
+/* Time in milliseconds after which an unacknowledged command is sent again */
+#define COMMAND_ACK_TIMEOUT 10000
+
+/* Number of attempts before a command is given up */
+#define COMMAND_MAX_ATTEMPTS 5
+
+/* Interval in milliseconds the queue is pumped while commands are pending */
+#define COMMAND_PUMP_INTERVAL 50
+
+/* Type to distinguish the answers of the twitch service to a command */
+typedef enum
+{
+    COMMAND_UNRELATED = 0,
+    COMMAND_ACKNOWLEDGED,
+    COMMAND_RATE_LIMITED,
+    COMMAND_REJECTED,
+} CommandResult;
+
+/* Type of a queued moderation command */
+typedef struct
+{
+    QString channel;
+    QString command;
+    QString userName;
+    int attempts;
+    qint64 sentAt;
+} QueuedCommand;
+
+/* Type of the backoff state of a channel */
+typedef struct
+{
+    qint64 notBefore;
+    qint64 backoff;
+} CommandBackoff;
+
+/* Type of the counters of the command queue */
+typedef struct
+{
+    int pending;
+    int inFlight;
+    double rate;
+    qint64 sent;
+    qint64 acknowledged;
+    qint64 rateLimited;
+    qint64 retried;
+    qint64 failed;
+} CommandQueueMetrics;
+
+/**
+ * /brief  The CommandQueue class declaration.
+ *
+ * Keeps every moderation command until the twitch service has acknowledged
+ * it. The commands are sent with a token bucket whose rate is learned from the
+ * answers (AIMD): every acknowledged command increases the rate a little,
+ * every rate limit notice halves it, empties the bucket and backs the channel
+ * off exponentially. The twitch service answers the commands of a channel in
+ * order, so an answer always belongs to the oldest unanswered command of its
+ * channel. Unanswered commands are sent again after COMMAND_ACK_TIMEOUT and
+ * after a reconnect, a command is given up after COMMAND_MAX_ATTEMPTS.
+ */
+class CommandQueue
+{
+public:
+    /**
+     * /brief  Constructor of the CommandQueue class
+     */
+    CommandQueue(void);
+
+    /**
+     * /brief  Method to queue a command for a set of channels (a command which is already pending is not queued twice)
+     * /param  channels  Set of channels the command shall be sent to
+     * /param  command   Moderation command (e.g. ".ban")
+     * /param  userName  Name of the user the command applies to
+     */
+    void Add(const QSet<QString>& channels, const QString& command, const QString& userName);
+
+    /**
+     * /brief   Method to take the commands which may be sent now
+     * /param   now       Monotonic time in milliseconds
+     * /param   channels  Set of joined channels (commands of other channels wait for the join)
+     * /param   failed    Returns the commands which have been given up
+     * /return  Returns the raw commands ready to be written to the tcp socket
+     */
+    QByteArray Take(qint64 now, const QSet<QString>& channels, QList<QueuedCommand>* failed);
+
+    /**
+     * /brief   Method to apply an answer (NOTICE) of the twitch service to the oldest unanswered command of a channel
+     * /param   channel  Channel of the answer
+     * /param   msgId    Value of the msg-id tag of the answer
+     * /param   now      Monotonic time in milliseconds
+     * /param   command  Returns the answered command (may be nullptr)
+     * /return  Returns the kind of the answer, COMMAND_UNRELATED if it doesn't answer a command
+     */
+    CommandResult Answer(QLatin1String channel, QLatin1String msgId, qint64 now, QueuedCommand* command);
+
+    /**
+     * /brief  Method to queue all unanswered commands again (e.g. after the connection has been lost)
+     */
+    void Requeue(void);
+
+    /**
+     * /brief   Method to remove all commands of a channel (e.g. after it has been removed)
+     * /param   channel  Name of the channel
+     * /return  Returns the removed commands
+     */
+    QList<QueuedCommand> RemoveChannel(const QString& channel);
+
+    /**
+     * /brief   Method to remove all pending and unanswered commands (e.g. to pass them to another connection)
+     * /return  Returns the removed commands, the unanswered ones first
+     */
+    QList<QueuedCommand> TakeAll(void);
+
+    /**
+     * /brief   Method to check if there is any pending or unanswered command
+     * /return  Returns true if there is no command
+     */
+    bool IsEmpty(void) const;
+
+    /**
+     * /brief   Method to get the counters of the queue
+     * /return  Returns the counters
+     */
+    CommandQueueMetrics Metrics(void) const;
+
+    /**
+     * /brief   Method to classify the msg-id of an answer of the twitch service
+     * /param   msgId  Value of the msg-id tag
+     * /return  Returns the kind of the answer
+     */
+    static CommandResult Classify(QLatin1String msgId);
+
+private:
+    /**
+     * /brief  Internally used method to refill the token bucket
+     * /param  now  Monotonic time in milliseconds
+     */
+    void refill(qint64 now);
+
+    /**
+     * /brief   Internally used method to build the key of a pending command
+     * /param   command  Queued command
+     * /return  Returns the key
+     */
+    static QString key(const QueuedCommand& command);
+
+    /**
+     * /brief Internal used variables
+     */
+    QList<QueuedCommand> mPending;
+    QSet<QString> mPendingKeys;
+    QHash<QString, QQueue<QueuedCommand> > mInFlight;
+    QHash<QString, CommandBackoff> mBackoff;
+    int mInFlightCount;
+    double mRate;
+    double mTokens;
+    qint64 mLastRefill;
+    qint64 mSent;
+    qint64 mAcknowledged;
+    qint64 mRateLimited;
+    qint64 mRetried;
+    qint64 mFailed;
+};
+
+#endif /* COMMANDQUEUE_H */
@@ -0,0 +1,24 @@
+#-------------------------------------------------
+#
+# Headless daemon which holds the twitch connection without any ui
+#
+#-------------------------------------------------
+
+QT       += core network
+QT       -= gui
+
+TARGET = Lpz3ncLittleHelperd
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+include(../twitchcore.pri)
+
+SOURCES += \
+    main.cpp \
+    headlesscontroller.cpp
+
+HEADERS += \
+    headlesscontroller.h
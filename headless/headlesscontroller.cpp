@@ -0,0 +1,518 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    headlesscontroller.cpp
+ * /author  Hackspider
+ * /brief   Source file of the control interface of the headless daemon
+ */
+
+/* Necessary dependencies to Qt framework */
+#include <QStringList>
+#include <QDebug>
+#include <QDateTime>
+
+/* Necessary internal dependencies */
+#include "headlesscontroller.h"
+
+/* Time in milliseconds before the first reconnect attempt, doubled after every failed attempt up to the maximum */
+#define RECONNECT_INTERVAL 5000
+#define RECONNECT_MAX_INTERVAL 300000
+
+/* Names of the connection states for the log and the answers */
+static const char* stateNames[] = { "DISCONNECTED", "CONNECTING", "CONNECTED" };
+
+/**
+ * /brief HeadlessController definition
+ */
+HeadlessController::HeadlessController(TwitchConnector* connector, QSet<QString> channels, StallWatchdog* watchdog, QObject *parent)
+    : QObject(parent),
+    mConnector(connector),
+    mWatchdog(watchdog),
+    mServer(nullptr),
+    mReconnectTimer(nullptr),
+    mReconnectInterval(RECONNECT_INTERVAL),
+    mChannels(channels),
+    mHoldConnection(true)
+{
+    /* Create the local server for the control clients */
+    mServer = new QLocalServer(this);
+    connect(mServer, SIGNAL(newConnection()), this, SLOT(newConnection()));
+
+    /* Create the reconnect timer */
+    mReconnectTimer = new QTimer(this);
+    mReconnectTimer->setInterval(RECONNECT_INTERVAL);
+    mReconnectTimer->setSingleShot(true);
+    connect(mReconnectTimer, SIGNAL(timeout()), this, SLOT(reconnectTimer()));
+
+    /* Keep track of the connection state to hold the connection */
+    connect(mConnector, SIGNAL(stateChanged(ConnectionState)), this, SLOT(stateChanged(ConnectionState)));
+    connect(mConnector, SIGNAL(loginFailed(QString)), this, SLOT(loginFailed(QString)));
+
+    /* Log all keyword hits */
+    connect(mConnector, SIGNAL(keywordMatched(QString,QString,QString,QString)), this, SLOT(keywordMatched(QString,QString,QString,QString)));
+
+    /* Log all spam waves */
+    connect(mConnector, SIGNAL(spamWaveDetected(QString,QSet<QString>,QString)), this, SLOT(spamWaveDetected(QString,QSet<QString>,QString)));
+
+    /* Log all users exceeding the message rate limits */
+    connect(mConnector, SIGNAL(rateExceeded(QString,QString,int,int,QString)), this, SLOT(rateExceeded(QString,QString,int,int,QString)));
+
+    /* Log all raids */
+    connect(mConnector, SIGNAL(raidDetected(QString,QStringList,int,double)), this, SLOT(raidDetected(QString,QStringList,int,double)));
+
+    /* Log all moderation commands which have been given up */
+    connect(mConnector, SIGNAL(commandFailed(QString,QString,QString,QString)), this, SLOT(commandFailed(QString,QString,QString,QString)));
+
+    /* Log the fail over to the standby connection */
+    connect(mConnector, SIGNAL(failedOver(int)), this, SLOT(failedOver(int)));
+
+    /* Log all channels without moderator permission */
+    connect(mConnector, SIGNAL(moderatorChanged(QString,bool)), this, SLOT(moderatorChanged(QString,bool)));
+
+    /* Log all users on the banlist */
+    connect(mConnector, SIGNAL(banListMatched(QString,QString)), this, SLOT(banListMatched(QString,QString)));
+    connect(mConnector, SIGNAL(banListLoaded(QString,int,qint64,double)), this, SLOT(banListLoaded(QString,int,qint64,double)));
+
+    /* Log all users matching a username pattern */
+    connect(mConnector, SIGNAL(usernamePatternMatched(QString,QString,QString)), this, SLOT(usernamePatternMatched(QString,QString,QString)));
+    connect(mConnector, SIGNAL(usernamePatternsLoaded(QString,int,QString)), this, SLOT(usernamePatternsLoaded(QString,int,QString)));
+
+    /* Pass the channels to the connector and connect immediately */
+    mConnector->SetChannels(mChannels);
+    mConnector->Connect();
+}
+
+/**
+ * /brief ~HeadlessController definition
+ */
+HeadlessController::~HeadlessController()
+{
+    /* All objects are deleted by Qt's object tree */
+}
+
+/**
+ * /brief Listen definition
+ */
+bool HeadlessController::Listen(QString name)
+{
+    /* Remove a stale socket of a crashed daemon */
+    QLocalServer::removeServer(name);
+
+    if ( !mServer->listen(name) )
+    {
+        qWarning().noquote() << "Failed to listen on control socket" << name << ":" << mServer->errorString();
+        return false;
+    }
+
+    qInfo().noquote() << "Control socket listening on" << mServer->fullServerName();
+    return true;
+}
+
+/**
+ * /brief newConnection definition
+ */
+void HeadlessController::newConnection()
+{
+    /* Accept all pending clients */
+    while (mServer->hasPendingConnections())
+    {
+        QLocalSocket* socket = mServer->nextPendingConnection();
+        connect(socket, SIGNAL(readyRead()),    this,   SLOT(readyRead()));
+        connect(socket, SIGNAL(disconnected()), socket, SLOT(deleteLater()));
+    }
+}
+
+/**
+ * /brief readyRead definition
+ */
+void HeadlessController::readyRead()
+{
+    QLocalSocket* socket = qobject_cast<QLocalSocket*>(sender());
+    if (socket == nullptr)
+    {
+        return;
+    }
+
+    /* Execute every complete command line and answer it */
+    while (socket->canReadLine())
+    {
+        QString command = QString::fromUtf8(socket->readLine()).trimmed();
+        if ( !command.isEmpty() )
+        {
+            socket->write(execute(command));
+        }
+    }
+}
+
+/**
+ * /brief stateChanged definition
+ */
+void HeadlessController::stateChanged(ConnectionState state)
+{
+    qInfo().noquote() << "Connection state" << stateNames[state];
+
+    /* A working connection starts the backoff over */
+    if (state == CONNECTED)
+    {
+        mReconnectInterval = RECONNECT_INTERVAL;
+    }
+
+    /* Reconnect after a lost connection unless a disconnect was requested, every failed attempt waits twice as long */
+    if (state == DISCONNECTED && mHoldConnection && !mReconnectTimer->isActive())
+    {
+        qInfo().noquote() << "Reconnecting in" << mReconnectInterval / 1000 << "s";
+        mReconnectTimer->start(mReconnectInterval);
+        mReconnectInterval = qMin(mReconnectInterval * 2, RECONNECT_MAX_INTERVAL);
+    }
+}
+
+/**
+ * /brief loginFailed definition
+ */
+void HeadlessController::loginFailed(QString reason)
+{
+    qWarning().noquote() << "Login failed:" << reason << "- not reconnecting, fix the credentials and send connect";
+
+    /* The same credentials would be rejected again */
+    mHoldConnection = false;
+    mReconnectTimer->stop();
+}
+
+/**
+ * /brief keywordMatched definition
+ */
+void HeadlessController::keywordMatched(QString channel, QString userName, QString term, QString message)
+{
+    qInfo().noquote() << "Keyword" << term << "by" << userName << "in" << channel << ":" << message;
+}
+
+/**
+ * /brief spamWaveDetected definition
+ */
+void HeadlessController::spamWaveDetected(QString userName, QSet<QString> channels, QString message)
+{
+    qInfo().noquote() << "Spam wave by" << userName << "in" << QStringList(channels.toList()).join(';') << ":" << message;
+}
+
+/**
+ * /brief rateExceeded definition
+ */
+void HeadlessController::rateExceeded(QString userName, QString channel, int shortCount, int longCount, QString message)
+{
+    qInfo().noquote() << "Rate" << shortCount << "/5s" << longCount << "/60s by" << userName << "in" << channel << ":" << message;
+}
+
+/**
+ * /brief raidDetected definition
+ */
+void HeadlessController::raidDetected(QString channel, QStringList users, int joins, double baseline)
+{
+    qInfo().noquote() << "Raid in" << channel << ":" << joins << "joins/30s, usually" << baseline << ":" << users.join(' ');
+}
+
+/**
+ * /brief banListMatched definition
+ */
+void HeadlessController::banListMatched(QString userName, QString channel)
+{
+    qInfo().noquote() << "Banlist" << userName << "in" << channel;
+}
+
+/**
+ * /brief commandFailed definition
+ */
+void HeadlessController::commandFailed(QString command, QString userName, QString channel, QString reason)
+{
+    qWarning().noquote() << "Command" << command << userName << "in" << channel << "failed:" << reason;
+}
+
+/**
+ * /brief failedOver definition
+ */
+void HeadlessController::failedOver(int channels)
+{
+    qWarning().noquote() << "Connection lost, the standby connection took over the moderation commands of" << channels << "channels";
+}
+
+/**
+ * /brief moderatorChanged definition
+ */
+void HeadlessController::moderatorChanged(QString channel, bool moderator)
+{
+    if (!moderator)
+    {
+        qWarning().noquote() << "Not a moderator in" << channel << "- no bans are sent there";
+    }
+}
+
+/**
+ * /brief banListLoaded definition
+ */
+void HeadlessController::banListLoaded(QString fileName, int count, qint64 filterBytes, double falsePositiveRate)
+{
+    if (count < 0)
+    {
+        qWarning().noquote() << "Failed to map banlist" << fileName;
+        return;
+    }
+
+    qInfo().noquote() << "Banlist" << fileName << "with" << count << "names, filter" << filterBytes << "bytes, false positive rate" << falsePositiveRate;
+}
+
+/**
+ * /brief usernamePatternMatched definition
+ */
+void HeadlessController::usernamePatternMatched(QString userName, QString channel, QString pattern)
+{
+    qInfo().noquote() << "Pattern" << pattern << "matched" << userName << "in" << channel;
+}
+
+/**
+ * /brief usernamePatternsLoaded definition
+ */
+void HeadlessController::usernamePatternsLoaded(QString fileName, int count, QString errorString)
+{
+    if (count < 0)
+    {
+        qWarning().noquote() << "Failed to compile username patterns" << fileName << ":" << errorString;
+        return;
+    }
+
+    qInfo().noquote() << "Username patterns" << fileName << "with" << count << "patterns";
+}
+
+/**
+ * /brief reconnectTimer definition
+ */
+void HeadlessController::reconnectTimer()
+{
+    if (mHoldConnection && mConnector->GetConnectionState() == DISCONNECTED)
+    {
+        mConnector->Connect();
+    }
+}
+
+/**
+ * /brief execute definition
+ */
+QByteArray HeadlessController::execute(const QString& command)
+{
+    QStringList arguments = command.split(' ', QString::SkipEmptyParts);
+    QString name = arguments.takeFirst().toLower();
+
+    if ( (name == "ban" || name == "unban") && arguments.count() == 1 )
+    {
+        QSet<QString> channels;
+        int skipped = 0;
+        if (name == "ban")
+        {
+            channels = mConnector->banUser(arguments.at(0), &skipped);
+        }
+        else
+        {
+            channels = mConnector->unbanUser(arguments.at(0), &skipped);
+        }
+
+        QStringList channelList = channels.toList();
+        channelList.sort();
+        return QString("OK %1 %2 %3 %4 skipped=%5\n").arg(name).arg(arguments.at(0)).arg(channels.count()).arg(channelList.join(';')).arg(skipped).toUtf8();
+    }
+    else if ( (name == "join" || name == "part") && arguments.count() == 1 )
+    {
+        if (name == "join")
+        {
+            mChannels.insert(arguments.at(0).toLower());
+        }
+        else
+        {
+            mChannels.remove(arguments.at(0).toLower());
+        }
+
+        mConnector->SetChannels(mChannels);
+        return QString("OK %1 %2\n").arg(name).arg(arguments.at(0).toLower()).toUtf8();
+    }
+    else if ( name == "connect" && arguments.isEmpty() )
+    {
+        mHoldConnection = true;
+        mReconnectInterval = RECONNECT_INTERVAL;
+        if (mConnector->GetConnectionState() == DISCONNECTED)
+        {
+            mConnector->Connect();
+        }
+        return "OK connect\n";
+    }
+    else if ( name == "disconnect" && arguments.isEmpty() )
+    {
+        mHoldConnection = false;
+        mReconnectTimer->stop();
+        mConnector->Disconnect();
+        return "OK disconnect\n";
+    }
+    else if ( name == "status" && arguments.isEmpty() )
+    {
+        /* Channels without moderator permission are listed after the counts */
+        QStringList unmoderated = mConnector->GetUnmoderatedChannels().toList();
+        unmoderated.sort();
+
+        return QString("OK status %1 %2/%3 unmoderated=%4 %5\n")
+                .arg(stateNames[mConnector->GetConnectionState()])
+                .arg(mConnector->GetConnectedChannels().count())
+                .arg(mChannels.count())
+                .arg(unmoderated.count())
+                .arg(unmoderated.join(';')).toUtf8();
+    }
+
+    else if ( name == "top" && arguments.count() <= 1 )
+    {
+        bool valid = true;
+        int count = arguments.isEmpty() ? 10 : arguments.at(0).toInt(&valid);
+        if ( !valid || count <= 0 )
+        {
+            return QString("ERR top %1 is no positive count\n").arg(arguments.at(0)).toUtf8();
+        }
+
+        /* List the noisiest users as <user>:<messages per 5s>/<messages per 60s> */
+        QStringList users;
+        foreach (const RateTrackerUser& user, mConnector->GetTopUsers(count))
+        {
+            users << QString("%1:%2/%3").arg(user.userName).arg(user.shortCount).arg(user.longCount);
+        }
+
+        return QString("OK top %1 %2\n").arg(users.count()).arg(users.join(';')).toUtf8();
+    }
+
+    else if ( name == "where" && arguments.count() == 1 )
+    {
+        /* List the connected channels the user is currently present in */
+        QStringList channelList = mConnector->GetUserChannels(arguments.at(0)).toList();
+        channelList.sort();
+        return QString("OK where %1 %2 %3\n").arg(arguments.at(0)).arg(channelList.count()).arg(channelList.join(';')).toUtf8();
+    }
+
+    else if ( name == "search" && arguments.count() >= 1 )
+    {
+        /* Search the last 30 minutes of chat by author (* for all authors) and words */
+        QString userName = ( arguments.at(0) == "*" ) ? QString() : arguments.at(0);
+        QString terms = arguments.mid(1).join(' ');
+
+        /* List the messages as <time> #<channel> <user>: <text>, separated by tabs */
+        QStringList hits;
+        foreach (const ChatIndexHit& hit, mConnector->SearchChat(userName, terms))
+        {
+            hits << QString("%1 #%2 %3: %4")
+                    .arg(QDateTime::fromMSecsSinceEpoch(hit.timestamp).toString("hh:mm:ss"))
+                    .arg(hit.channel)
+                    .arg(hit.userName)
+                    .arg(QString(hit.text).replace('\t', ' '));
+        }
+
+        return QString("OK search %1 %2\n").arg(hits.count()).arg(hits.join('\t')).toUtf8();
+    }
+
+    else if ( name == "banlist" && arguments.isEmpty() )
+    {
+        BanListMetrics metrics = mConnector->GetBanListMetrics();
+
+        return QString("OK banlist names=%1 filterBytes=%2 filterRate=%3 lookups=%4 filtered=%5 hits=%6\n")
+                .arg(metrics.count)
+                .arg(metrics.filterBytes)
+                .arg(metrics.filterRate)
+                .arg(metrics.lookups)
+                .arg(metrics.filtered)
+                .arg(metrics.hits).toUtf8();
+    }
+
+    else if ( name == "trace" && arguments.count() >= 1 && arguments.count() <= 2 )
+    {
+        /* Switch the recording of the trace spans */
+        if ( arguments.at(0) == "on" || arguments.at(0) == "off" )
+        {
+            Tracer::SetEnabled( arguments.at(0) == "on" );
+            return QString("OK trace %1\n").arg(arguments.at(0)).toUtf8();
+        }
+
+        /* Write the spans of the last seconds as Chrome trace */
+        int seconds = (arguments.count() > 1) ? arguments.at(1).toInt() : TRACE_DEFAULT_SECONDS;
+        int count = Tracer::WriteChromeTrace(arguments.at(0), seconds);
+        if (count < 0)
+        {
+            return QString("ERR trace %1 can't be written\n").arg(arguments.at(0)).toUtf8();
+        }
+        return QString("OK trace %1 %2\n").arg(arguments.at(0)).arg(count).toUtf8();
+    }
+
+    else if ( name == "queue" && arguments.isEmpty() )
+    {
+        CommandQueueMetrics metrics = mConnector->GetCommandQueueMetrics();
+
+        return QString("OK queue pending=%1 inFlight=%2 rate=%3 sent=%4 acknowledged=%5 rateLimited=%6 retried=%7 failed=%8\n")
+                .arg(metrics.pending)
+                .arg(metrics.inFlight)
+                .arg(metrics.rate, 0, 'f', 2)
+                .arg(metrics.sent)
+                .arg(metrics.acknowledged)
+                .arg(metrics.rateLimited)
+                .arg(metrics.retried)
+                .arg(metrics.failed).toUtf8();
+    }
+
+    else if ( name == "accounts" && arguments.isEmpty() )
+    {
+        /* One entry per account, this connection first */
+        QList<AccountMetrics> accounts = mConnector->GetAccountMetrics();
+        QStringList entries;
+        foreach (const AccountMetrics& account, accounts)
+        {
+            entries << QString("%1:%2:rate=%3:pending=%4:inFlight=%5:unmoderated=%6")
+                       .arg(account.loginName)
+                       .arg(stateNames[account.state])
+                       .arg(account.queue.rate, 0, 'f', 2)
+                       .arg(account.queue.pending)
+                       .arg(account.queue.inFlight)
+                       .arg(account.unmoderated);
+        }
+
+        return QString("OK accounts %1 %2 standby=%3\n")
+                .arg(entries.count())
+                .arg(entries.join(' '))
+                .arg(stateNames[mConnector->GetStandbyState()]).toUtf8();
+    }
+
+    else if ( name == "trafficlog" && arguments.isEmpty() )
+    {
+        TrafficLogMetrics metrics = mConnector->GetTrafficLogMetrics();
+
+        return QString("OK trafficlog records=%1 bytes=%2 dropped=%3 droppedBytes=%4 files=%5\n")
+                .arg(metrics.records)
+                .arg(metrics.bytes)
+                .arg(metrics.droppedRecords)
+                .arg(metrics.droppedBytes)
+                .arg(metrics.files).toUtf8();
+    }
+
+    else if ( name == "stalls" && arguments.isEmpty() )
+    {
+        /* Report the histogram and the top offenders on a single line, separated by tabs */
+        QString report = mWatchdog->Report();
+        return QString("OK stalls %1\n").arg(report.replace('\n', '\t')).toUtf8();
+    }
+
+    return "ERR unknown command\n";
+}
@@ -0,0 +1,210 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    headlesscontroller.h
+ * /author  Hackspider
+ * /brief   Header file of the control interface of the headless daemon
+ */
+
+/* Include Guard */
+#ifndef HEADLESSCONTROLLER_H
+#define HEADLESSCONTROLLER_H
+
+/* Necessary dependencies to Qt framework */
+#include <QObject>
+#include <QLocalServer>
+#include <QLocalSocket>
+#include <QTimer>
+
+/* Necessary internal dependencies */
+#include "twitchconnector.h"
+
+/**
+ * /brief  The HeadlessController class declaration. Derived from QObject class.
+ *
+ * Accepts clients on a local socket and executes one command per line:
+ * "ban <user>", "unban <user>", "join <channel>", "part <channel>",
+ * "connect", "disconnect", "status", "top [count]" and "banlist". Every command is answered with a
+ * single line starting with "OK" or "ERR".
+ */
+class HeadlessController : public QObject
+{
+    Q_OBJECT
+public:
+    /**
+     * /brief  Constructor of the HeadlessController class
+     * /param  connector  Pointer to the twitch connector
+     * /param  channels   Channels that shall be joined
+     * /param  watchdog   Pointer to the stall watchdog of the event loop
+     * /param  parent     Parent of the HeadlessController object according to Qt's object tree
+     */
+    explicit HeadlessController(TwitchConnector* connector, QSet<QString> channels, StallWatchdog* watchdog, QObject *parent = nullptr);
+
+    /**
+     * /brief  Destructor of the HeadlessController class
+     */
+    virtual ~HeadlessController(void);
+
+    /**
+     * /brief   Method to start listening for control clients
+     * /param   name  Name of the local socket
+     * /return  Returns true if the controller listens
+     */
+    bool Listen(QString name);
+
+private slots:
+    /**
+     * /brief  Method will be called if a new control client connects
+     */
+    void newConnection(void);
+
+    /**
+     * /brief  Method will be called if a control client sends data
+     */
+    void readyRead(void);
+
+    /**
+     * /brief  Method will be called if the connection state to the twitch service changes
+     * /param  state  New connection state
+     */
+    void stateChanged(ConnectionState state);
+
+    /**
+     * /brief  Method will be called if the twitch service rejected the login, the connection is not held anymore
+     * /param  reason  Notice of the twitch service
+     */
+    void loginFailed(QString reason);
+
+    /**
+     * /brief  Method will be called if a chat message matches a term
+     * /param  channel   Channel of the message
+     * /param  userName  Author of the message
+     * /param  term      Matching term
+     * /param  message   Text of the message
+     */
+    void keywordMatched(QString channel, QString userName, QString term, QString message);
+
+    /**
+     * /brief  Method will be called if the same message has been posted in several channels
+     * /param  userName  Author of the message
+     * /param  channels  Set of channels where the message has been posted
+     * /param  message   Text of the message
+     */
+    void spamWaveDetected(QString userName, QSet<QString> channels, QString message);
+
+    /**
+     * /brief  Method will be called if a user exceeds a message rate limit
+     * /param  userName    Name of the user
+     * /param  channel     Channel of the message that exceeded the limit
+     * /param  shortCount  Number of messages within 5 seconds
+     * /param  longCount   Number of messages within 60 seconds
+     * /param  message     Text of the message that exceeded the limit
+     */
+    void rateExceeded(QString userName, QString channel, int shortCount, int longCount, QString message);
+
+    /**
+     * /brief  Method will be called if a burst of joins has been detected in a channel
+     * /param  channel   Channel of the raid
+     * /param  users     Joining users
+     * /param  joins     Number of joins within the last 30 seconds
+     * /param  baseline  Usual number of joins within 30 seconds
+     */
+    void raidDetected(QString channel, QStringList users, int joins, double baseline);
+
+    /**
+     * /brief  Method will be called if a chatter or a joining user is on the banlist
+     * /param  userName  Name of the user
+     * /param  channel   Channel where the user has been seen
+     */
+    void banListMatched(QString userName, QString channel);
+
+    /**
+     * /brief  Method will be called if the connector has given up a moderation command
+     * /param  command   Moderation command (e.g. ".ban")
+     * /param  userName  Name of the user the command applies to
+     * /param  channel   Channel of the command
+     * /param  reason    Answer of the twitch service or the reason the command has been given up
+     */
+    void commandFailed(QString command, QString userName, QString channel, QString reason);
+
+    /**
+     * /brief  Method will be called if the connection has been lost and the standby connection has taken over
+     * /param  channels  Number of channels whose moderation commands continue while they are joined again
+     */
+    void failedOver(int channels);
+
+    /**
+     * /brief  Method will be called if the connector reported our moderator status in a channel
+     * /param  channel    Name of the channel
+     * /param  moderator  True if moderation commands are permitted in the channel
+     */
+    void moderatorChanged(QString channel, bool moderator);
+
+    /**
+     * /brief  Method will be called if the connector has loaded a banlist
+     * /param  fileName           Name of the banlist file
+     * /param  count              Number of names of the banlist or -1 if the file couldn't be mapped
+     * /param  filterBytes        Memory used by the bloom filter in bytes
+     * /param  falsePositiveRate  Estimated false positive rate of the bloom filter
+     */
+    void banListLoaded(QString fileName, int count, qint64 filterBytes, double falsePositiveRate);
+
+    /**
+     * /brief  Method will be called if a chatter or a joining user matches a username pattern
+     * /param  userName  Name of the user
+     * /param  channel   Channel where the user has been seen
+     * /param  pattern   Matching pattern
+     */
+    void usernamePatternMatched(QString userName, QString channel, QString pattern);
+
+    /**
+     * /brief  Method will be called if the connector has compiled the username patterns
+     * /param  fileName     Name of the pattern file
+     * /param  count        Number of patterns or -1 if the patterns couldn't be compiled
+     * /param  errorString  Reason if the patterns couldn't be compiled
+     */
+    void usernamePatternsLoaded(QString fileName, int count, QString errorString);
+
+    /**
+     * /brief  Method will be called cyclic while the connection to the twitch service is lost
+     */
+    void reconnectTimer(void);
+
+private:
+    /**
+     * /brief   Internally used method to execute a single command
+     * /param   command  Command line of the client
+     * /return  Returns the answer to the client
+     */
+    QByteArray execute(const QString& command);
+
+    /**
+     * /brief Internal used variables
+     */
+    TwitchConnector* mConnector;
+    StallWatchdog* mWatchdog;
+    QLocalServer* mServer;
+    QTimer* mReconnectTimer;
+    int mReconnectInterval;
+    QSet<QString> mChannels;
+    bool mHoldConnection;
+};
+
+#endif /* HEADLESSCONTROLLER_H */
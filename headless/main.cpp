@@ -0,0 +1,163 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    main.cpp
+ * /author  Hackspider
+ * /brief   Source file of the headless daemon entry
+ */
+
+/* Necessary dependencies to Qt framework */
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QSettings>
+#include <QThread>
+
+/* Necessary internal dependencies */
+#include "twitchconnector.h"
+#include "headlesscontroller.h"
+
+/**
+ * /brief  Headless daemon main entry
+ */
+int main(int argc, char *argv[])
+{
+    /* Create a new QCoreApplication, no ui is needed */
+    QCoreApplication application(argc, argv);
+
+    /* Define all command line options */
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Headless daemon of Lpz3nc's Little Helper");
+    parser.addHelpOption();
+
+    QCommandLineOption configOption("config", "Configuration file shared with the ui.", "file", "config.ini");
+    QCommandLineOption controlOption("control", "Name of the local control socket.", "name", "lpz3nclittlehelper");
+    parser.addOption(configOption);
+    parser.addOption(controlOption);
+
+    parser.process(application);
+
+    /* Read the login, the server and the channels from the configuration file */
+    QSettings settings(parser.value(configOption), QSettings::IniFormat);
+
+    QString loginName = settings.value("loginName","").toString();
+    QString oauth2 = settings.value("oauth2","").toString();
+    QString serverHost = settings.value("serverHost", "irc.twitch.tv").toString();
+    quint16 serverPort = (quint16)settings.value("serverPort", 6667).toUInt();
+    QString recordFile = settings.value("recordFile", "").toString();
+
+    if ( loginName.isEmpty() || oauth2.isEmpty() )
+    {
+        qWarning().noquote() << "loginName and oauth2 must be set in" << parser.value(configOption);
+        return 1;
+    }
+
+    /* Only channels with default connect are joined */
+    QSet<QString> channels;
+    int channelCount = settings.beginReadArray("channels");
+    for (int i=0; i<channelCount; i++)
+    {
+        settings.setArrayIndex(i);
+
+        QString channel = settings.value("channelName","").toString().simplified().replace(" ","");
+        QString defaultConnect = settings.value("channelDefaultConnect","").toString().simplified().replace(" ","");
+
+        if ( !channel.isEmpty() &&
+             0 == defaultConnect.compare("true", Qt::CaseInsensitive) )
+        {
+            channels.insert(channel);
+        }
+    }
+    settings.endArray();
+
+    /* Create the connector and the control interface */
+    TwitchConnector connector(serverHost, serverPort, loginName, oauth2);
+
+    if ( !recordFile.isEmpty() )
+    {
+        connector.StartRecording(recordFile);
+    }
+
+    /* Add the further moderator accounts, the bans are spread across their rate limits */
+    int accountCount = settings.beginReadArray("accounts");
+    for (int i=0; i<accountCount; i++)
+    {
+        settings.setArrayIndex(i);
+
+        QString accountName = settings.value("loginName","").toString().simplified().replace(" ","");
+        QString accountOauth2 = settings.value("oauth2","").toString();
+        if ( !accountName.isEmpty() && !accountOauth2.isEmpty() )
+        {
+            connector.AddAccount(accountName, accountOauth2);
+        }
+    }
+    settings.endArray();
+
+    /* Keep a warm standby connection which takes over at once if the connection is lost */
+    connector.SetStandby( 0 == settings.value("standbyConnection","").toString().compare("true", Qt::CaseInsensitive) );
+
+    /* Write the audit log of the raw traffic if a log file is configured */
+    QString trafficLogFile = settings.value("trafficLogFile", "").toString();
+    if ( !trafficLogFile.isEmpty() )
+    {
+        connector.StartTrafficLog(trafficLogFile,
+                                  settings.value("trafficLogMaxBytes", TRAFFIC_LOG_DEFAULT_MAX_BYTES).toLongLong(),
+                                  settings.value("trafficLogInterval", TRAFFIC_LOG_DEFAULT_INTERVAL).toInt(),
+                                  0 == settings.value("trafficLogCompress","").toString().compare("true", Qt::CaseInsensitive));
+    }
+
+    /* Load the banlist in the background if a banlist file is configured */
+    QString banListFile = settings.value("banListFile", "").toString();
+    if ( !banListFile.isEmpty() )
+    {
+        connector.SetBanList(banListFile,
+                             settings.value("banListFilterRate", BANLIST_DEFAULT_FILTER_RATE).toDouble(),
+                             settings.value("banListFilterBytes", BANLIST_DEFAULT_FILTER_BYTES).toLongLong());
+    }
+
+    /* Compile the username patterns if a pattern file is configured */
+    connector.SetUsernamePatterns(settings.value("usernamePatternFile", "").toString());
+
+    /* Check every chat message against the configured terms */
+    connector.SetKeywords(settings.value("autoModTerms").toStringList());
+    connector.SetAutoBan( 0 == settings.value("autoModBan","").toString().compare("true", Qt::CaseInsensitive) );
+    connector.SetTargetedBan( 0 == settings.value("targetedBan","").toString().compare("true", Qt::CaseInsensitive) );
+    connector.SetSpamWaveThreshold( settings.value("spamWaveChannels", SPAM_WAVE_DEFAULT_CHANNELS).toInt(),
+                                    settings.value("spamWaveWindow", SPAM_WAVE_DEFAULT_WINDOW / 1000).toInt() );
+    connector.SetRateLimits( settings.value("rateLimitShort", RATE_DEFAULT_SHORT_LIMIT).toInt(),
+                             settings.value("rateLimitLong", RATE_DEFAULT_LONG_LIMIT).toInt() );
+    connector.SetRaidThreshold( settings.value("raidFactor", RAID_DEFAULT_FACTOR).toInt(),
+                                settings.value("raidMinJoins", RAID_DEFAULT_MIN_JOINS).toInt() );
+
+    /* Record the trace spans from the start if configured */
+    QThread::currentThread()->setObjectName("main");
+    Tracer::SetEnabled( 0 == settings.value("tracing","").toString().compare("true", Qt::CaseInsensitive) );
+
+    /* Watch the event loop for stalls */
+    StallWatchdog watchdog(QThread::currentThread(), settings.value("stallThreshold", STALL_DEFAULT_THRESHOLD).toInt());
+
+    HeadlessController controller(&connector, channels, &watchdog);
+    if ( !controller.Listen(parser.value(controlOption)) )
+    {
+        return 1;
+    }
+
+    /* Start the application */
+    return application.exec();
+}
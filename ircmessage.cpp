@@ -0,0 +1,264 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    ircmessage.cpp
+ * /author  Hackspider
+ * /brief   Source file of the allocation free tokenizer of irc messages
+ */
+
+/* Necessary dependencies to the standard library */
+#include <string.h>
+
+/* Necessary internal dependencies */
+#include "ircmessage.h"
+#include "tracer.h"
+
+/**
+ * /brief IrcMessage definition
+ */
+IrcMessage::IrcMessage()
+    : mData(nullptr),
+    mParamCount(0)
+{
+    mTags.start = mTags.length = 0;
+    mPrefix.start = mPrefix.length = 0;
+    mNick.start = mNick.length = 0;
+    mCommand.start = mCommand.length = 0;
+}
+
+/**
+ * /brief Parse definition
+ */
+bool IrcMessage::Parse(const char* data, int length)
+{
+    /* Trace the parse of a line */
+    TRACE_SPAN("IrcMessage::Parse");
+
+    mData = data;
+    mTags.start = mTags.length = 0;
+    mPrefix.start = mPrefix.length = 0;
+    mNick.start = mNick.length = 0;
+    mCommand.start = mCommand.length = 0;
+    mParamCount = 0;
+
+    /* Ignore the line ending */
+    while ( length > 0 && (data[length-1] == '\r' || data[length-1] == '\n') )
+    {
+        length--;
+    }
+
+    int pos = 0;
+
+    /* Tags are separated by the first space */
+    if ( pos < length && data[pos] == '@' )
+    {
+        const char* end = (const char*)memchr(data + pos, ' ', length - pos);
+        if ( end == nullptr )
+        {
+            return false;
+        }
+        mTags.start = pos + 1;
+        mTags.length = (int)(end - data) - mTags.start;
+        pos = (int)(end - data) + 1;
+    }
+
+    while ( pos < length && data[pos] == ' ' )
+    {
+        pos++;
+    }
+
+    /* The prefix is separated by the next space, the nick ends at the '!' */
+    if ( pos < length && data[pos] == ':' )
+    {
+        const char* end = (const char*)memchr(data + pos, ' ', length - pos);
+        if ( end == nullptr )
+        {
+            return false;
+        }
+        mPrefix.start = pos + 1;
+        mPrefix.length = (int)(end - data) - mPrefix.start;
+
+        const char* bang = (const char*)memchr(data + mPrefix.start, '!', mPrefix.length);
+        mNick.start = mPrefix.start;
+        mNick.length = (bang != nullptr) ? (int)(bang - data) - mNick.start : mPrefix.length;
+
+        pos = (int)(end - data) + 1;
+    }
+
+    while ( pos < length && data[pos] == ' ' )
+    {
+        pos++;
+    }
+
+    /* The command ends at the next space or at the end of the line */
+    mCommand.start = pos;
+    while ( pos < length && data[pos] != ' ' )
+    {
+        pos++;
+    }
+    mCommand.length = pos - mCommand.start;
+
+    if ( mCommand.length == 0 )
+    {
+        return false;
+    }
+
+    /* Parameters are separated by spaces, a ':' starts the trailing parameter */
+    while ( pos < length && mParamCount < MAX_PARAMS )
+    {
+        while ( pos < length && data[pos] == ' ' )
+        {
+            pos++;
+        }
+        if ( pos >= length )
+        {
+            break;
+        }
+
+        Range& param = mParams[mParamCount++];
+
+        if ( data[pos] == ':' )
+        {
+            param.start = pos + 1;
+            param.length = length - param.start;
+            break;
+        }
+
+        param.start = pos;
+        while ( pos < length && data[pos] != ' ' )
+        {
+            pos++;
+        }
+        param.length = pos - param.start;
+    }
+
+    return true;
+}
+
+/**
+ * /brief Tags definition
+ */
+QLatin1String IrcMessage::Tags() const
+{
+    return view(mTags);
+}
+
+/**
+ * /brief Tag definition
+ */
+QLatin1String IrcMessage::Tag(QLatin1String key) const
+{
+    const char* tags = mData + mTags.start;
+    int pos = 0;
+
+    /* Tags are "key=value" pairs separated by ';' */
+    while ( pos < mTags.length )
+    {
+        const char* next = (const char*)memchr(tags + pos, ';', mTags.length - pos);
+        int end = (next != nullptr) ? (int)(next - tags) : mTags.length;
+
+        if ( end - pos > key.size() &&
+             tags[pos + key.size()] == '=' &&
+             0 == memcmp(tags + pos, key.data(), key.size()) )
+        {
+            return QLatin1String(tags + pos + key.size() + 1, end - pos - key.size() - 1);
+        }
+
+        pos = end + 1;
+    }
+
+    return QLatin1String("");
+}
+
+/**
+ * /brief Prefix definition
+ */
+QLatin1String IrcMessage::Prefix() const
+{
+    return view(mPrefix);
+}
+
+/**
+ * /brief Nick definition
+ */
+QLatin1String IrcMessage::Nick() const
+{
+    return view(mNick);
+}
+
+/**
+ * /brief Command definition
+ */
+QLatin1String IrcMessage::Command() const
+{
+    return view(mCommand);
+}
+
+/**
+ * /brief ParamCount definition
+ */
+int IrcMessage::ParamCount() const
+{
+    return mParamCount;
+}
+
+/**
+ * /brief Param definition
+ */
+QLatin1String IrcMessage::Param(int index) const
+{
+    if ( index < 0 || index >= mParamCount )
+    {
+        return QLatin1String("");
+    }
+
+    return view(mParams[index]);
+}
+
+/**
+ * /brief Channel definition
+ */
+QLatin1String IrcMessage::Channel(int index) const
+{
+    QLatin1String channel = Param(index);
+
+    if ( channel.size() > 0 && channel.data()[0] == '#' )
+    {
+        return QLatin1String(channel.data() + 1, channel.size() - 1);
+    }
+
+    return channel;
+}
+
+/**
+ * /brief Trailing definition
+ */
+QLatin1String IrcMessage::Trailing() const
+{
+    return Param(mParamCount - 1);
+}
+
+/**
+ * /brief view definition
+ */
+QLatin1String IrcMessage::view(const Range& range) const
+{
+    return QLatin1String(mData + range.start, range.length);
+}
@@ -0,0 +1,146 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    ircmessage.h
+ * /author  Hackspider
+ * /brief   Header file of the allocation free tokenizer of irc messages
+ */
+
+/* Include Guard */
+#ifndef IRCMESSAGE_H
+#define IRCMESSAGE_H
+
+/* Necessary dependencies to Qt framework */
+#include <QString>
+
+/**
+ * /brief  The IrcMessage class declaration.
+ *
+ * Splits a single irc line "[@tags] [:prefix] command params [:trailing]" into
+ * its parts. The parts are views into the parsed line, so the line must stay
+ * alive as long as the message is used. All parts are raw bytes, the trailing
+ * text of a PRIVMSG is utf-8.
+ */
+class IrcMessage
+{
+public:
+    /**
+     * /brief  Constructor of the IrcMessage class
+     */
+    IrcMessage(void);
+
+    /**
+     * /brief   Method to tokenize a single line (a trailing "\r\n" is ignored)
+     * /param   data    Pointer to the line
+     * /param   length  Length of the line
+     * /return  Returns true if the line contains at least a command
+     */
+    bool Parse(const char* data, int length);
+
+    /**
+     * /brief   Method to get the raw tags (without '@')
+     * /return  Returns the raw tags
+     */
+    QLatin1String Tags(void) const;
+
+    /**
+     * /brief   Method to get the value of a single tag
+     * /param   key  Name of the tag
+     * /return  Returns the raw value of the tag or an empty string if the tag is missing
+     */
+    QLatin1String Tag(QLatin1String key) const;
+
+    /**
+     * /brief   Method to get the prefix (without ':')
+     * /return  Returns the prefix
+     */
+    QLatin1String Prefix(void) const;
+
+    /**
+     * /brief   Method to get the nick of the prefix (the part before '!')
+     * /return  Returns the nick
+     */
+    QLatin1String Nick(void) const;
+
+    /**
+     * /brief   Method to get the command
+     * /return  Returns the command
+     */
+    QLatin1String Command(void) const;
+
+    /**
+     * /brief   Method to get the number of parameters (including the trailing one)
+     * /return  Returns the number of parameters
+     */
+    int ParamCount(void) const;
+
+    /**
+     * /brief   Method to get a parameter
+     * /param   index  Index of the parameter
+     * /return  Returns the parameter or an empty string if it is missing
+     */
+    QLatin1String Param(int index) const;
+
+    /**
+     * /brief   Method to get a channel parameter without the leading '#'
+     * /param   index  Index of the parameter
+     * /return  Returns the channel name or an empty string if it is missing
+     */
+    QLatin1String Channel(int index) const;
+
+    /**
+     * /brief   Method to get the trailing parameter (the last one)
+     * /return  Returns the trailing parameter or an empty string if there are no parameters
+     */
+    QLatin1String Trailing(void) const;
+
+private:
+    /* Maximum number of parameters according to RFC 1459 */
+    enum { MAX_PARAMS = 15 };
+
+    /**
+     * /brief  Part of the line
+     */
+    typedef struct
+    {
+        int start;
+        int length;
+    } Range;
+
+    /**
+     * /brief   Internally used method to create a view of a part of the line
+     * /param   range  Part of the line
+     * /return  Returns the view
+     */
+    QLatin1String view(const Range& range) const;
+
+    /**
+     * /brief Internal used variables
+     */
+    const char* mData;
+    Range mTags;
+    Range mPrefix;
+    Range mNick;
+    Range mCommand;
+    Range mParams[MAX_PARAMS];
+    int mParamCount;
+};
+
+#endif /* IRCMESSAGE_H */
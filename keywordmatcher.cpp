@@ -0,0 +1,274 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    keywordmatcher.cpp
+ * /author  Hackspider
+ * /brief   Source file of the multi-pattern keyword matcher (Aho-Corasick)
+ */
+
+/* Necessary dependencies to the standard library */
+#include <string.h>
+
+/* Necessary dependencies to Qt framework */
+#include <QQueue>
+
+/* Necessary internal dependencies */
+#include "keywordmatcher.h"
+
+/**
+ * /brief isWordByte definition
+ */
+static inline bool isWordByte(unsigned char byte)
+{
+    /* Every byte of a multi-byte utf-8 character belongs to a word */
+    return ( (byte >= 'a' && byte <= 'z') ||
+             (byte >= 'A' && byte <= 'Z') ||
+             (byte >= '0' && byte <= '9') ||
+             byte == '_' || byte >= 0x80 );
+}
+
+/**
+ * /brief KeywordMatcher definition
+ */
+KeywordMatcher::KeywordMatcher()
+    : mClassCount(1)
+{
+    /* Without terms every byte belongs to class 0 */
+    memset(mClasses, 0, sizeof(mClasses));
+}
+
+/**
+ * /brief Compile definition
+ */
+void KeywordMatcher::Compile(const QStringList& terms)
+{
+    mTerms.clear();
+    mTransitions.clear();
+    mOutput.clear();
+    mOutputLink.clear();
+    mTermNext.clear();
+    mTermLength.clear();
+    mLeftBoundary.clear();
+    mRightBoundary.clear();
+    memset(mClasses, 0, sizeof(mClasses));
+    mClassCount = 1;
+
+    /* Normalize the terms and assign an input class to every byte used by a term */
+    QList<QByteArray> encodedTerms;
+    foreach (const QString& term, terms)
+    {
+        QString normalized = term.trimmed().toLower();
+        if ( normalized.isEmpty() || mTerms.contains(normalized) )
+        {
+            continue;
+        }
+
+        /* A '*' at an edge lets the term continue a word on that side */
+        QString bare = normalized;
+        bool leftOpen = bare.startsWith('*');
+        if (leftOpen)
+        {
+            bare.remove(0, 1);
+        }
+        bool rightOpen = bare.endsWith('*');
+        if (rightOpen)
+        {
+            bare.chop(1);
+        }
+
+        QByteArray encoded = bare.toUtf8();
+        if ( encoded.isEmpty() )
+        {
+            continue;
+        }
+
+        for (int i=0; i<encoded.size(); i++)
+        {
+            unsigned char byte = (unsigned char)encoded.at(i);
+            if ( mClasses[byte] == 0 && mClassCount < 256 )
+            {
+                mClasses[byte] = (unsigned char)mClassCount++;
+            }
+        }
+
+        /* Only an edge which is a word character needs a word boundary in the text */
+        mTerms << normalized;
+        mTermLength.append(encoded.size());
+        mLeftBoundary.append( !leftOpen && isWordByte((unsigned char)encoded.at(0)) );
+        mRightBoundary.append( !rightOpen && isWordByte((unsigned char)encoded.at(encoded.size() - 1)) );
+        encodedTerms << encoded;
+    }
+
+    /* Upper case ASCII letters share the class of the lower case letter */
+    for (int c='A'; c<='Z'; c++)
+    {
+        mClasses[c] = mClasses[c + ('a' - 'A')];
+    }
+
+    /* Build the trie, state 0 is the root */
+    mTransitions.fill(-1, mClassCount);
+    mOutput.fill(-1, 1);
+    mTermNext.fill(-1, encodedTerms.count());
+
+    for (int t=0; t<encodedTerms.count(); t++)
+    {
+        const QByteArray& encoded = encodedTerms.at(t);
+        int state = 0;
+
+        for (int i=0; i<encoded.size(); i++)
+        {
+            int inputClass = mClasses[(unsigned char)encoded.at(i)];
+            int next = mTransitions[state * mClassCount + inputClass];
+
+            /* Create a new state if necessary */
+            if ( next < 0 )
+            {
+                next = mOutput.count();
+                mTransitions[state * mClassCount + inputClass] = next;
+                mTransitions.insert(mTransitions.count(), mClassCount, -1);
+                mOutput.append(-1);
+            }
+
+            state = next;
+        }
+
+        /* Terms with the same bytes (e.g. "coin" and "*coin") are chained in the order of the list */
+        if ( mOutput[state] < 0 )
+        {
+            mOutput[state] = t;
+        }
+        else
+        {
+            int last = mOutput[state];
+            while ( mTermNext[last] >= 0 )
+            {
+                last = mTermNext[last];
+            }
+            mTermNext[last] = t;
+        }
+    }
+
+    /* Turn the trie into a deterministic automaton by following the failure links breadth first */
+    QVector<int> failure(mOutput.count(), 0);
+    mOutputLink.fill(-1, mOutput.count());
+    QQueue<int> queue;
+
+    for (int c=0; c<mClassCount; c++)
+    {
+        int next = mTransitions[c];
+        if ( next < 0 )
+        {
+            mTransitions[c] = 0;
+        }
+        else
+        {
+            failure[next] = 0;
+            queue.enqueue(next);
+        }
+    }
+
+    while ( !queue.isEmpty() )
+    {
+        int state = queue.dequeue();
+
+        for (int c=0; c<mClassCount; c++)
+        {
+            int next = mTransitions[state * mClassCount + c];
+            int fallback = mTransitions[failure[state] * mClassCount + c];
+
+            if ( next < 0 )
+            {
+                mTransitions[state * mClassCount + c] = fallback;
+            }
+            else
+            {
+                failure[next] = fallback;
+
+                /* Link to the longest suffix state where a term ends, it may match where this one doesn't */
+                mOutputLink[next] = ( mOutput[fallback] >= 0 ) ? fallback : mOutputLink[fallback];
+
+                queue.enqueue(next);
+            }
+        }
+    }
+}
+
+/**
+ * /brief IsEmpty definition
+ */
+bool KeywordMatcher::IsEmpty() const
+{
+    return mTerms.isEmpty();
+}
+
+/**
+ * /brief Match definition
+ */
+int KeywordMatcher::Match(const char* data, int length) const
+{
+    if ( mTerms.isEmpty() )
+    {
+        return -1;
+    }
+
+    const int* transitions = mTransitions.constData();
+    const int* output = mOutput.constData();
+    const int* outputLink = mOutputLink.constData();
+    int state = 0;
+
+    /* One table lookup per byte */
+    for (int i=0; i<length; i++)
+    {
+        state = transitions[state * mClassCount + mClasses[(unsigned char)data[i]]];
+
+        /* Check the word boundaries of every term ending here */
+        int outputState = ( output[state] >= 0 ) ? state : outputLink[state];
+        while ( outputState >= 0 )
+        {
+            for (int term = output[outputState]; term >= 0; term = mTermNext[term])
+            {
+                int start = i + 1 - mTermLength[term];
+
+                if ( mLeftBoundary[term] && start > 0 && isWordByte((unsigned char)data[start - 1]) )
+                {
+                    continue;
+                }
+                if ( mRightBoundary[term] && i + 1 < length && isWordByte((unsigned char)data[i + 1]) )
+                {
+                    continue;
+                }
+
+                return term;
+            }
+
+            outputState = outputLink[outputState];
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * /brief Term definition
+ */
+QString KeywordMatcher::Term(int index) const
+{
+    return mTerms.value(index);
+}
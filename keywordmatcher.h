@@ -0,0 +1,99 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    keywordmatcher.h
+ * /author  Hackspider
+ * /brief   Header file of the multi-pattern keyword matcher (Aho-Corasick)
+ */
+
+/* Include Guard */
+#ifndef KEYWORDMATCHER_H
+#define KEYWORDMATCHER_H
+
+/* Necessary dependencies to Qt framework */
+#include <QStringList>
+#include <QVector>
+
+/**
+ * /brief  The KeywordMatcher class declaration.
+ *
+ * Compiles a list of terms into a single deterministic automaton, so a text is
+ * checked against all terms with one table lookup per byte. Bytes which don't
+ * occur in any term share one input class to keep the table small. Matching
+ * is case insensitive for ASCII letters.
+ *
+ * A term only matches whole words: "ass" doesn't match "class". A '*' at the
+ * start or the end of a term allows the term to continue a word on that side
+ * ("*coin" matches "bitcoin"). Letters, digits, '_' and all non-ASCII bytes
+ * count as word characters; an edge of a term which isn't a word character
+ * (e.g. "bit.ly/") needs no boundary.
+ */
+class KeywordMatcher
+{
+public:
+    /**
+     * /brief  Constructor of the KeywordMatcher class
+     */
+    KeywordMatcher(void);
+
+    /**
+     * /brief  Method to compile a list of terms, replaces the previously compiled terms
+     * /param  terms  List of terms, optionally with a leading or trailing '*' (empty terms are ignored)
+     */
+    void Compile(const QStringList& terms);
+
+    /**
+     * /brief   Method to check if there is any term compiled
+     * /return  Returns true if there is no term
+     */
+    bool IsEmpty(void) const;
+
+    /**
+     * /brief   Method to search the first occurrence of any term in a text
+     * /param   data    Pointer to the utf-8 text
+     * /param   length  Length of the text
+     * /return  Returns the index of the matching term or -1 if no term matches
+     */
+    int Match(const char* data, int length) const;
+
+    /**
+     * /brief   Method to get a compiled term
+     * /param   index  Index of the term as returned by Match
+     * /return  Returns the term
+     */
+    QString Term(int index) const;
+
+private:
+    /**
+     * /brief Internal used variables
+     */
+    QStringList mTerms;
+    QVector<int> mTransitions;
+    QVector<int> mOutput;
+    QVector<int> mOutputLink;
+    QVector<int> mTermNext;
+    QVector<int> mTermLength;
+    QVector<bool> mLeftBoundary;
+    QVector<bool> mRightBoundary;
+    unsigned char mClasses[256];
+    int mClassCount;
+};
+
+#endif /* KEYWORDMATCHER_H */
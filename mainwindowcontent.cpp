@@ -1,826 +1,1808 @@
-/****************************************************************************
- * Copyright (C) 2018 by Sebastian Ziganki                                  *
- *                                                                          *
- * This file is part of Lpz3ncLittleHelper.                                 *
- *                                                                          *
- *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
- *   modify it under the terms of the GNU Lesser General Public License as  *
- *   published by the Free Software Foundation, either version 3 of the     *
- *   License.                                                               *
- *                                                                          *
- *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
- *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
- *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
- *   GNU Lesser General Public License for more details.                    *
- *                                                                          *
- *   You should have received a copy of the GNU Lesser General Public       *
- *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
- ****************************************************************************/
-
-/**
- * /file    mainwindowcontent.cpp
- * /author  Hackspider
- * /brief   Source file of the main window
- */
-
-/* Necessary dependencies to Qt framework */
-#include <QSettings>
-#include <QStandardItem>
-#include <QDebug>
-#include <QTimer>
-
-/* Necessary internal dependencies */
-#include "framelesswindow.h"
-#include "mainwindowcontent.h"
-#include "ui_mainwindowcontent.h"
-#include "addchanneldialog.h"
-#include "loginwindow.h"
-
-/**
- * /brief MainWindowContent definition
- */
-MainWindowContent::MainWindowContent(QWidget *parent) :
-    QMainWindow(parent),
-    ui(new Ui::MainWindowContent),
-    mSettings(nullptr),
-    mLoginName(""),
-    mOauth2(""),
-    mSaveCredentials(true),
-    mIconRightDelegate(nullptr),
-    mChannelModel(nullptr),
-    mUserModel(nullptr),
-    mTwitchConnector(nullptr)
-{
-    /*=================================================================*/
-    /*===                          UI Setup                         ===*/
-    /*=================================================================*/
-
-    /* Setup all widgets of the ui (avoids seg faults if accessed below) */
-    ui->setupUi(this);
-
-    /* Create and set a new item delegate to show the icons of the channel list on the right side (status if channel is connected) */
-    mIconRightDelegate = new IconRightStyledItemDelegate(this);
-    ui->channels->setItemDelegate(mIconRightDelegate);
-
-    /* Create and set the item model for the channel list */
-    mChannelModel = new QStandardItemModel();
-    ui->channels->setModel(mChannelModel);
-
-    /* Create user model for the user list */
-    mUserModel = new QStandardItemModel();
-
-    /* Set the header for user model */
-    mUserModel->setHorizontalHeaderItem(0,new QStandardItem(QString("Timestamp")));
-    mUserModel->setHorizontalHeaderItem(1,new QStandardItem(QString("Username")));
-    mUserModel->setHorizontalHeaderItem(2,new QStandardItem(QString("Channels")));
-    mUserModel->setHorizontalHeaderItem(3,new QStandardItem(QString("Reason")));
-    mUserModel->setHorizontalHeaderItem(4,new QStandardItem(QString("URL")));
-
-    /* Set the model to the corresponding UI element */
-    ui->users->setModel(mUserModel);
-
-    /* Make the user items left align */
-    ui->users->horizontalHeader()->setDefaultAlignment(Qt::AlignLeft);
-
-    /* Preset the columnwidth of the user list */
-    ui->users->setColumnWidth(0,135);
-    ui->users->setColumnWidth(1,120);
-    ui->users->setColumnWidth(2,323);
-    ui->users->setColumnWidth(3,200);
-    ui->users->setColumnWidth(4,200);
-
-    /*=================================================================*/
-    /*===                          Settings                         ===*/
-    /*=================================================================*/
-
-    /* Set settings file */
-    mSettings = new QSettings(CONFIG_FILE, QSettings::IniFormat);
-
-    /* Read username and oauth2 from settings. If username or oauth2 is missing set values to an empty String */
-    mLoginName = mSettings->value("loginName","").toString();
-    mOauth2 = mSettings->value("oauth2","").toString();
-
-    /* Check if setting to save credentials is available and set */
-    if ( 0 == mSettings->value("saveCredentials","").toString().compare("true", Qt::CaseInsensitive) )
-    {
-        mSaveCredentials = true;
-    }
-
-    /* Read all channels from config file */
-    int channelCount = mSettings->beginReadArray("channels");
-
-    for (int i =  0; i<channelCount; i++)
-    {
-        mSettings->setArrayIndex(i);
-
-        /* Read a channel name and if the channel should be connected on startup */
-        QString currentChannel = mSettings->value("channelName","").toString();
-        QString currentChannelDefualtConnect = mSettings->value("channelDefaultConnect","").toString();
-
-        /* Remove whitespaces from channel name */
-        currentChannel = currentChannel.simplified().replace(" ","");
-
-        /* Check if defualt connect is true */
-        currentChannelDefualtConnect = currentChannelDefualtConnect.simplified().replace(" ","");
-
-        bool defaultConnect = false;
-        if ( 0 == currentChannelDefualtConnect.compare("true", Qt::CaseInsensitive) )
-        {
-            defaultConnect = true;
-        }
-
-        /* Create objects for every channel */
-        if ( !currentChannel.isEmpty() )
-        {
-            QStandardItem* channel = new QStandardItem(currentChannel);
-            channel->setCheckable(true);
-            channel->setIcon(QIcon(":/icons/images/NOK.png"));
-
-            if (defaultConnect == true)
-            {
-                channel->setCheckState(Qt::Checked);
-            }
-            else
-            {
-                channel->setCheckState(Qt::Unchecked);
-            }
-
-            mChannelModel->appendRow(channel);
-        }
-
-    }
-
-    /* Complete array */
-    mSettings->endArray();
-
-    /* Get the count of the users of the config file */
-    int userCount = mSettings->beginReadArray("users");
-
-    /* Iterate over all users */
-    for (int i=0; i<userCount; i++)
-    {
-        mSettings->setArrayIndex(i);
-
-        /* Read user properties from config file */
-        QString userTimestamp = mSettings->value("timestamp").toString();
-        QString userName = mSettings->value("username").toString().simplified().replace(" ","");
-        QString userChannels = mSettings->value("channelNames").toString().simplified().replace(" ","");
-        QString userBanReason = mSettings->value("banReason").toString();
-        QString userURLReason = mSettings->value("banURL").toString();
-
-        /* Create a item form timestamp */
-        QStandardItem* userTimestampItem = new QStandardItem();
-        userTimestampItem->setText(userTimestamp);
-
-        /* Create a item form username */
-        QStandardItem* userNameItem = new QStandardItem();
-        userNameItem->setText(userName);
-
-        /* Create a item form channels */
-        QStandardItem* userChannelsItem = new QStandardItem();
-        userChannelsItem->setText(userChannels);
-
-        /* Create a item form ban reason */
-        QStandardItem* userBanReasonItem = new QStandardItem();
-        userBanReasonItem->setText(userBanReason);
-
-        /* Create a item form URL */
-        QStandardItem* userURLReasonItem = new QStandardItem();
-        userURLReasonItem->setText(userURLReason);
-
-        /* Create a list of all items */
-        QList<QStandardItem*> userRowList;
-
-        /* Push all created items into the list */
-        userRowList << userTimestampItem << userNameItem << userChannelsItem << userBanReasonItem << userURLReasonItem;
-
-        /* Add a row based on the list created */
-        mUserModel->appendRow(userRowList);
-    }
-
-    /* Complete array */
-    mSettings->endArray();
-
-    /*=================================================================*/
-    /*===                        Connections                        ===*/
-    /*=================================================================*/
-
-    /* If the model changed call the corresponding notification method */
-    connect(mChannelModel, SIGNAL(itemChanged(QStandardItem*)),       this, SLOT(channelModelItemChanged(QStandardItem*)));
-    connect(mChannelModel, SIGNAL(rowsRemoved(QModelIndex,int,int)),  this, SLOT(channelRowsChanged(QModelIndex,int,int)));
-    connect(mChannelModel, SIGNAL(rowsInserted(QModelIndex,int,int)), this, SLOT(channelRowsChanged(QModelIndex,int,int)));
-
-    connect(mUserModel, SIGNAL(itemChanged(QStandardItem*)),       this, SLOT(userModelItemChanged(QStandardItem*)));
-    connect(mUserModel, SIGNAL(rowsRemoved(QModelIndex,int,int)),  this, SLOT(userRowsChanged(QModelIndex,int,int)));
-    connect(mUserModel, SIGNAL(rowsInserted(QModelIndex,int,int)), this, SLOT(userRowsChanged(QModelIndex,int,int)));
-
-    /* Let the ui load and get credentials afterwards */
-    QTimer::singleShot(0,this,SLOT(loginConnect()));
-
-}
-
-/**
- * /brief ~MainWindowContent definition
- */
-MainWindowContent::~MainWindowContent()
-{
-    /* Check for null pointer and delete all objects from heap */
-
-    if (nullptr != mIconRightDelegate)
-    {
-        delete mIconRightDelegate;
-    }
-
-    if (nullptr != mChannelModel)
-    {
-        delete mChannelModel;
-    }
-
-    if (nullptr != mSettings)
-    {
-        delete mSettings;
-    }
-
-    if (nullptr != mUserModel)
-    {
-        delete mUserModel;
-    }
-
-    if (nullptr != ui)
-    {
-        delete ui;
-    }
-
-    if (nullptr != mTwitchConnector)
-    {
-        delete mTwitchConnector;
-    }
-
-}
-
-/**
- * /brief on_addChannelButton_clicked definition
- */
-void MainWindowContent::on_addChannelButton_clicked()
-{
-    /* We need a new window for the user to enter the information regarding the new channel */
-    FramelessWindow addChannelWindow;
-    AddChannelDialog addChannelDialog;
-
-    /* Set the window title */
-    addChannelWindow.setWindowTitle("Add Channel");
-
-    /* Set the content of the frameless window to our 'add channel dialog' */
-    addChannelWindow.setContent(&addChannelDialog);
-
-    /* Block the main program until the user entered the channel information */
-    addChannelWindow.exec();
-
-    /* Proceed only if the dialog was accepted */
-    if ( 1 == addChannelDialog.result())
-    {
-        /* First check if the channel is already added */
-        QString channelName = addChannelDialog.GetChannel().simplified().replace(" ","");
-        for (int i =0; i<mChannelModel->rowCount(); i++)
-        {
-            /* Compare channel name with all channels in the model */
-            if (mChannelModel->item(i)->text().compare(channelName)==0)
-            {
-                /* If channel is already in the list, nothing to do */
-                return;
-            }
-        }
-
-        /* Remove all whitespaces from entered channel name and check if it's not empty */
-        if ( !addChannelDialog.GetChannel().simplified().replace(" ","").isEmpty() )
-        {
-            /* Create a new channel object and put it into the channel model */
-            QStandardItem* newTwichChannel = new QStandardItem(channelName);
-            newTwichChannel->setCheckable(true);
-            newTwichChannel->setIcon(QIcon(":/icons/images/NOK.png"));
-
-            if (addChannelDialog.GetDefaultConnect() == true)
-            {
-                newTwichChannel->setCheckState(Qt::Checked);
-            }
-            else
-            {
-                newTwichChannel->setCheckState(Qt::Unchecked);
-            }
-
-            mChannelModel->appendRow(newTwichChannel);
-
-            /* To keep an alphabetical order sort the channel model */
-            mChannelModel->sort(0);
-        }
-    }
-
-
-}
-
-/**
- * /brief on_removeChannelButton_clicked definition
- */
-void MainWindowContent::on_removeChannelButton_clicked()
-{
-    /* Get the selection model and the list of selected items from model */
-    QItemSelectionModel* selectionModel = ui->channels->selectionModel();
-    QModelIndexList selectedChannels = selectionModel->selectedRows();
-
-    /* Delete all selected channels */
-    for (int i=0; i<selectedChannels.count(); i++)
-    {
-        /* Get the index of a selected channel */
-        QModelIndex channelIndex =  selectedChannels.at(i);
-
-        /* Remove the selected channel (by index) and take over ownership */
-        QList<QStandardItem*> rowsToRemove = mChannelModel->takeRow(channelIndex.row());
-
-        /* Also it is one row we need to satisfy the Qt's API and iterate over all entries from takerow */
-        for (int j = 0; j<rowsToRemove.count(); j++)
-        {
-            /* Conversion from the QStandardItem to our own implementation */
-            QStandardItem* toRemove = rowsToRemove.at(j);
-
-            /* Finally delete the Twich channel object complete from heap */
-            delete toRemove;
-        }
-
-        /* To keep an alphabetical order sort the channel model */
-        mChannelModel->sort(0);
-
-    }
-
-}
-
-/**
- * /brief rewriteChannelSettings definition
- */
-void MainWindowContent::rewriteChannelSettings()
-{
-    /* First of all remove all channels from config */
-    mSettings->remove("channels");
-
-    /* Start the new channels array */
-    mSettings->beginWriteArray("channels");
-
-    /* Iterate over the whole channel model and store every entry in a separate settings object */
-    for (int i = 0; i< mChannelModel->rowCount(); i++)
-    {
-        /* Set the current array index based on the channel model */
-        mSettings->setArrayIndex(i);
-
-        /* Save the channel name */
-        mSettings->setValue("channelName",mChannelModel->item(i)->text());
-
-        /* Save the default connect value based on the check state of the channel's check box */
-        if ( Qt::Checked == mChannelModel->item(i)->checkState())
-        {
-            mSettings->setValue("channelDefaultConnect","true");
-        }
-        else
-        {
-            mSettings->setValue("channelDefaultConnect","false");
-        }
-    }
-
-    /* Complete array */
-    mSettings->endArray();
-}
-
-/**
- * /brief rewriteUserSettings definition
- */
-void MainWindowContent::rewriteUserSettings()
-{
-    /* First of all remove all users from config */
-    mSettings->remove("users");
-
-    /* Start the new user array */
-    mSettings->beginWriteArray("users");
-
-    /* Iterate over the whole user model and store every entry in a separate settings object */
-    for (int i = 0; i< mUserModel->rowCount(); i++)
-    {
-        /* Set the current array index based on the user model */
-        mSettings->setArrayIndex(i);
-
-        /* Save the timestamp */
-        mSettings->setValue("timestamp",mUserModel->item(i,0)->text());
-
-        /* Save the username */
-        mSettings->setValue("username",mUserModel->item(i,1)->text());
-
-        /* Save the channel names */
-        mSettings->setValue("channelNames",mUserModel->item(i,2)->text());
-
-        /* Save the ban reason */
-        mSettings->setValue("banReason",mUserModel->item(i,3)->text());
-
-        /* Save the ban reason */
-        mSettings->setValue("banURL",mUserModel->item(i,4)->text());
-    }
-
-    /* Complete array */
-    mSettings->endArray();
-
-}
-
-/**
- * /brief loginConnect definition
- */
-void MainWindowContent::loginConnect(bool forceDialog)
-{
-    /* Check if it is necessary to show a credentials dialog */
-    if ( mSaveCredentials == false ||
-         mOauth2.isEmpty() ||
-         mLoginName.isEmpty() ||
-         forceDialog == true )
-    {
-        /* We need a new window for the user to enter the information regarding the login data */
-        FramelessWindow loginWindow;
-        LoginWindow loginDialog;
-
-        /* Set the window title */
-        loginWindow.setWindowTitle("User Credentials");
-
-        /* Set the content of the frameless window to our 'login dialog' */
-        loginWindow.setContent(&loginDialog);
-
-        /* For convenience reason set the current settings to the ui elements */
-        loginDialog.SetLoginName(mLoginName);
-        loginDialog.SetOAuth2Name(mOauth2);
-        loginDialog.SetSaveCredentials(mSaveCredentials);
-
-        /* Block the main program until the user credential information */
-        loginWindow.exec();
-
-        /* Get the values from dialog */
-        mLoginName = loginDialog.GetLoginName();
-        mOauth2 = loginDialog.GetOAuth2();
-        mSaveCredentials = loginDialog.GetSaveCredentials();
-    }
-
-    /* Check if the credentials shall be saved */
-    if (mSaveCredentials)
-    {
-        /* Save credentials to file */
-        mSettings->setValue("loginName",mLoginName);
-        mSettings->setValue("oauth2",mOauth2);
-        mSettings->setValue("saveCredentials","true");
-    }
-    else
-    {
-        /* If credentials shall not be saved empty the config */
-        mSettings->setValue("loginName","");
-        mSettings->setValue("oauth2","");
-        mSettings->setValue("saveCredentials","false");
-    }
-
-    /* Create a new connector to twitch if necessary */
-    if ( mTwitchConnector == nullptr )
-    {
-        mTwitchConnector = new TwitchConnector( "irc.twitch.tv",
-                                                6667,
-                                                mLoginName,
-                                                mOauth2,
-                                                mChannelModel,
-                                                ui->connectionIcon,
-                                                ui->connectButton,
-                                                this );
-    }
-    else
-    {
-        /* Update login name and oauth2 of the twitch connector */
-        mTwitchConnector->SetLoginName(mLoginName);
-        mTwitchConnector->SetOauth2(mOauth2);
-    }
-}
-
-/**
- * /brief channelModelItemChanged definition
- */
-void MainWindowContent::channelModelItemChanged(QStandardItem *item)
-{
-    /* Update settings file */
-    rewriteChannelSettings();
-}
-
-/**
- * /brief channelRowsChanged definition
- */
-void MainWindowContent::channelRowsChanged(const QModelIndex &parent, int start, int end)
-{
-    /* Update settings file */
-    rewriteChannelSettings();
-}
-
-/**
- * /brief userModelItemChanged definition
- */
-void MainWindowContent::userModelItemChanged(QStandardItem *item)
-{
-    /* Update settings file */
-    rewriteUserSettings();
-}
-
-/**
- * /brief userRowsChanged definition
- */
-void MainWindowContent::userRowsChanged(const QModelIndex &parent, int start, int end)
-{
-    /* Update settings file */
-    rewriteUserSettings();
-}
-
-/**
- * /brief on_users_clicked definition
- */
-void MainWindowContent::on_users_clicked(const QModelIndex &index)
-{
-    /* Make only the reason column editable and get the current flags from model */
-    Qt::ItemFlags flags = mUserModel->itemFromIndex(index)->flags();
-
-    /* If column "Reason" or "URL" is selected set item to editable else forbid editing of cells */
-    if (index.column() == 3 || index.column() == 4)
-    {
-        flags |= Qt::ItemIsEditable;
-    }
-    else
-    {
-        flags &= ~Qt::ItemIsEditable;
-    }
-
-    /* Set the new flags to model */
-    mUserModel->itemFromIndex(index)->setFlags(flags);
-
-    /* Based of the row selected set the username and reason line edit to the selected value (UX reasons) */
-    ui->usernameLineEdit->setText( mUserModel->item(index.row(),1)->text() );
-    ui->reasonLineEdit->setText( mUserModel->item(index.row(),3)->text() );
-}
-
-/**
- * /brief getCurrentTimestamp definition
- */
-QString MainWindowContent::getCurrentTimestamp()
-{
-    /* Define the time/date format */
-    QString date = QDate::currentDate().toString("yyyy.MM.dd");
-    QString time = QTime::currentTime().toString("hh:mm:ss");
-
-    /* Concatenate date and time and return the string */
-    return date.append(" ").append(time);
-}
-
-/**
- * /brief on_banUserButton_clicked definition
- */
-void MainWindowContent::on_banUserButton_clicked()
-{
-    /* First of all check if the username is formally correct */
-    QString username = ui->usernameLineEdit->text();
-    username = username.simplified().replace(" ","");
-
-    /* If username is incorrect do nothing */
-    if (username.isEmpty())
-    {
-        return;
-    }
-
-    /* Despite the username the reason is allowed to leave empty */
-    QString banReason = ui->reasonLineEdit->text();
-
-    /* Despite the username the url is allowed to leave empty */
-    QString urlReason = ui->urlReasonLineEdit->text();
-
-    /* Perform ban on all connected channels */
-    QList<QString> bannedChannels = banUser(username);
-
-    /* If there is no channel ban performed, do not track the user in the list */
-    if (bannedChannels.isEmpty())
-    {
-        return;
-    }
-
-    /* Check if the user is already in the list */
-    int rowFound = -1;
-    for (int i=0; i<mUserModel->rowCount(); i++)
-    {
-        QStandardItem* currentUser = mUserModel->item(i,1);
-
-        if (currentUser->text().compare(username) == 0)
-        {
-            rowFound = i;
-            break;
-        }
-    }
-
-    /* Pointer to the cells we are using */
-    QStandardItem* timestamp = nullptr;
-    QStandardItem* user = nullptr;
-    QStandardItem* channels = nullptr;
-    QStandardItem* reason = nullptr;
-    QStandardItem* url = nullptr;
-
-    /* Based on if we found a user reuse the row, otherwise create a new row */
-    if (rowFound != -1)
-    {
-        timestamp = mUserModel->item(rowFound,0);
-             user = mUserModel->item(rowFound,1);
-         channels = mUserModel->item(rowFound,2);
-           reason = mUserModel->item(rowFound,3);
-              url = mUserModel->item(rowFound,4);
-
-           reason->setText(banReason);
-           url->setText(urlReason);
-    }
-    else
-    {
-        timestamp = new QStandardItem();
-             user = new QStandardItem(username);
-         channels = new QStandardItem("");
-           reason = new QStandardItem(banReason);
-              url = new QStandardItem(urlReason);
-
-           QList<QStandardItem*> newRow;
-
-           newRow << timestamp << user << channels << reason << url;
-
-           mUserModel->appendRow(newRow);
-    }
-
-    /* Update timestamp */
-    timestamp->setText(getCurrentTimestamp());
-
-    /* Update ban list --> ';' separated string of channels */
-    QStringList currentChannels = channels->text().split(';',QString::SkipEmptyParts);
-
-    for (int i=0; i<bannedChannels.count(); i++)
-    {
-        if ( !currentChannels.contains(bannedChannels.at(i)) )
-        {
-            currentChannels << bannedChannels.at(i);
-        }
-    }
-
-    /* Add new channels to the list */
-    QString newChannels;
-    bool newChannelsAdded = false;
-    for (int i=0; i<currentChannels.count(); i++)
-    {
-        newChannels.append(currentChannels.at(i)).append(";");
-        newChannelsAdded = true;
-    }
-
-    /* If a new channel is added remove the last ';' */
-    if (newChannelsAdded)
-    {
-        newChannels.remove(newChannels.count()-1,1);
-    }
-
-    /* Set the new channels to the user model */
-    channels->setText(newChannels);
-
-}
-
-/**
- * /brief on_unbanUserButton_clicked definition
- */
-void MainWindowContent::on_unbanUserButton_clicked()
-{
-    /* First of all check if the username is formally correct */
-    QString username = ui->usernameLineEdit->text();
-    username = username.simplified().replace(" ","");
-
-    /* If username is incorrect do nothing */
-    if (username.isEmpty())
-    {
-        return;
-    }
-
-    /* Perform unban on all connected channels */
-    QList<QString> unbannedChannels = unbanUser(username);
-
-    /* If there is no channel unban performed, do nothing */
-    if (unbannedChannels.isEmpty())
-    {
-        return;
-    }
-
-    /* Check if the user is already in the list */
-    int rowFound = -1;
-    for (int i=0; i<mUserModel->rowCount(); i++)
-    {
-        QStandardItem* currentUser = mUserModel->item(i,1);
-
-        if (currentUser->text().compare(username) == 0)
-        {
-            rowFound = i;
-            break;
-        }
-    }
-
-    /* If the user is not tracked in the list, tracking is not necessary */
-    if (rowFound == -1)
-    {
-        return;
-    }
-
-    /* Get the channel from the found row */
-    QStandardItem* channels = mUserModel->item(rowFound,2);
-
-    /* Get ban list --> ';' separated string of channels */
-    QStringList currentChannels = channels->text().split(';',QString::SkipEmptyParts);
-
-    /* Remove all unbanned channels from the entry */
-    for (int i=0; i<unbannedChannels.count(); i++)
-    {
-        if ( currentChannels.contains(unbannedChannels.at(i)) )
-        {
-            currentChannels.removeAll(unbannedChannels.at(i));
-        }
-    }
-
-    /* If user isn't banned at at least one channel remove the entry completely */
-    if (currentChannels.isEmpty())
-    {
-        mUserModel->removeRow(rowFound);
-        return;
-    }
-
-    /* Add all remaining channels to the list */
-    QString allChannels;
-    for (int i=0; i<currentChannels.count(); i++)
-    {
-        allChannels.append(currentChannels.at(i)).append(";");
-    }
-
-    /* If a new channel is added remove the last ';' */
-    allChannels.remove(allChannels.count()-1,1);
-
-    /* Set the new channels to the user model */
-    channels->setText(allChannels);
-}
-
-/**
- * /brief banUser definition
- */
-QList<QString> MainWindowContent::banUser(QString username)
-{
-    /* Ban the user and return the channels where the user was banned */
-    QSet<QString> channelsBannedSet;
-    channelsBannedSet = mTwitchConnector->banUser(username);
-    return channelsBannedSet.toList();
-
-}
-
-/**
- * /brief unbanUser definition
- */
-QList<QString> MainWindowContent::unbanUser(QString username)
-{
-    /* Unban the user and return the channels where the user was unbanned */
-    QSet<QString> channelsUnbannedSet;
-    channelsUnbannedSet = mTwitchConnector->unbanUser(username);
-    return channelsUnbannedSet.toList();
-}
-
-/**
- * /brief on_actionLogin_triggered definition
- */
-void MainWindowContent::on_actionLogin_triggered()
-{
-    /* Connect to twitch service and force the login credential dialog */
-    loginConnect(true);
-}
-
-/**
- * /brief on_actionQuit_triggered definition
- */
-void MainWindowContent::on_actionQuit_triggered()
-{
-    /* Quit the application */
-    exit(0);
-}
-
-/**
- * /brief on_connectButton_clicked definition
- */
-void MainWindowContent::on_connectButton_clicked()
-{
-    /* Based on the twitch service connection state */
-    if (mTwitchConnector->GetConnectionState() == DISCONNECTED)
-    {
-        /* Connect to twitch service */
-        mTwitchConnector->Connect();
-    }
-    else if (mTwitchConnector->GetConnectionState() == CONNECTED)
-    {
-        /* Disconnect from twitch service */
-        mTwitchConnector->Disconnect();
-    }
-    else
-    {
-        /* Intentionally do nothing */
-    }
-}
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    mainwindowcontent.cpp
+ * /author  Hackspider
+ * /brief   Source file of the main window
+ */
+
+/* Necessary dependencies to Qt framework */
+#include <QSettings>
+#include <QStandardItem>
+#include <QDebug>
+#include <QTimer>
+#include <QDateTime>
+#include <QFileDialog>
+#include <QMessageBox>
+
+/* Necessary dependencies to the standard library */
+#include <algorithm>
+
+/* Necessary internal dependencies */
+#include "framelesswindow.h"
+#include "mainwindowcontent.h"
+#include "ui_mainwindowcontent.h"
+#include "addchanneldialog.h"
+#include "loginwindow.h"
+#include "settingswriter.h"
+
+/**
+ * /brief MainWindowContent definition
+ */
+MainWindowContent::MainWindowContent(QWidget *parent) :
+    QMainWindow(parent),
+    ui(new Ui::MainWindowContent),
+    mSettings(nullptr),
+    mLoginName(""),
+    mOauth2(""),
+    mSaveCredentials(true),
+    mIconRightDelegate(nullptr),
+    mChannelModel(nullptr),
+    mUserModel(nullptr),
+    mTwitchConnector(nullptr),
+    mConnectorThread(nullptr),
+    mConnectionState(DISCONNECTED),
+    mSuggestionModel(nullptr),
+    mSearchModel(nullptr),
+    mUsernameCompleter(nullptr),
+    mUsernameCompleterModel(nullptr),
+    mAutoBan(false),
+    mTargetedBan(false),
+    mSpamWaveChannels(SPAM_WAVE_DEFAULT_CHANNELS),
+    mSpamWaveWindow(SPAM_WAVE_DEFAULT_WINDOW / 1000),
+    mRateLimitShort(RATE_DEFAULT_SHORT_LIMIT),
+    mRateLimitLong(RATE_DEFAULT_LONG_LIMIT),
+    mRaidFactor(RAID_DEFAULT_FACTOR),
+    mRaidMinJoins(RAID_DEFAULT_MIN_JOINS),
+    mTraceSeconds(TRACE_DEFAULT_SECONDS),
+    mStallThreshold(STALL_DEFAULT_THRESHOLD),
+    mGuiWatchdog(nullptr),
+    mConnectorWatchdog(nullptr),
+    mUnreadWarnings(0),
+    mBanListFile(""),
+    mBanListFailed(false)
+{
+    /*=================================================================*/
+    /*===                          UI Setup                         ===*/
+    /*=================================================================*/
+
+    /* Setup all widgets of the ui (avoids seg faults if accessed below) */
+    ui->setupUi(this);
+
+    /* Create and set a new item delegate to show the icons of the channel list on the right side (status if channel is connected) */
+    mIconRightDelegate = new IconRightStyledItemDelegate(this);
+    ui->channels->setItemDelegate(mIconRightDelegate);
+
+    /* Create and set the item model for the channel list */
+    mChannelModel = new QStandardItemModel();
+    ui->channels->setModel(mChannelModel);
+
+    /* Create user model for the user list */
+    mUserModel = new QStandardItemModel();
+
+    /* Set the header for user model */
+    mUserModel->setHorizontalHeaderItem(0,new QStandardItem(QString("Timestamp")));
+    mUserModel->setHorizontalHeaderItem(1,new QStandardItem(QString("Username")));
+    mUserModel->setHorizontalHeaderItem(2,new QStandardItem(QString("Channels")));
+    mUserModel->setHorizontalHeaderItem(3,new QStandardItem(QString("Reason")));
+    mUserModel->setHorizontalHeaderItem(4,new QStandardItem(QString("URL")));
+    mUserModel->setHorizontalHeaderItem(5,new QStandardItem(QString("Evidence")));
+
+    /* Set the model to the corresponding UI element */
+    ui->users->setModel(mUserModel);
+
+    /* Create suggestion model for users that are suspected by the chat monitoring */
+    mSuggestionModel = new QStandardItemModel();
+
+    /* Set the header for suggestion model */
+    mSuggestionModel->setHorizontalHeaderItem(0,new QStandardItem(QString("Timestamp")));
+    mSuggestionModel->setHorizontalHeaderItem(1,new QStandardItem(QString("Username")));
+    mSuggestionModel->setHorizontalHeaderItem(2,new QStandardItem(QString("Channels")));
+    mSuggestionModel->setHorizontalHeaderItem(3,new QStandardItem(QString("Reason")));
+    mSuggestionModel->setHorizontalHeaderItem(4,new QStandardItem(QString("Message")));
+
+    /* Set the model to the corresponding UI element */
+    ui->suggestions->setModel(mSuggestionModel);
+    ui->suggestions->horizontalHeader()->setDefaultAlignment(Qt::AlignLeft);
+
+    /* Create search model for the recent chat messages found by the connector */
+    mSearchModel = new QStandardItemModel();
+
+    /* Set the header for search model */
+    mSearchModel->setHorizontalHeaderItem(0,new QStandardItem(QString("Timestamp")));
+    mSearchModel->setHorizontalHeaderItem(1,new QStandardItem(QString("Channel")));
+    mSearchModel->setHorizontalHeaderItem(2,new QStandardItem(QString("Username")));
+    mSearchModel->setHorizontalHeaderItem(3,new QStandardItem(QString("Message")));
+
+    /* Set the model to the corresponding UI element */
+    ui->searchResults->setModel(mSearchModel);
+    ui->searchResults->horizontalHeader()->setDefaultAlignment(Qt::AlignLeft);
+
+    /* Preset the columnwidth of the search results */
+    ui->searchResults->setColumnWidth(0,135);
+    ui->searchResults->setColumnWidth(1,120);
+    ui->searchResults->setColumnWidth(2,120);
+    ui->searchResults->setColumnWidth(3,603);
+
+    /* Complete the username from the recently seen and the banned users (the list is filled on every edit) */
+    mUsernameCompleterModel = new QStringListModel(this);
+    mUsernameCompleter = new QCompleter(mUsernameCompleterModel, this);
+    mUsernameCompleter->setCaseSensitivity(Qt::CaseInsensitive);
+    mUsernameCompleter->setCompletionMode(QCompleter::UnfilteredPopupCompletion);
+    ui->usernameLineEdit->setCompleter(mUsernameCompleter);
+
+    /* Preset the columnwidth of the suggestion list */
+    ui->suggestions->setColumnWidth(0,135);
+    ui->suggestions->setColumnWidth(1,120);
+    ui->suggestions->setColumnWidth(2,200);
+    ui->suggestions->setColumnWidth(3,200);
+    ui->suggestions->setColumnWidth(4,323);
+
+    /* Make the user items left align */
+    ui->users->horizontalHeader()->setDefaultAlignment(Qt::AlignLeft);
+
+    /* Preset the columnwidth of the user list */
+    ui->users->setColumnWidth(0,135);
+    ui->users->setColumnWidth(1,120);
+    ui->users->setColumnWidth(2,323);
+    ui->users->setColumnWidth(3,200);
+    ui->users->setColumnWidth(4,200);
+    ui->users->setColumnWidth(5,400);
+
+    /* Bound the event log, old events are dropped */
+    ui->eventLog->setMaximumBlockCount(MAX_LOG_LINES);
+
+    /*=================================================================*/
+    /*===                          Settings                         ===*/
+    /*=================================================================*/
+
+    /* Set settings file */
+    mSettings = new QSettings(CONFIG_FILE, QSettings::IniFormat);
+
+    /* Read username and oauth2 from settings. If username or oauth2 is missing set values to an empty String */
+    mLoginName = mSettings->value("loginName","").toString();
+    mOauth2 = mSettings->value("oauth2","").toString();
+
+    /* Read the terms every chat message is checked against and if hits are banned automatically */
+    mKeywords = mSettings->value("autoModTerms").toStringList();
+    mAutoBan = ( 0 == mSettings->value("autoModBan","").toString().compare("true", Qt::CaseInsensitive) );
+
+    /* Read if users shall only be banned in the channels they are present in */
+    mTargetedBan = ( 0 == mSettings->value("targetedBan","").toString().compare("true", Qt::CaseInsensitive) );
+
+    /* Read the threshold of the spam wave detection (number of channels and window in seconds) */
+    mSpamWaveChannels = mSettings->value("spamWaveChannels", SPAM_WAVE_DEFAULT_CHANNELS).toInt();
+    mSpamWaveWindow = mSettings->value("spamWaveWindow", SPAM_WAVE_DEFAULT_WINDOW / 1000).toInt();
+
+    /* Read the message rate limits of a single user (messages per 5 and per 60 seconds) */
+    mRateLimitShort = mSettings->value("rateLimitShort", RATE_DEFAULT_SHORT_LIMIT).toInt();
+    mRateLimitLong = mSettings->value("rateLimitLong", RATE_DEFAULT_LONG_LIMIT).toInt();
+
+    /* Read the threshold of the raid detection (factor of the usual joins and minimum joins per 30 seconds) */
+    mRaidFactor = mSettings->value("raidFactor", RAID_DEFAULT_FACTOR).toInt();
+    mRaidMinJoins = mSettings->value("raidMinJoins", RAID_DEFAULT_MIN_JOINS).toInt();
+
+    /* Read if the trace spans are recorded from the start and how many seconds a trace covers */
+    ui->actionTracing->setChecked( 0 == mSettings->value("tracing","").toString().compare("true", Qt::CaseInsensitive) );
+    mTraceSeconds = mSettings->value("traceSeconds", TRACE_DEFAULT_SECONDS).toInt();
+
+    /* Read the minimum latency of an event loop in milliseconds which counts as stall and watch the ui thread */
+    mStallThreshold = mSettings->value("stallThreshold", STALL_DEFAULT_THRESHOLD).toInt();
+    mGuiWatchdog = new StallWatchdog(QThread::currentThread(), mStallThreshold);
+
+    /* Check if setting to save credentials is available and set */
+    if ( 0 == mSettings->value("saveCredentials","").toString().compare("true", Qt::CaseInsensitive) )
+    {
+        mSaveCredentials = true;
+    }
+
+    /* Read all channels from config file */
+    int channelCount = mSettings->beginReadArray("channels");
+
+    for (int i =  0; i<channelCount; i++)
+    {
+        mSettings->setArrayIndex(i);
+
+        /* Read a channel name and if the channel should be connected on startup */
+        QString currentChannel = mSettings->value("channelName","").toString();
+        QString currentChannelDefualtConnect = mSettings->value("channelDefaultConnect","").toString();
+
+        /* Remove whitespaces from channel name */
+        currentChannel = currentChannel.simplified().replace(" ","");
+
+        /* Check if defualt connect is true */
+        currentChannelDefualtConnect = currentChannelDefualtConnect.simplified().replace(" ","");
+
+        bool defaultConnect = false;
+        if ( 0 == currentChannelDefualtConnect.compare("true", Qt::CaseInsensitive) )
+        {
+            defaultConnect = true;
+        }
+
+        /* Create objects for every channel */
+        if ( !currentChannel.isEmpty() )
+        {
+            QStandardItem* channel = new QStandardItem(currentChannel);
+            channel->setCheckable(true);
+            channel->setIcon(QIcon(":/icons/images/NOK.png"));
+
+            if (defaultConnect == true)
+            {
+                channel->setCheckState(Qt::Checked);
+            }
+            else
+            {
+                channel->setCheckState(Qt::Unchecked);
+            }
+
+            mChannelModel->appendRow(channel);
+        }
+
+    }
+
+    /* Complete array */
+    mSettings->endArray();
+
+    /* Get the count of the users of the config file */
+    int userCount = mSettings->beginReadArray("users");
+
+    /* Iterate over all users */
+    for (int i=0; i<userCount; i++)
+    {
+        mSettings->setArrayIndex(i);
+
+        /* Read user properties from config file */
+        QString userTimestamp = mSettings->value("timestamp").toString();
+        QString userName = mSettings->value("username").toString().simplified().replace(" ","");
+        QString userChannels = mSettings->value("channelNames").toString().simplified().replace(" ","");
+        QString userBanReason = mSettings->value("banReason").toString();
+        QString userURLReason = mSettings->value("banURL").toString();
+        QString userEvidence = mSettings->value("banEvidence").toString();
+
+        /* Create a item form timestamp */
+        QStandardItem* userTimestampItem = new QStandardItem();
+        userTimestampItem->setText(userTimestamp);
+
+        /* Create a item form username */
+        QStandardItem* userNameItem = new QStandardItem();
+        userNameItem->setText(userName);
+
+        /* Create a item form channels */
+        QStandardItem* userChannelsItem = new QStandardItem();
+        userChannelsItem->setText(userChannels);
+
+        /* Create a item form ban reason */
+        QStandardItem* userBanReasonItem = new QStandardItem();
+        userBanReasonItem->setText(userBanReason);
+
+        /* Create a item form URL */
+        QStandardItem* userURLReasonItem = new QStandardItem();
+        userURLReasonItem->setText(userURLReason);
+
+        /* Create a item form the recent messages of the user */
+        QStandardItem* userEvidenceItem = new QStandardItem();
+        userEvidenceItem->setText(userEvidence);
+        userEvidenceItem->setToolTip(userEvidence);
+
+        /* Create a list of all items */
+        QList<QStandardItem*> userRowList;
+
+        /* Push all created items into the list */
+        userRowList << userTimestampItem << userNameItem << userChannelsItem << userBanReasonItem << userURLReasonItem << userEvidenceItem;
+
+        /* Add a row based on the list created */
+        mUserModel->appendRow(userRowList);
+    }
+
+    /* Complete array */
+    mSettings->endArray();
+
+    /*=================================================================*/
+    /*===                        Connections                        ===*/
+    /*=================================================================*/
+
+    /* If the model changed call the corresponding notification method */
+    connect(mChannelModel, SIGNAL(itemChanged(QStandardItem*)),       this, SLOT(channelModelItemChanged(QStandardItem*)));
+    connect(mChannelModel, SIGNAL(rowsRemoved(QModelIndex,int,int)),  this, SLOT(channelRowsChanged(QModelIndex,int,int)));
+    connect(mChannelModel, SIGNAL(rowsInserted(QModelIndex,int,int)), this, SLOT(channelRowsChanged(QModelIndex,int,int)));
+
+    connect(mUserModel, SIGNAL(itemChanged(QStandardItem*)),       this, SLOT(userModelItemChanged(QStandardItem*)));
+    connect(mUserModel, SIGNAL(rowsRemoved(QModelIndex,int,int)),  this, SLOT(userRowsChanged(QModelIndex,int,int)));
+    connect(mUserModel, SIGNAL(rowsInserted(QModelIndex,int,int)), this, SLOT(userRowsChanged(QModelIndex,int,int)));
+
+    /* Let the ui load and get credentials afterwards */
+    QTimer::singleShot(0,this,SLOT(loginConnect()));
+
+}
+
+/**
+ * /brief ~MainWindowContent definition
+ */
+MainWindowContent::~MainWindowContent()
+{
+    /* Check for null pointer and delete all objects from heap */
+
+    /* The watchdogs are stopped before the watched threads */
+    if (nullptr != mGuiWatchdog)
+    {
+        delete mGuiWatchdog;
+    }
+
+    if (nullptr != mConnectorWatchdog)
+    {
+        delete mConnectorWatchdog;
+    }
+
+    if (nullptr != mIconRightDelegate)
+    {
+        delete mIconRightDelegate;
+    }
+
+    if (nullptr != mChannelModel)
+    {
+        delete mChannelModel;
+    }
+
+    if (nullptr != mSettings)
+    {
+        delete mSettings;
+    }
+
+    if (nullptr != mUserModel)
+    {
+        delete mUserModel;
+    }
+
+    if (nullptr != mSuggestionModel)
+    {
+        delete mSuggestionModel;
+    }
+
+    if (nullptr != mSearchModel)
+    {
+        delete mSearchModel;
+    }
+
+    if (nullptr != ui)
+    {
+        delete ui;
+    }
+
+    /* The connector is deleted by its thread when the thread has finished */
+    if (nullptr != mConnectorThread)
+    {
+        mConnectorThread->quit();
+        mConnectorThread->wait();
+    }
+
+}
+
+/**
+ * /brief on_addChannelButton_clicked definition
+ */
+void MainWindowContent::on_addChannelButton_clicked()
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("MainWindowContent::on_addChannelButton_clicked");
+
+    /* We need a new window for the user to enter the information regarding the new channel */
+    FramelessWindow addChannelWindow;
+    AddChannelDialog addChannelDialog;
+
+    /* Set the window title */
+    addChannelWindow.setWindowTitle("Add Channel");
+
+    /* Set the content of the frameless window to our 'add channel dialog' */
+    addChannelWindow.setContent(&addChannelDialog);
+
+    /* Block the main program until the user entered the channel information */
+    addChannelWindow.exec();
+
+    /* Proceed only if the dialog was accepted */
+    if ( 1 == addChannelDialog.result())
+    {
+        /* First check if the channel is already added */
+        QString channelName = addChannelDialog.GetChannel().simplified().replace(" ","");
+        for (int i =0; i<mChannelModel->rowCount(); i++)
+        {
+            /* Compare channel name with all channels in the model */
+            if (mChannelModel->item(i)->text().compare(channelName)==0)
+            {
+                /* If channel is already in the list, nothing to do */
+                return;
+            }
+        }
+
+        /* Remove all whitespaces from entered channel name and check if it's not empty */
+        if ( !addChannelDialog.GetChannel().simplified().replace(" ","").isEmpty() )
+        {
+            /* Create a new channel object and put it into the channel model */
+            QStandardItem* newTwichChannel = new QStandardItem(channelName);
+            newTwichChannel->setCheckable(true);
+            newTwichChannel->setIcon(QIcon(":/icons/images/NOK.png"));
+
+            if (addChannelDialog.GetDefaultConnect() == true)
+            {
+                newTwichChannel->setCheckState(Qt::Checked);
+            }
+            else
+            {
+                newTwichChannel->setCheckState(Qt::Unchecked);
+            }
+
+            mChannelModel->appendRow(newTwichChannel);
+
+            /* To keep an alphabetical order sort the channel model */
+            mChannelModel->sort(0);
+        }
+    }
+
+
+}
+
+/**
+ * /brief on_removeChannelButton_clicked definition
+ */
+void MainWindowContent::on_removeChannelButton_clicked()
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("MainWindowContent::on_removeChannelButton_clicked");
+
+    /* Get the selection model and the list of selected items from model */
+    QItemSelectionModel* selectionModel = ui->channels->selectionModel();
+    QModelIndexList selectedChannels = selectionModel->selectedRows();
+
+    /* Delete all selected channels */
+    for (int i=0; i<selectedChannels.count(); i++)
+    {
+        /* Get the index of a selected channel */
+        QModelIndex channelIndex =  selectedChannels.at(i);
+
+        /* Remove the selected channel (by index) and take over ownership */
+        QList<QStandardItem*> rowsToRemove = mChannelModel->takeRow(channelIndex.row());
+
+        /* Also it is one row we need to satisfy the Qt's API and iterate over all entries from takerow */
+        for (int j = 0; j<rowsToRemove.count(); j++)
+        {
+            /* Conversion from the QStandardItem to our own implementation */
+            QStandardItem* toRemove = rowsToRemove.at(j);
+
+            /* Finally delete the Twich channel object complete from heap */
+            delete toRemove;
+        }
+
+        /* To keep an alphabetical order sort the channel model */
+        mChannelModel->sort(0);
+
+    }
+
+}
+
+/**
+ * /brief rewriteChannelSettings definition
+ */
+void MainWindowContent::rewriteChannelSettings()
+{
+    /* Store the whole channel model into the config file */
+    SettingsWriter::WriteChannels(mSettings, mChannelModel);
+}
+
+/**
+ * /brief rewriteUserSettings definition
+ */
+void MainWindowContent::rewriteUserSettings()
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("MainWindowContent::rewriteUserSettings");
+
+    /* Trace the rewrite of the user settings */
+    TRACE_SPAN("MainWindowContent::rewriteUserSettings");
+
+    /* Store the whole user model into the config file */
+    SettingsWriter::WriteUsers(mSettings, mUserModel);
+}
+
+/**
+ * /brief loginConnect definition
+ */
+void MainWindowContent::loginConnect(bool forceDialog)
+{
+    /* Check if it is necessary to show a credentials dialog */
+    if ( mSaveCredentials == false ||
+         mOauth2.isEmpty() ||
+         mLoginName.isEmpty() ||
+         forceDialog == true )
+    {
+        /* We need a new window for the user to enter the information regarding the login data */
+        FramelessWindow loginWindow;
+        LoginWindow loginDialog;
+
+        /* Set the window title */
+        loginWindow.setWindowTitle("User Credentials");
+
+        /* Set the content of the frameless window to our 'login dialog' */
+        loginWindow.setContent(&loginDialog);
+
+        /* For convenience reason set the current settings to the ui elements */
+        loginDialog.SetLoginName(mLoginName);
+        loginDialog.SetOAuth2Name(mOauth2);
+        loginDialog.SetSaveCredentials(mSaveCredentials);
+
+        /* Block the main program until the user credential information */
+        loginWindow.exec();
+
+        /* Get the values from dialog */
+        mLoginName = loginDialog.GetLoginName();
+        mOauth2 = loginDialog.GetOAuth2();
+        mSaveCredentials = loginDialog.GetSaveCredentials();
+    }
+
+    /* Check if the credentials shall be saved */
+    if (mSaveCredentials)
+    {
+        /* Save credentials to file */
+        mSettings->setValue("loginName",mLoginName);
+        mSettings->setValue("oauth2",mOauth2);
+        mSettings->setValue("saveCredentials","true");
+    }
+    else
+    {
+        /* If credentials shall not be saved empty the config */
+        mSettings->setValue("loginName","");
+        mSettings->setValue("oauth2","");
+        mSettings->setValue("saveCredentials","false");
+    }
+
+    /* Create a new connector to twitch if necessary */
+    if ( mTwitchConnector == nullptr )
+    {
+        /* The twitch service can be overridden by the config file (e.g. to use the local mock service) */
+        QString serverHost = mSettings->value("serverHost", "irc.twitch.tv").toString();
+        quint16 serverPort = (quint16)mSettings->value("serverPort", 6667).toUInt();
+
+        mTwitchConnector = new TwitchConnector( serverHost,
+                                                serverPort,
+                                                mLoginName,
+                                                mOauth2 );
+
+        /* Record the raw traffic if a session file is configured */
+        QString recordFile = mSettings->value("recordFile", "").toString();
+        if ( !recordFile.isEmpty() )
+        {
+            mTwitchConnector->StartRecording(recordFile);
+        }
+
+        /* Write the audit log of the raw traffic if a log file is configured */
+        QString trafficLogFile = mSettings->value("trafficLogFile", "").toString();
+        if ( !trafficLogFile.isEmpty() )
+        {
+            mTwitchConnector->StartTrafficLog(trafficLogFile,
+                                              mSettings->value("trafficLogMaxBytes", TRAFFIC_LOG_DEFAULT_MAX_BYTES).toLongLong(),
+                                              mSettings->value("trafficLogInterval", TRAFFIC_LOG_DEFAULT_INTERVAL).toInt(),
+                                              0 == mSettings->value("trafficLogCompress","").toString().compare("true", Qt::CaseInsensitive));
+        }
+
+        /* Pass the bans of the history, the ban fan-out skips the channels where a user is banned already */
+        for (int i=0; i<mUserModel->rowCount(); i++)
+        {
+            mTwitchConnector->AddKnownBans(mUserModel->item(i,1)->text(),
+                                           mUserModel->item(i,2)->text().split(';',QString::SkipEmptyParts).toSet());
+        }
+
+        /* Add the further moderator accounts of the config file, the bans are spread across their rate limits */
+        int accountCount = mSettings->beginReadArray("accounts");
+        for (int i=0; i<accountCount; i++)
+        {
+            mSettings->setArrayIndex(i);
+
+            QString accountName = mSettings->value("loginName","").toString().simplified().replace(" ","");
+            QString accountOauth2 = mSettings->value("oauth2","").toString();
+            if ( !accountName.isEmpty() && !accountOauth2.isEmpty() )
+            {
+                mTwitchConnector->AddAccount(accountName, accountOauth2);
+            }
+        }
+        mSettings->endArray();
+
+        /* Keep a warm standby connection which takes over at once if the connection is lost */
+        mTwitchConnector->SetStandby( 0 == mSettings->value("standbyConnection","").toString().compare("true", Qt::CaseInsensitive) );
+
+        /* Move the connector to its own thread, so socket handling and ui painting don't delay each other */
+        mConnectorThread = new QThread(this);
+        mConnectorThread->setObjectName("TwitchConnector");
+        mTwitchConnector->moveToThread(mConnectorThread);
+        connect(mConnectorThread, SIGNAL(finished()), mTwitchConnector, SLOT(deleteLater()));
+
+        /* Connect the connector signals to the corresponding ui methods (queued to the ui thread) */
+        connect(mTwitchConnector, SIGNAL(stateChanged(ConnectionState)),        this, SLOT(connectionStateChanged(ConnectionState)));
+        connect(mTwitchConnector, SIGNAL(channelJoined(QString)),               this, SLOT(channelJoined(QString)));
+        connect(mTwitchConnector, SIGNAL(channelParted(QString)),               this, SLOT(channelParted(QString)));
+        connect(mTwitchConnector, SIGNAL(moderatorChanged(QString,bool)),       this, SLOT(moderatorChanged(QString,bool)));
+        connect(mTwitchConnector, SIGNAL(userBanned(QString,QSet<QString>,QStringList,int)), this, SLOT(userBanned(QString,QSet<QString>,QStringList,int)));
+        connect(mTwitchConnector, SIGNAL(userUnbanned(QString,QSet<QString>,int)),  this, SLOT(userUnbanned(QString,QSet<QString>,int)));
+        connect(mTwitchConnector, SIGNAL(commandFailed(QString,QString,QString,QString)), this, SLOT(commandFailed(QString,QString,QString,QString)));
+        connect(mTwitchConnector, SIGNAL(commandAcknowledged(QString,QString,QString)), this, SLOT(commandAcknowledged(QString,QString,QString)));
+        connect(mTwitchConnector, SIGNAL(failedOver(int)),                      this, SLOT(failedOver(int)));
+        connect(mTwitchConnector, SIGNAL(keywordMatched(QString,QString,QString,QString)), this, SLOT(keywordMatched(QString,QString,QString,QString)));
+        connect(mTwitchConnector, SIGNAL(spamWaveDetected(QString,QSet<QString>,QString)), this, SLOT(spamWaveDetected(QString,QSet<QString>,QString)));
+        connect(mTwitchConnector, SIGNAL(rateExceeded(QString,QString,int,int,QString)),   this, SLOT(rateExceeded(QString,QString,int,int,QString)));
+        connect(mTwitchConnector, SIGNAL(raidDetected(QString,QStringList,int,double)),    this, SLOT(raidDetected(QString,QStringList,int,double)));
+        connect(mTwitchConnector, SIGNAL(usernameCompleted(QString,QStringList)), this, SLOT(usernameCompleted(QString,QStringList)));
+        connect(mTwitchConnector, SIGNAL(chatSearched(QString,QString,QList<ChatIndexHit>)), this, SLOT(chatSearched(QString,QString,QList<ChatIndexHit>)));
+        connect(mTwitchConnector, SIGNAL(banListMatched(QString,QString)),      this, SLOT(banListMatched(QString,QString)));
+        connect(mTwitchConnector, SIGNAL(banListLoaded(QString,int,qint64,double)), this, SLOT(banListLoaded(QString,int,qint64,double)));
+        connect(mTwitchConnector, SIGNAL(banListMetricsReported(BanListMetrics)), this, SLOT(banListMetricsReported(BanListMetrics)));
+        connect(mTwitchConnector, SIGNAL(usernamePatternMatched(QString,QString,QString)), this, SLOT(usernamePatternMatched(QString,QString,QString)));
+        connect(mTwitchConnector, SIGNAL(usernamePatternsLoaded(QString,int,QString)),     this, SLOT(usernamePatternsLoaded(QString,int,QString)));
+
+        /* Connect the ui requests to the corresponding connector methods (queued to the connector thread) */
+        connect(this, SIGNAL(connectRequested()),              mTwitchConnector, SLOT(Connect()));
+        connect(this, SIGNAL(disconnectRequested()),           mTwitchConnector, SLOT(Disconnect()));
+        connect(this, SIGNAL(channelsChanged(QSet<QString>)),  mTwitchConnector, SLOT(SetChannels(QSet<QString>)));
+        connect(this, SIGNAL(loginNameChanged(QString)),       mTwitchConnector, SLOT(SetLoginName(QString)));
+        connect(this, SIGNAL(oauth2Changed(QString)),          mTwitchConnector, SLOT(SetOauth2(QString)));
+        connect(this, SIGNAL(banRequested(QString)),           mTwitchConnector, SLOT(banUser(QString)));
+        connect(this, SIGNAL(unbanRequested(QString)),         mTwitchConnector, SLOT(unbanUser(QString)));
+        connect(this, SIGNAL(searchRequested(QString,QString)), mTwitchConnector, SLOT(SearchChat(QString,QString)));
+        connect(this, SIGNAL(usernameCompletionRequested(QString,int)), mTwitchConnector, SLOT(CompleteUsername(QString,int)));
+        connect(this, SIGNAL(keywordsChanged(QStringList)),    mTwitchConnector, SLOT(SetKeywords(QStringList)));
+        connect(this, SIGNAL(autoBanChanged(bool)),            mTwitchConnector, SLOT(SetAutoBan(bool)));
+        connect(this, SIGNAL(targetedBanChanged(bool)),        mTwitchConnector, SLOT(SetTargetedBan(bool)));
+        connect(this, SIGNAL(spamWaveThresholdChanged(int,int)), mTwitchConnector, SLOT(SetSpamWaveThreshold(int,int)));
+        connect(this, SIGNAL(rateLimitsChanged(int,int)),      mTwitchConnector, SLOT(SetRateLimits(int,int)));
+        connect(this, SIGNAL(raidThresholdChanged(int,int)),   mTwitchConnector, SLOT(SetRaidThreshold(int,int)));
+        connect(this, SIGNAL(banListChanged(QString,double,qint64)), mTwitchConnector, SLOT(SetBanList(QString,double,qint64)));
+        connect(this, SIGNAL(banListMetricsRequested()),       mTwitchConnector, SLOT(GetBanListMetrics()));
+        connect(this, SIGNAL(usernamePatternsChanged(QString)),  mTwitchConnector, SLOT(SetUsernamePatterns(QString)));
+
+        /* Start the connector thread and watch its event loop */
+        mConnectorThread->start();
+        mConnectorWatchdog = new StallWatchdog(mConnectorThread, mStallThreshold);
+
+        /* Pass the channels and the chat monitoring settings to the connector and set the ui elements to disconnected */
+        updateConnectorChannels();
+        emit keywordsChanged(mKeywords);
+        emit autoBanChanged(mAutoBan);
+        emit targetedBanChanged(mTargetedBan);
+        emit spamWaveThresholdChanged(mSpamWaveChannels, mSpamWaveWindow);
+        emit rateLimitsChanged(mRateLimitShort, mRateLimitLong);
+        emit raidThresholdChanged(mRaidFactor, mRaidMinJoins);
+
+        /* Load the banlist in the background if a banlist file is configured */
+        QString banListFile = mSettings->value("banListFile", "").toString();
+        if ( !banListFile.isEmpty() )
+        {
+            mBanListFile = banListFile;
+            emit banListChanged(banListFile,
+                                mSettings->value("banListFilterRate", BANLIST_DEFAULT_FILTER_RATE).toDouble(),
+                                mSettings->value("banListFilterBytes", BANLIST_DEFAULT_FILTER_BYTES).toLongLong());
+        }
+
+        /* Compile the username patterns if a pattern file is configured */
+        QString usernamePatternFile = mSettings->value("usernamePatternFile", "").toString();
+        if ( !usernamePatternFile.isEmpty() )
+        {
+            emit usernamePatternsChanged(usernamePatternFile);
+        }
+        connectionStateChanged(DISCONNECTED);
+    }
+    else
+    {
+        /* Update login name and oauth2 of the twitch connector */
+        emit loginNameChanged(mLoginName);
+        emit oauth2Changed(mOauth2);
+    }
+}
+
+/**
+ * /brief channelModelItemChanged definition
+ */
+void MainWindowContent::channelModelItemChanged(QStandardItem *item)
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("MainWindowContent::channelModelItemChanged");
+
+    /* Update settings file */
+    rewriteChannelSettings();
+
+    /* Update the channels of the connector */
+    updateConnectorChannels();
+}
+
+/**
+ * /brief channelRowsChanged definition
+ */
+void MainWindowContent::channelRowsChanged(const QModelIndex &parent, int start, int end)
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("MainWindowContent::channelRowsChanged");
+
+    /* Update settings file */
+    rewriteChannelSettings();
+
+    /* Update the channels of the connector */
+    updateConnectorChannels();
+}
+
+/**
+ * /brief updateConnectorChannels definition
+ */
+void MainWindowContent::updateConnectorChannels()
+{
+    /* The connector is created after the ui is loaded */
+    if (mTwitchConnector == nullptr)
+    {
+        return;
+    }
+
+    /* Gather all channels with a checked check box */
+    QSet<QString> channels;
+    for (int i=0; i<mChannelModel->rowCount(); i++)
+    {
+        if ( Qt::Checked == mChannelModel->item(i)->checkState() )
+        {
+            channels.insert(mChannelModel->item(i)->text());
+        }
+    }
+
+    /* Pass the channels to the connector thread */
+    emit channelsChanged(channels);
+}
+
+/**
+ * /brief connectionStateChanged definition
+ */
+void MainWindowContent::connectionStateChanged(ConnectionState state)
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("MainWindowContent::connectionStateChanged");
+
+    /* Keep track of the state of the connector thread */
+    mConnectionState = state;
+
+    if (state == CONNECTING)
+    {
+        /* Set connection icon to connecting */
+        ui->connectionIcon->setPixmap(QIcon(":/icons/images/refresh.png").pixmap(16,16));
+
+        /* Disable the connection button while connecting */
+        ui->connectButton->setEnabled(false);
+
+        /* Change the connect button text to connecting */
+        ui->connectButton->setText("Connecting");
+    }
+    else if (state == CONNECTED)
+    {
+        /* Set connection icon to connected */
+        ui->connectionIcon->setPixmap(QIcon(":/icons/images/OK.png").pixmap(32,32));
+
+        /* Enable the connection button */
+        ui->connectButton->setEnabled(true);
+
+        /* Change the connect button text to disconnect */
+        ui->connectButton->setText("Disconnect");
+    }
+    else
+    {
+        /* Set connection icon to disconnected */
+        ui->connectionIcon->setPixmap(QIcon(":/icons/images/NOK.png").pixmap(32,32));
+
+        /* Enable the connection button */
+        ui->connectButton->setEnabled(true);
+
+        /* Change the connect button text to connect */
+        ui->connectButton->setText("Connect");
+
+        /* Iterate over all channel items */
+        for (int i=0; i<mChannelModel->rowCount(); i++)
+        {
+            /* Set all channel icons to disconnected and forget the moderator status */
+            mChannelModel->item(i)->setIcon(QIcon(":/icons/images/NOK.png"));
+            mChannelModel->item(i)->setForeground(QBrush());
+            mChannelModel->item(i)->setToolTip("");
+        }
+    }
+}
+
+/**
+ * /brief channelJoined definition
+ */
+void MainWindowContent::channelJoined(QString channel)
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("MainWindowContent::channelJoined");
+
+    /* Trace the channel model update */
+    TRACE_SPAN("MainWindowContent::channelJoined");
+
+    /* Iterate over all channel items */
+    for (int i=0; i<mChannelModel->rowCount(); i++)
+    {
+        /* If channel name matches set the channel icon to OK */
+        if ( 0 == mChannelModel->item(i)->text().compare(channel) )
+        {
+            mChannelModel->item(i)->setIcon(QIcon(":/icons/images/OK.png"));
+        }
+    }
+}
+
+/**
+ * /brief channelParted definition
+ */
+void MainWindowContent::channelParted(QString channel)
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("MainWindowContent::channelParted");
+
+    /* Iterate over all channel items */
+    for (int i=0; i<mChannelModel->rowCount(); i++)
+    {
+        /* If channel name matches set the channel icon to NOK and forget the moderator status */
+        if ( 0 == mChannelModel->item(i)->text().compare(channel) )
+        {
+            mChannelModel->item(i)->setIcon(QIcon(":/icons/images/NOK.png"));
+            mChannelModel->item(i)->setForeground(QBrush());
+            mChannelModel->item(i)->setToolTip("");
+        }
+    }
+}
+
+/**
+ * /brief moderatorChanged definition
+ */
+void MainWindowContent::moderatorChanged(QString channel, bool moderator)
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("MainWindowContent::moderatorChanged");
+
+    /* Iterate over all channel items */
+    for (int i=0; i<mChannelModel->rowCount(); i++)
+    {
+        /* If channel name matches mark the channel, the status is the one of the primary account (a further account may still moderate the channel) */
+        if ( 0 == mChannelModel->item(i)->text().compare(channel) )
+        {
+            mChannelModel->item(i)->setForeground(moderator ? QBrush() : QBrush(Qt::gray));
+            mChannelModel->item(i)->setToolTip(moderator ? "The primary account is a moderator" : "The primary account is not a moderator, bans are only sent by further accounts which moderate this channel");
+        }
+    }
+}
+
+/**
+ * /brief userModelItemChanged definition
+ */
+void MainWindowContent::userModelItemChanged(QStandardItem *item)
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("MainWindowContent::userModelItemChanged");
+
+    /* Update settings file */
+    rewriteUserSettings();
+}
+
+/**
+ * /brief userRowsChanged definition
+ */
+void MainWindowContent::userRowsChanged(const QModelIndex &parent, int start, int end)
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("MainWindowContent::userRowsChanged");
+
+    /* Update settings file */
+    rewriteUserSettings();
+}
+
+/**
+ * /brief on_users_clicked definition
+ */
+void MainWindowContent::on_users_clicked(const QModelIndex &index)
+{
+    /* Make only the reason column editable and get the current flags from model */
+    Qt::ItemFlags flags = mUserModel->itemFromIndex(index)->flags();
+
+    /* If column "Reason" or "URL" is selected set item to editable else forbid editing of cells */
+    if (index.column() == 3 || index.column() == 4)
+    {
+        flags |= Qt::ItemIsEditable;
+    }
+    else
+    {
+        flags &= ~Qt::ItemIsEditable;
+    }
+
+    /* Set the new flags to model */
+    mUserModel->itemFromIndex(index)->setFlags(flags);
+
+    /* Based of the row selected set the username and reason line edit to the selected value (UX reasons) */
+    ui->usernameLineEdit->setText( mUserModel->item(index.row(),1)->text() );
+    ui->reasonLineEdit->setText( mUserModel->item(index.row(),3)->text() );
+}
+
+/**
+ * /brief getCurrentTimestamp definition
+ */
+QString MainWindowContent::getCurrentTimestamp()
+{
+    /* Define the time/date format */
+    QString date = QDate::currentDate().toString("yyyy.MM.dd");
+    QString time = QTime::currentTime().toString("hh:mm:ss");
+
+    /* Concatenate date and time and return the string */
+    return date.append(" ").append(time);
+}
+
+/**
+ * /brief on_usernameLineEdit_textEdited definition
+ */
+void MainWindowContent::on_usernameLineEdit_textEdited(const QString& text)
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("MainWindowContent::on_usernameLineEdit_textEdited");
+
+    QString prefix = text.simplified().replace(" ","");
+    if ( prefix.isEmpty() || mTwitchConnector == nullptr )
+    {
+        mUsernameCompleterModel->setStringList(QStringList());
+        return;
+    }
+
+    /* The index lives in the connector thread, the matching users are reported by usernameCompleted */
+    emit usernameCompletionRequested(prefix, USERNAME_COMPLETER_COUNT);
+}
+
+/**
+ * /brief usernameCompleted definition
+ */
+void MainWindowContent::usernameCompleted(QString prefix, QStringList names)
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("MainWindowContent::usernameCompleted");
+
+    /* Drop the answer if the user has typed on in the meantime */
+    if ( prefix != ui->usernameLineEdit->text().simplified().replace(" ","") )
+    {
+        return;
+    }
+
+    /* Offer the first matching users of the index, the completer only shows them */
+    mUsernameCompleterModel->setStringList(names);
+    if ( !names.isEmpty() && ui->usernameLineEdit->hasFocus() )
+    {
+        mUsernameCompleter->complete();
+    }
+}
+
+/**
+ * /brief chatSearched definition
+ */
+void MainWindowContent::chatSearched(QString username, QString terms, QList<ChatIndexHit> hits)
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("MainWindowContent::chatSearched");
+
+    /* Replace the previous results */
+    mSearchModel->removeRows(0, mSearchModel->rowCount());
+
+    foreach (const ChatIndexHit& hit, hits)
+    {
+        QList<QStandardItem*> newRow;
+        newRow << new QStandardItem(QDateTime::fromMSecsSinceEpoch(hit.timestamp).toString("yyyy.MM.dd hh:mm:ss"))
+               << new QStandardItem(hit.channel)
+               << new QStandardItem(hit.userName)
+               << new QStandardItem(hit.text);
+        mSearchModel->appendRow(newRow);
+    }
+}
+
+/**
+ * /brief on_searchButton_clicked definition
+ */
+void MainWindowContent::on_searchButton_clicked()
+{
+    QString username = ui->searchUserLineEdit->text().simplified().replace(" ","");
+    QString terms = ui->searchTermsLineEdit->text().simplified();
+
+    /* Nothing to search for */
+    if ( username.isEmpty() && terms.isEmpty() )
+    {
+        return;
+    }
+
+    /* Request the search from the connector thread, the result is reported by chatSearched */
+    emit searchRequested(username, terms);
+}
+
+/**
+ * /brief on_searchUserLineEdit_returnPressed definition
+ */
+void MainWindowContent::on_searchUserLineEdit_returnPressed()
+{
+    on_searchButton_clicked();
+}
+
+/**
+ * /brief on_searchTermsLineEdit_returnPressed definition
+ */
+void MainWindowContent::on_searchTermsLineEdit_returnPressed()
+{
+    on_searchButton_clicked();
+}
+
+/**
+ * /brief on_clearSearchButton_clicked definition
+ */
+void MainWindowContent::on_clearSearchButton_clicked()
+{
+    /* Remove all results and the search */
+    mSearchModel->removeRows(0, mSearchModel->rowCount());
+    ui->searchUserLineEdit->clear();
+    ui->searchTermsLineEdit->clear();
+}
+
+/**
+ * /brief on_searchResults_doubleClicked definition
+ */
+void MainWindowContent::on_searchResults_doubleClicked(const QModelIndex &index)
+{
+    /* Take the author over into the ban form of the user list */
+    ui->usernameLineEdit->setText(mSearchModel->item(index.row(),2)->text());
+    ui->UserModsTabWidget->setCurrentWidget(ui->userTab);
+}
+
+/**
+ * /brief on_banUserButton_clicked definition
+ */
+void MainWindowContent::on_banUserButton_clicked()
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("MainWindowContent::on_banUserButton_clicked");
+
+    /* First of all check if the username is formally correct */
+    QString username = ui->usernameLineEdit->text();
+    username = username.simplified().replace(" ","");
+
+    /* If username is incorrect do nothing */
+    if (username.isEmpty())
+    {
+        return;
+    }
+
+    /* Despite the username the reason is allowed to leave empty */
+    QString banReason = ui->reasonLineEdit->text();
+
+    /* Despite the username the url is allowed to leave empty */
+    QString urlReason = ui->urlReasonLineEdit->text();
+
+    /* Keep the reason and url until the connector reports the ban */
+    mPendingBanReasons.insert(username, QStringList() << banReason << urlReason);
+
+    /* Request the ban on all connected channels from the connector thread */
+    emit banRequested(username);
+}
+
+/**
+ * /brief userBanned definition
+ */
+void MainWindowContent::userBanned(QString username, QSet<QString> channelSet, QStringList messages, int skipped)
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("MainWindowContent::userBanned");
+
+    /* Trace the user model update */
+    TRACE_SPAN("MainWindowContent::userBanned");
+
+    /* Take the reason and url entered for this ban (every request is answered, even without a queued channel) */
+    QStringList banReasons = mPendingBanReasons.take(username);
+    QString banReason = banReasons.value(0);
+    QString urlReason = banReasons.value(1);
+
+    if (skipped > 0)
+    {
+        logEvent(QString("Ban of %1 skipped in %2 channels where the user is already banned").arg(username).arg(skipped));
+    }
+
+    /* If there is no channel ban queued, do not track the user in the list */
+    if (channelSet.isEmpty())
+    {
+        return;
+    }
+
+    /* The channels are added to the row once twitch acknowledges the ban */
+    mPendingBans[username] += channelSet;
+    mPendingUnbans[username] -= channelSet;
+
+    /* Recent messages of the user, one per line */
+    QString banEvidence = messages.join("\n");
+
+    /* Based on if we found a user reuse the row, otherwise create a new row */
+    int rowFound = findUserRow(username);
+    if (rowFound != -1)
+    {
+        /* Keep the tracked reason if the ban has not been requested by the ui */
+        if ( !banReasons.isEmpty() )
+        {
+            mUserModel->item(rowFound,3)->setText(banReason);
+            mUserModel->item(rowFound,4)->setText(urlReason);
+        }
+
+        /* Keep the previous evidence if the user has not written anything since */
+        if ( !banEvidence.isEmpty() )
+        {
+            mUserModel->item(rowFound,5)->setText(banEvidence);
+            mUserModel->item(rowFound,5)->setToolTip(banEvidence);
+        }
+
+        /* Update timestamp */
+        mUserModel->item(rowFound,0)->setText(getCurrentTimestamp());
+    }
+    else
+    {
+        appendUserRow(username, banReason, urlReason, banEvidence);
+    }
+
+    /* Show the channels which wait for the acknowledgement */
+    updatePendingChannels(username);
+}
+
+/**
+ * /brief on_unbanUserButton_clicked definition
+ */
+void MainWindowContent::on_unbanUserButton_clicked()
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("MainWindowContent::on_unbanUserButton_clicked");
+
+    /* First of all check if the username is formally correct */
+    QString username = ui->usernameLineEdit->text();
+    username = username.simplified().replace(" ","");
+
+    /* If username is incorrect do nothing */
+    if (username.isEmpty())
+    {
+        return;
+    }
+
+    /* Request the unban on all connected channels from the connector thread */
+    emit unbanRequested(username);
+}
+
+/**
+ * /brief userUnbanned definition
+ */
+void MainWindowContent::userUnbanned(QString username, QSet<QString> channelSet, int skipped)
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("MainWindowContent::userUnbanned");
+
+    if (skipped > 0)
+    {
+        logEvent(QString("Unban of %1 skipped in %2 channels where no ban is known").arg(username).arg(skipped));
+    }
+
+    /* If there is no channel unban queued, do nothing */
+    if (channelSet.isEmpty())
+    {
+        return;
+    }
+
+    /* The channels are removed from the row once twitch acknowledges the unban */
+    mPendingUnbans[username] += channelSet;
+    mPendingBans[username] -= channelSet;
+
+    /* Show the channels which wait for the acknowledgement */
+    updatePendingChannels(username);
+}
+
+/**
+ * /brief commandAcknowledged definition
+ */
+void MainWindowContent::commandAcknowledged(QString command, QString userName, QString channel)
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("MainWindowContent::commandAcknowledged");
+
+    if ( command == ".ban" )
+    {
+        mPendingBans[userName].remove(channel);
+
+        /* The row may have been removed in the meantime, the ban is in place anyway */
+        int row = findUserRow(userName);
+        if (row == -1)
+        {
+            row = appendUserRow(userName, "", "", "");
+        }
+
+        /* Update ban list --> ';' separated string of channels */
+        QStringList currentChannels = mUserModel->item(row,2)->text().split(';',QString::SkipEmptyParts);
+        if ( !currentChannels.contains(channel) )
+        {
+            currentChannels << channel;
+            mUserModel->item(row,2)->setText(currentChannels.join(';'));
+        }
+    }
+    else if ( command == ".unban" )
+    {
+        mPendingUnbans[userName].remove(channel);
+        removeBannedChannel(userName, channel);
+    }
+
+    /* Show the channels which still wait for the acknowledgement */
+    updatePendingChannels(userName);
+}
+
+/**
+ * /brief commandFailed definition
+ */
+void MainWindowContent::commandFailed(QString command, QString userName, QString channel, QString reason)
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("MainWindowContent::commandFailed");
+
+    logEvent(QString("%1 %2 in %3 failed: %4").arg(command).arg(userName).arg(channel).arg(reason), true);
+
+    if ( command == ".ban" )
+    {
+        /* The user hasn't been banned in this channel, a row without any ban is removed */
+        mPendingBans[userName].remove(channel);
+        removeBannedChannel(userName, channel);
+    }
+    else if ( command == ".unban" )
+    {
+        /* The ban is still in place, so the channel stays in the row */
+        mPendingUnbans[userName].remove(channel);
+    }
+
+    /* Show the channels which still wait for the acknowledgement */
+    updatePendingChannels(userName);
+}
+
+/**
+ * /brief findUserRow definition
+ */
+int MainWindowContent::findUserRow(const QString& username)
+{
+    for (int i=0; i<mUserModel->rowCount(); i++)
+    {
+        if (mUserModel->item(i,1)->text().compare(username) == 0)
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * /brief appendUserRow definition
+ */
+int MainWindowContent::appendUserRow(const QString& username, const QString& banReason, const QString& urlReason, const QString& banEvidence)
+{
+    QStandardItem* evidence = new QStandardItem(banEvidence);
+    evidence->setToolTip(banEvidence);
+
+    /* The channels are filled in by the acknowledged bans */
+    QList<QStandardItem*> newRow;
+    newRow << new QStandardItem(getCurrentTimestamp()) << new QStandardItem(username) << new QStandardItem("")
+           << new QStandardItem(banReason) << new QStandardItem(urlReason) << evidence;
+
+    mUserModel->appendRow(newRow);
+
+    return mUserModel->rowCount() - 1;
+}
+
+/**
+ * /brief removeBannedChannel definition
+ */
+void MainWindowContent::removeBannedChannel(const QString& username, const QString& channel)
+{
+    /* If the user is not tracked in the list, tracking is not necessary */
+    int row = findUserRow(username);
+    if (row == -1)
+    {
+        return;
+    }
+
+    /* Get ban list --> ';' separated string of channels */
+    QStringList currentChannels = mUserModel->item(row,2)->text().split(';',QString::SkipEmptyParts);
+    currentChannels.removeAll(channel);
+
+    /* If user isn't banned (or waiting for a ban) at at least one channel remove the entry completely */
+    if ( currentChannels.isEmpty() && mPendingBans.value(username).isEmpty() )
+    {
+        mUserModel->removeRow(row);
+        return;
+    }
+
+    /* Set the remaining channels to the user model */
+    if ( currentChannels.join(';') != mUserModel->item(row,2)->text() )
+    {
+        mUserModel->item(row,2)->setText(currentChannels.join(';'));
+    }
+}
+
+/**
+ * /brief updatePendingChannels definition
+ */
+void MainWindowContent::updatePendingChannels(const QString& username)
+{
+    /* Forget the users without pending commands */
+    QStringList pendingBans = mPendingBans.value(username).toList();
+    QStringList pendingUnbans = mPendingUnbans.value(username).toList();
+    if ( pendingBans.isEmpty() )
+    {
+        mPendingBans.remove(username);
+    }
+    if ( pendingUnbans.isEmpty() )
+    {
+        mPendingUnbans.remove(username);
+    }
+
+    int row = findUserRow(username);
+    if (row == -1)
+    {
+        return;
+    }
+
+    /* The username is grayed out while commands wait for the acknowledgement, the channels are listed in the tooltip */
+    QStringList pending;
+    if ( !pendingBans.isEmpty() )
+    {
+        std::sort(pendingBans.begin(), pendingBans.end());
+        pending << "Ban pending in: " + pendingBans.join(", ");
+    }
+    if ( !pendingUnbans.isEmpty() )
+    {
+        std::sort(pendingUnbans.begin(), pendingUnbans.end());
+        pending << "Unban pending in: " + pendingUnbans.join(", ");
+    }
+
+    QStandardItem* user = mUserModel->item(row,1);
+    if ( user->toolTip() != pending.join("\n") )
+    {
+        user->setToolTip(pending.join("\n"));
+        user->setForeground( pending.isEmpty() ? QBrush() : QBrush(Qt::gray) );
+    }
+}
+
+/**
+ * /brief failedOver definition
+ */
+void MainWindowContent::failedOver(int channels)
+{
+    logEvent(QString("Connection lost, the standby connection took over the moderation commands of %1 channels").arg(channels), true);
+}
+
+/**
+ * /brief keywordMatched definition
+ */
+void MainWindowContent::keywordMatched(QString channel, QString username, QString term, QString message)
+{
+    QString reason = "Keyword: " + term;
+
+    /* The connector bans automatically, so only keep the reason for the ban table */
+    if (mAutoBan)
+    {
+        if ( !mPendingBanReasons.contains(username) )
+        {
+            mPendingBanReasons.insert(username, QStringList() << reason << "");
+        }
+        return;
+    }
+
+    /* Otherwise suggest the ban */
+    addSuggestion(username, channel, reason, message);
+}
+
+/**
+ * /brief spamWaveDetected definition
+ */
+void MainWindowContent::spamWaveDetected(QString username, QSet<QString> channelSet, QString message)
+{
+    QString reason = QString("Spam wave in %1 channels").arg(channelSet.count());
+
+    /* Suggest the ban with all channels of the wave (a ban applies to all connected channels anyway) */
+    foreach (const QString& channel, channelSet)
+    {
+        addSuggestion(username, channel, reason, message);
+    }
+}
+
+/**
+ * /brief rateExceeded definition
+ */
+void MainWindowContent::rateExceeded(QString username, QString channel, int shortCount, int longCount, QString message)
+{
+    /* Suggest the ban with the current rate of the user */
+    addSuggestion(username, channel, QString("Rate: %1 msgs/5s, %2 msgs/60s").arg(shortCount).arg(longCount), message);
+}
+
+/**
+ * /brief raidDetected definition
+ */
+void MainWindowContent::raidDetected(QString channel, QStringList users, int joins, double baseline)
+{
+    /* Raids are never banned automatically (most of them are friendly), so suggest all joining users for a bulk ban */
+    QString reason = QString("Raid: %1 joins/30s (usually %2)").arg(joins).arg(baseline, 0, 'f', 1);
+    foreach (const QString& username, users)
+    {
+        addSuggestion(username, channel, reason, "");
+    }
+}
+
+/**
+ * /brief banListMatched definition
+ */
+void MainWindowContent::banListMatched(QString username, QString channel)
+{
+    QString reason = "Banlist";
+
+    /* The connector bans automatically, so only keep the reason for the ban table */
+    if (mAutoBan)
+    {
+        if ( !mPendingBanReasons.contains(username) )
+        {
+            mPendingBanReasons.insert(username, QStringList() << reason << "");
+        }
+        return;
+    }
+
+    /* Otherwise suggest the ban */
+    addSuggestion(username, channel, reason, "");
+}
+
+/**
+ * /brief banListLoaded definition
+ */
+void MainWindowContent::banListLoaded(QString fileName, int count, qint64 filterBytes, double falsePositiveRate)
+{
+    mBanListFile = fileName;
+    mBanListFailed = (count < 0);
+
+    if (count < 0)
+    {
+        logEvent(QString("Failed to load the banlist %1, the banlist in use (if any) is kept").arg(fileName), true);
+        return;
+    }
+
+    logEvent(QString("Banlist %1 loaded with %2 names, filter %3 KiB, false positive rate %4 %")
+             .arg(fileName).arg(count).arg(filterBytes / 1024).arg(falsePositiveRate * 100.0, 0, 'g', 3));
+}
+
+/**
+ * /brief banListMetricsReported definition
+ */
+void MainWindowContent::banListMetricsReported(BanListMetrics metrics)
+{
+    if ( mBanListFile.isEmpty() )
+    {
+        QMessageBox::information(this, "Banlist Status", "No banlist is configured (banListFile in config.ini).");
+        return;
+    }
+
+    QStringList lines;
+    lines << QString("File: %1").arg(mBanListFile);
+    if (mBanListFailed)
+    {
+        lines << "The last load of the file failed, see the log.";
+    }
+    lines << QString("Names: %1").arg(metrics.count);
+    lines << QString("Filter: %1 KiB, false positive rate %2 %").arg(metrics.filterBytes / 1024).arg(metrics.filterRate * 100.0, 0, 'g', 3);
+    lines << QString("Lookups: %1, rejected by the filter: %2, hits: %3").arg(metrics.lookups).arg(metrics.filtered).arg(metrics.hits);
+
+    if (mBanListFailed || metrics.count == 0)
+    {
+        QMessageBox::warning(this, "Banlist Status", lines.join("\n"));
+    }
+    else
+    {
+        QMessageBox::information(this, "Banlist Status", lines.join("\n"));
+    }
+}
+
+/**
+ * /brief usernamePatternMatched definition
+ */
+void MainWindowContent::usernamePatternMatched(QString username, QString channel, QString pattern)
+{
+    QString reason = QString("Pattern: %1").arg(pattern);
+
+    /* The connector bans automatically, so only keep the reason for the ban table */
+    if (mAutoBan)
+    {
+        if ( !mPendingBanReasons.contains(username) )
+        {
+            mPendingBanReasons.insert(username, QStringList() << reason << "");
+        }
+        return;
+    }
+
+    /* Otherwise suggest the ban */
+    addSuggestion(username, channel, reason, "");
+}
+
+/**
+ * /brief usernamePatternsLoaded definition
+ */
+void MainWindowContent::usernamePatternsLoaded(QString fileName, int count, QString errorString)
+{
+    if (count < 0)
+    {
+        logEvent(QString("Failed to compile the username patterns %1: %2").arg(fileName).arg(errorString), true);
+        return;
+    }
+
+    logEvent(QString("Username patterns %1 compiled with %2 patterns").arg(fileName).arg(count));
+}
+
+/**
+ * /brief addSuggestion definition
+ */
+void MainWindowContent::addSuggestion(QString username, QString channel, QString reason, QString message)
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("MainWindowContent::addSuggestion");
+
+    /* Trace the suggestion model update */
+    TRACE_SPAN("MainWindowContent::addSuggestion");
+
+    /* Check if the user is already suggested */
+    int rowFound = -1;
+    for (int i=0; i<mSuggestionModel->rowCount(); i++)
+    {
+        if (mSuggestionModel->item(i,1)->text().compare(username) == 0)
+        {
+            rowFound = i;
+            break;
+        }
+    }
+
+    if (rowFound != -1)
+    {
+        /* Update the existing suggestion and add the channel */
+        QStringList channels = mSuggestionModel->item(rowFound,2)->text().split(';',QString::SkipEmptyParts);
+        if ( !channel.isEmpty() && !channels.contains(channel) )
+        {
+            channels << channel;
+        }
+
+        mSuggestionModel->item(rowFound,0)->setText(getCurrentTimestamp());
+        mSuggestionModel->item(rowFound,2)->setText(channels.join(';'));
+        mSuggestionModel->item(rowFound,3)->setText(reason);
+        mSuggestionModel->item(rowFound,4)->setText(message);
+        return;
+    }
+
+    /* Newest suggestions are on top */
+    QList<QStandardItem*> newRow;
+    newRow << new QStandardItem(getCurrentTimestamp())
+           << new QStandardItem(username)
+           << new QStandardItem(channel)
+           << new QStandardItem(reason)
+           << new QStandardItem(message);
+    mSuggestionModel->insertRow(0, newRow);
+
+    /* Keep the list bounded, the oldest suggestions are dropped */
+    if (mSuggestionModel->rowCount() > MAX_SUGGESTIONS)
+    {
+        mSuggestionModel->removeRows(MAX_SUGGESTIONS, mSuggestionModel->rowCount() - MAX_SUGGESTIONS);
+    }
+}
+
+/**
+ * /brief banSuggestion definition
+ */
+void MainWindowContent::banSuggestion(int row)
+{
+    QString username = mSuggestionModel->item(row,1)->text();
+    QString reason = mSuggestionModel->item(row,3)->text();
+
+    /* Keep the reason until the connector reports the ban */
+    mPendingBanReasons.insert(username, QStringList() << reason << "");
+
+    /* Request the ban on all connected channels from the connector thread */
+    emit banRequested(username);
+
+    /* The suggestion is done */
+    mSuggestionModel->removeRow(row);
+}
+
+/**
+ * /brief on_suggestions_doubleClicked definition
+ */
+void MainWindowContent::on_suggestions_doubleClicked(const QModelIndex &index)
+{
+    /* One click ban of the suggested user */
+    banSuggestion(index.row());
+}
+
+/**
+ * /brief on_banSuggestionButton_clicked definition
+ */
+void MainWindowContent::on_banSuggestionButton_clicked()
+{
+    /* Get the selected rows and ban from the bottom, so the row numbers stay valid */
+    QModelIndexList selectedRows = ui->suggestions->selectionModel()->selectedRows();
+    QList<int> rows;
+    for (int i=0; i<selectedRows.count(); i++)
+    {
+        rows << selectedRows.at(i).row();
+    }
+    std::sort(rows.begin(), rows.end());
+
+    for (int i=rows.count()-1; i>=0; i--)
+    {
+        banSuggestion(rows.at(i));
+    }
+}
+
+/**
+ * /brief on_clearSuggestionsButton_clicked definition
+ */
+void MainWindowContent::on_clearSuggestionsButton_clicked()
+{
+    /* Remove all suggestions */
+    mSuggestionModel->removeRows(0, mSuggestionModel->rowCount());
+}
+
+/**
+ * /brief on_actionLogin_triggered definition
+ */
+void MainWindowContent::on_actionLogin_triggered()
+{
+    /* Connect to twitch service and force the login credential dialog */
+    loginConnect(true);
+}
+
+/**
+ * /brief on_actionTracing_toggled definition
+ */
+void MainWindowContent::on_actionTracing_toggled(bool checked)
+{
+    /* Record the spans of all threads from now on (or stop it) and keep the setting */
+    Tracer::SetEnabled(checked);
+    mSettings->setValue("tracing", checked ? "true" : "false");
+}
+
+/**
+ * /brief on_actionWriteTrace_triggered definition
+ */
+void MainWindowContent::on_actionWriteTrace_triggered()
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("MainWindowContent::on_actionWriteTrace_triggered");
+
+    QString fileName = QFileDialog::getSaveFileName(this, "Write Trace", "trace.json", "Chrome Trace (*.json)");
+    if ( fileName.isEmpty() )
+    {
+        return;
+    }
+
+    /* Write the spans of the last seconds, the trace can be opened with chrome://tracing or Perfetto */
+    int count = Tracer::WriteChromeTrace(fileName, mTraceSeconds);
+    if (count < 0)
+    {
+        QMessageBox::warning(this, "Write Trace", QString("The trace couldn't be written to %1.").arg(fileName));
+    }
+    else if ( count == 0 && !Tracer::IsEnabled() )
+    {
+        QMessageBox::information(this, "Write Trace", "The trace is empty, enable File > Tracing first.");
+    }
+}
+
+/**
+ * /brief on_actionStallReport_triggered definition
+ */
+void MainWindowContent::on_actionStallReport_triggered()
+{
+    /* Show the stalls of both event loops */
+    QStringList reports;
+    reports << mGuiWatchdog->Report();
+    if (nullptr != mConnectorWatchdog)
+    {
+        reports << mConnectorWatchdog->Report();
+    }
+
+    QMessageBox::information(this, "Stall Report", reports.join("\n\n"));
+}
+
+/**
+ * /brief on_actionBanListStatus_triggered definition
+ */
+void MainWindowContent::on_actionBanListStatus_triggered()
+{
+    /* The metrics are reported by banListMetricsReported */
+    emit banListMetricsRequested();
+}
+
+/**
+ * /brief on_clearLogButton_clicked definition
+ */
+void MainWindowContent::on_clearLogButton_clicked()
+{
+    ui->eventLog->clear();
+}
+
+/**
+ * /brief on_UserModsTabWidget_currentChanged definition
+ */
+void MainWindowContent::on_UserModsTabWidget_currentChanged(int index)
+{
+    /* The warnings have been read once the log is shown */
+    if ( ui->UserModsTabWidget->widget(index) == ui->logTab && mUnreadWarnings > 0 )
+    {
+        mUnreadWarnings = 0;
+        ui->UserModsTabWidget->setTabText(index, "Log");
+    }
+}
+
+/**
+ * /brief logEvent definition
+ */
+void MainWindowContent::logEvent(QString text, bool warning)
+{
+    /* Keep the debug output for the console */
+    if (warning)
+    {
+        qWarning().noquote() << text;
+    }
+    else
+    {
+        qInfo().noquote() << text;
+    }
+
+    ui->eventLog->appendPlainText(QString("%1  %2%3").arg(getCurrentTimestamp()).arg(warning ? "WARNING: " : "").arg(text));
+
+    /* Count the warnings in the tab title until the log is shown */
+    if ( warning && ui->UserModsTabWidget->currentWidget() != ui->logTab )
+    {
+        mUnreadWarnings++;
+        ui->UserModsTabWidget->setTabText(ui->UserModsTabWidget->indexOf(ui->logTab), QString("Log (%1)").arg(mUnreadWarnings));
+    }
+}
+
+/**
+ * /brief on_actionQuit_triggered definition
+ */
+void MainWindowContent::on_actionQuit_triggered()
+{
+    /* Quit the application */
+    exit(0);
+}
+
+/**
+ * /brief on_connectButton_clicked definition
+ */
+void MainWindowContent::on_connectButton_clicked()
+{
+    /* Based on the twitch service connection state reported by the connector thread */
+    if (mConnectionState == DISCONNECTED)
+    {
+        /* Connect to twitch service */
+        emit connectRequested();
+    }
+    else if (mConnectionState == CONNECTED)
+    {
+        /* Disconnect from twitch service */
+        emit disconnectRequested();
+    }
+    else
+    {
+        /* Intentionally do nothing */
+    }
+}
@@ -1,184 +1,613 @@
-/****************************************************************************
- * Copyright (C) 2018 by Sebastian Ziganki                                  *
- *                                                                          *
- * This file is part of Lpz3ncLittleHelper.                                 *
- *                                                                          *
- *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
- *   modify it under the terms of the GNU Lesser General Public License as  *
- *   published by the Free Software Foundation, either version 3 of the     *
- *   License.                                                               *
- *                                                                          *
- *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
- *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
- *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
- *   GNU Lesser General Public License for more details.                    *
- *                                                                          *
- *   You should have received a copy of the GNU Lesser General Public       *
- *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
- ****************************************************************************/
-
-/**
- * /file    mainwindowcontent.h
- * /author  Hackspider
- * /brief   Header file of the main window
- */
-
-/* Include Guard */
-#ifndef MAINWINDOW_H
-#define MAINWINDOW_H
-
-/* Necessary dependencies to Qt framework */
-#include <QMainWindow>
-#include <QStandardItemModel>
-#include <QSettings>
-
-/* Necessary internal dependencies */
-#include "iconrightstyleditemdelegate.h"
-#include "twitchconnector.h"
-
-/* Configuration file that is used to store the channels, users, login permanently */
-#define CONFIG_FILE "config.ini"
-
-/* MainWindowContent declaration as part of the Ui namespace */
-namespace Ui
-{
-    class MainWindowContent;
-}
-
-/**
- * /brief  The MainWindowContent class declaraation. Derived from QMainWindow class.
- */
-class MainWindowContent : public QMainWindow
-{
-    Q_OBJECT
-
-public:
-    /**
-     * /brief  Constructor of the MainWindowContent class
-     * /param  parent  Parent of the MainWindowContent object according to Qt's object tree
-     */
-    explicit MainWindowContent(QWidget *parent = 0);
-
-    /**
-     * /brief  Destructor of the MainWindowContent class
-     */
-    ~MainWindowContent();
-
-private slots:
-
-    /**
-     * /brief  Method called if user clicks on the add channel button
-     */
-    void on_addChannelButton_clicked();
-
-    /**
-     * /brief  Method called if user clicks on the remove channel button
-     */
-    void on_removeChannelButton_clicked();
-
-    /**
-     * /brief  Method called if user clicks into the user panel
-     * /param  index  Index of the item where the user clicked on
-     */
-    void on_users_clicked(const QModelIndex &index);
-
-    /**
-     * /brief  Method called if user clicks on the ban user button
-     */
-    void on_banUserButton_clicked();
-
-    /**
-     * /brief  Method called if user clicks on the unban user button
-     */
-    void on_unbanUserButton_clicked();
-
-    /**
-     * /brief  Method called if the channel model (MVC) changed
-     * /param  item  Pointer to the item which has been changed
-     */
-    void channelModelItemChanged(QStandardItem* item);
-
-    /**
-     * /brief  Method called if a row of the channel model (MVC) changed
-     */
-    void channelRowsChanged(const QModelIndex & parent, int start, int end);
-
-    /**
-     * /brief  Method called if the user model (MVC) changed
-     * /param  item  Pointer to the item which has been changed
-     */
-    void userModelItemChanged(QStandardItem* item);
-
-    /**
-     * /brief  Method called if a row of the user model (MVC) changed
-     */
-    void userRowsChanged(const QModelIndex & parent, int start, int end);
-
-    /**
-     * /brief  Internally used to write channel settings into config file
-     */
-    void rewriteChannelSettings(void);
-
-    /**
-     * /brief  Internally used to write user settings into config file
-     */
-    void rewriteUserSettings(void);
-
-    /**
-     * /brief  Internally used to get user credentials and connect to twitch
-     * /param  forceDialog  To force the display of the dialog set to true
-     */
-    void loginConnect(bool forceDialog = false);
-
-    /**
-     * /brief   Helper function to get a formatted timestamp
-     * /return
-     */
-    QString getCurrentTimestamp(void);
-
-    /**
-     * /brief   Internal method to ban a user
-     * /param   username  Name of the user that should be banned
-     * /return  List of channels where the user has been banned
-     */
-    QList<QString> banUser(QString username);
-
-    /**
-     * /brief   Internal method to unban a user
-     * /param   username  Name of the user that should be unbanned
-     * /return  List of channels where the user has been unbanned
-     */
-    QList<QString> unbanUser(QString username);
-
-    /**
-     * /brief  Method called if user clicks on the login menu item
-     */
-    void on_actionLogin_triggered();
-
-    /**
-     * /brief  Method called if user clicks on the quit menu item
-     */
-    void on_actionQuit_triggered();
-
-    /**
-     * /brief  Method called if user clicks on the connect button
-     */
-    void on_connectButton_clicked();
-
-private:
-    /**
-     * /brief Internal used variables
-     */
-    Ui::MainWindowContent* ui;
-    QSettings* mSettings;
-    QString mLoginName;
-    QString mOauth2;
-    bool mSaveCredentials;
-    IconRightStyledItemDelegate* mIconRightDelegate;
-    QStandardItemModel* mChannelModel;
-    QStandardItemModel* mUserModel;
-    TwitchConnector* mTwitchConnector;
-
-};
-
-#endif /* MAINWINDOW_H */
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    mainwindowcontent.h
+ * /author  Hackspider
+ * /brief   Header file of the main window
+ */
+
+/* Include Guard */
+#ifndef MAINWINDOW_H
+#define MAINWINDOW_H
+
+/* Necessary dependencies to Qt framework */
+#include <QMainWindow>
+#include <QStandardItemModel>
+#include <QSettings>
+#include <QThread>
+#include <QHash>
+#include <QStringList>
+#include <QCompleter>
+#include <QStringListModel>
+
+/* Necessary internal dependencies */
+#include "iconrightstyleditemdelegate.h"
+#include "twitchconnector.h"
+
+/* Configuration file that is used to store the channels, users, login permanently */
+#define CONFIG_FILE "config.ini"
+
+/* Maximum number of ban suggestions kept in the suggestion list */
+#define MAX_SUGGESTIONS 500
+
+/* Number of users offered by the username completion */
+#define USERNAME_COMPLETER_COUNT 20
+
+/* Maximum number of lines kept in the event log */
+#define MAX_LOG_LINES 2000
+
+/* MainWindowContent declaration as part of the Ui namespace */
+namespace Ui
+{
+    class MainWindowContent;
+}
+
+/**
+ * /brief  The MainWindowContent class declaraation. Derived from QMainWindow class.
+ */
+class MainWindowContent : public QMainWindow
+{
+    Q_OBJECT
+
+public:
+    /**
+     * /brief  Constructor of the MainWindowContent class
+     * /param  parent  Parent of the MainWindowContent object according to Qt's object tree
+     */
+    explicit MainWindowContent(QWidget *parent = 0);
+
+    /**
+     * /brief  Destructor of the MainWindowContent class
+     */
+    ~MainWindowContent();
+
+signals:
+    /**
+     * /brief  Signal to request a connection to the twitch service from the connector thread
+     */
+    void connectRequested(void);
+
+    /**
+     * /brief  Signal to request a disconnect from the twitch service from the connector thread
+     */
+    void disconnectRequested(void);
+
+    /**
+     * /brief  Signal to pass the channels that shall be joined to the connector thread
+     * /param  channels  Set of channel names
+     */
+    void channelsChanged(QSet<QString> channels);
+
+    /**
+     * /brief  Signal to pass a new login name to the connector thread
+     * /param  loginName  New login name
+     */
+    void loginNameChanged(QString loginName);
+
+    /**
+     * /brief  Signal to pass a new oauth2 to the connector thread
+     * /param  oauth2  New oauth2
+     */
+    void oauth2Changed(QString oauth2);
+
+    /**
+     * /brief  Signal to request a ban on all connected channels from the connector thread
+     * /param  username  Name of the user that shall be banned
+     */
+    void banRequested(QString username);
+
+    /**
+     * /brief  Signal to request an unban on all connected channels from the connector thread
+     * /param  username  Name of the user that shall be unbanned
+     */
+    void unbanRequested(QString username);
+
+    /**
+     * /brief  Signal to pass the terms every chat message is checked against to the connector thread
+     * /param  terms  List of terms
+     */
+    void keywordsChanged(QStringList terms);
+
+    /**
+     * /brief  Signal to pass the automatic ban setting to the connector thread
+     * /param  autoBan  True if matching users shall be banned automatically
+     */
+    void autoBanChanged(bool autoBan);
+
+    /**
+     * /brief  Signal to pass the targeted ban setting to the connector thread
+     * /param  targetedBan  True if users shall only be banned in the channels they are present in
+     */
+    void targetedBanChanged(bool targetedBan);
+
+    /**
+     * /brief  Signal to pass the threshold of the spam wave detection to the connector thread
+     * /param  minChannels  Number of channels a message must be seen in (less than 2 disables the detection)
+     * /param  window       Time window in seconds
+     */
+    void spamWaveThresholdChanged(int minChannels, int window);
+
+    /**
+     * /brief  Signal to pass the message rate limits to the connector thread
+     * /param  shortLimit  Maximum number of messages within 5 seconds (0 disables the limit)
+     * /param  longLimit   Maximum number of messages within 60 seconds (0 disables the limit)
+     */
+    void rateLimitsChanged(int shortLimit, int longLimit);
+
+    /**
+     * /brief  Signal to pass the threshold of the raid detection to the connector thread
+     * /param  factor    Factor of the usual number of joins a raid must exceed (0 disables the detection)
+     * /param  minJoins  Minimum number of joins per 30 seconds of a raid
+     */
+    void raidThresholdChanged(int factor, int minJoins);
+
+    /**
+     * /brief  Signal to pass the banlist file to the connector thread
+     * /param  fileName           Name of the banlist file
+     * /param  falsePositiveRate  Target false positive rate of the bloom filter in front of the banlist
+     * /param  maxBytes           Memory budget of the bloom filter in bytes
+     */
+    void banListChanged(QString fileName, double falsePositiveRate, qint64 maxBytes);
+
+    /**
+     * /brief  Signal to pass the username pattern file to the connector thread
+     * /param  fileName  Name of the pattern file
+     */
+    void usernamePatternsChanged(QString fileName);
+
+    /**
+     * /brief  Signal to request a search of the recent chat messages from the connector thread
+     * /param  username  Author of the messages, empty for all authors
+     * /param  terms     Words which all have to occur in a message
+     */
+    void searchRequested(QString username, QString terms);
+
+    /**
+     * /brief  Signal to request the completion of a username from the connector thread
+     * /param  prefix  Prefix of the names
+     * /param  count   Maximum number of names
+     */
+    void usernameCompletionRequested(QString prefix, int count);
+
+    /**
+     * /brief  Signal to request the metrics of the banlist from the connector thread
+     */
+    void banListMetricsRequested(void);
+
+private slots:
+
+    /**
+     * /brief  Method called if user clicks on the add channel button
+     */
+    void on_addChannelButton_clicked();
+
+    /**
+     * /brief  Method called if user clicks on the remove channel button
+     */
+    void on_removeChannelButton_clicked();
+
+    /**
+     * /brief  Method called if user clicks into the user panel
+     * /param  index  Index of the item where the user clicked on
+     */
+    void on_users_clicked(const QModelIndex &index);
+
+    /**
+     * /brief  Method called if user clicks on the ban user button
+     */
+    void on_banUserButton_clicked();
+
+    /**
+     * /brief  Method called if user edits the username, requests the matching users from the connector
+     * /param  text  Current text of the username line edit
+     */
+    void on_usernameLineEdit_textEdited(const QString& text);
+
+    /**
+     * /brief  Method called if the connector has completed a username, offers the names if the prefix is still current
+     * /param  prefix  Completed prefix
+     * /param  names   Matching names in alphabetical order
+     */
+    void usernameCompleted(QString prefix, QStringList names);
+
+    /**
+     * /brief  Method called if the connector has searched the recent chat messages
+     * /param  username  Searched author
+     * /param  terms     Searched words
+     * /param  hits      Found messages, the newest first
+     */
+    void chatSearched(QString username, QString terms, QList<ChatIndexHit> hits);
+
+    /**
+     * /brief  Method called if user clicks on the search button
+     */
+    void on_searchButton_clicked();
+
+    /**
+     * /brief  Method called if user presses return in the username field of the search
+     */
+    void on_searchUserLineEdit_returnPressed();
+
+    /**
+     * /brief  Method called if user presses return in the words field of the search
+     */
+    void on_searchTermsLineEdit_returnPressed();
+
+    /**
+     * /brief  Method called if user clicks on the clear search button
+     */
+    void on_clearSearchButton_clicked();
+
+    /**
+     * /brief  Method called if user double clicks into the search results, takes the author over into the ban form
+     * /param  index  Index of the item where the user clicked on
+     */
+    void on_searchResults_doubleClicked(const QModelIndex &index);
+
+    /**
+     * /brief  Method called if user clicks on the unban user button
+     */
+    void on_unbanUserButton_clicked();
+
+    /**
+     * /brief  Method called if the channel model (MVC) changed
+     * /param  item  Pointer to the item which has been changed
+     */
+    void channelModelItemChanged(QStandardItem* item);
+
+    /**
+     * /brief  Method called if a row of the channel model (MVC) changed
+     */
+    void channelRowsChanged(const QModelIndex & parent, int start, int end);
+
+    /**
+     * /brief  Method called if the user model (MVC) changed
+     * /param  item  Pointer to the item which has been changed
+     */
+    void userModelItemChanged(QStandardItem* item);
+
+    /**
+     * /brief  Method called if a row of the user model (MVC) changed
+     */
+    void userRowsChanged(const QModelIndex & parent, int start, int end);
+
+    /**
+     * /brief  Internally used to pass the checked channels to the twitch connector
+     */
+    void updateConnectorChannels(void);
+
+    /**
+     * /brief  Method called if the connection state of the twitch connector changed
+     * /param  state  New connection state
+     */
+    void connectionStateChanged(ConnectionState state);
+
+    /**
+     * /brief  Method called if the twitch connector joined a channel
+     * /param  channel  Name of the joined channel
+     */
+    void channelJoined(QString channel);
+
+    /**
+     * /brief  Method called if the twitch connector parted a channel
+     * /param  channel  Name of the parted channel
+     */
+    void channelParted(QString channel);
+
+    /**
+     * /brief  Method called if the twitch connector reported our moderator status in a channel, channels without permission are grayed out
+     * /param  channel    Name of the channel
+     * /param  moderator  True if moderation commands are permitted in the channel
+     */
+    void moderatorChanged(QString channel, bool moderator);
+
+    /**
+     * /brief  Internally used to write channel settings into config file
+     */
+    void rewriteChannelSettings(void);
+
+    /**
+     * /brief  Internally used to write user settings into config file
+     */
+    void rewriteUserSettings(void);
+
+    /**
+     * /brief  Internally used to get user credentials and connect to twitch
+     * /param  forceDialog  To force the display of the dialog set to true
+     */
+    void loginConnect(bool forceDialog = false);
+
+    /**
+     * /brief   Helper function to get a formatted timestamp
+     * /return
+     */
+    QString getCurrentTimestamp(void);
+
+    /**
+     * /brief  Method called if the twitch connector has queued a ban, the channels are shown as pending until they are acknowledged
+     * /param  username    Name of the banned user
+     * /param  channelSet  Set of channels where the ban has been queued
+     * /param  messages    Recent messages of the user as evidence
+     * /param  skipped     Number of channels skipped because the user is already banned there
+     */
+    void userBanned(QString username, QSet<QString> channelSet, QStringList messages, int skipped);
+
+    /**
+     * /brief  Method called if the twitch connector has queued an unban, the channels are shown as pending until they are acknowledged
+     * /param  username    Name of the unbanned user
+     * /param  channelSet  Set of channels where the unban has been queued
+     * /param  skipped     Number of connected channels skipped because no ban is known there
+     */
+    void userUnbanned(QString username, QSet<QString> channelSet, int skipped);
+
+    /**
+     * /brief  Method called if twitch acknowledged a moderation command, the user model only lists acknowledged bans
+     * /param  command   Moderation command (e.g. ".ban")
+     * /param  userName  Name of the user the command applies to
+     * /param  channel   Channel of the command
+     */
+    void commandAcknowledged(QString command, QString userName, QString channel);
+
+    /**
+     * /brief  Internally used to find the row of a user in the user model
+     * /param  username  Name of the user
+     * /return Returns the row or -1 if the user isn't listed
+     */
+    int findUserRow(const QString& username);
+
+    /**
+     * /brief  Internally used to append a user without any banned channel to the user model
+     * /param  username     Name of the user
+     * /param  banReason    Reason of the ban
+     * /param  urlReason    Url of the reason
+     * /param  banEvidence  Recent messages of the user
+     * /return Returns the new row
+     */
+    int appendUserRow(const QString& username, const QString& banReason, const QString& urlReason, const QString& banEvidence);
+
+    /**
+     * /brief  Internally used to remove a channel from the banned channels of a user, the row is removed with the last ban
+     * /param  username  Name of the user
+     * /param  channel   Channel which isn't banned anymore
+     */
+    void removeBannedChannel(const QString& username, const QString& channel);
+
+    /**
+     * /brief  Internally used to show the channels of a user which wait for the acknowledgement of a ban or an unban
+     * /param  username  Name of the user
+     */
+    void updatePendingChannels(const QString& username);
+
+    /**
+     * /brief  Method called if the connector has given up a moderation command, a failed ban is removed from the user model
+     * /param  command   Moderation command (e.g. ".ban")
+     * /param  userName  Name of the user the command applies to
+     * /param  channel   Channel of the command
+     * /param  reason    Answer of the twitch service or the reason the command has been given up
+     */
+    void commandFailed(QString command, QString userName, QString channel, QString reason);
+
+    /**
+     * /brief  Method called if the connection has been lost and the standby connection has taken over
+     * /param  channels  Number of channels whose moderation commands continue while they are joined again
+     */
+    void failedOver(int channels);
+
+    /**
+     * /brief  Method called if a chat message matches a term
+     * /param  channel   Channel of the message
+     * /param  username  Author of the message
+     * /param  term      Matching term
+     * /param  message   Text of the message
+     */
+    void keywordMatched(QString channel, QString username, QString term, QString message);
+
+    /**
+     * /brief  Method called if the same message has been posted in several channels
+     * /param  username    Author of the message
+     * /param  channelSet  Set of channels where the message has been posted
+     * /param  message     Text of the message
+     */
+    void spamWaveDetected(QString username, QSet<QString> channelSet, QString message);
+
+    /**
+     * /brief  Method called if a user exceeds a message rate limit
+     * /param  username    Name of the user
+     * /param  channel     Channel of the message that exceeded the limit
+     * /param  shortCount  Number of messages within 5 seconds
+     * /param  longCount   Number of messages within 60 seconds
+     * /param  message     Text of the message that exceeded the limit
+     */
+    void rateExceeded(QString username, QString channel, int shortCount, int longCount, QString message);
+
+    /**
+     * /brief  Method called if a burst of joins has been detected in a channel
+     * /param  channel   Channel of the raid
+     * /param  users     Joining users
+     * /param  joins     Number of joins within the last 30 seconds
+     * /param  baseline  Usual number of joins within 30 seconds
+     */
+    void raidDetected(QString channel, QStringList users, int joins, double baseline);
+
+    /**
+     * /brief  Method called if a chatter or a joining user is on the banlist
+     * /param  username  Name of the user
+     * /param  channel   Channel where the user has been seen
+     */
+    void banListMatched(QString username, QString channel);
+
+    /**
+     * /brief  Method called if the connector has loaded a banlist
+     * /param  fileName           Name of the banlist file
+     * /param  count              Number of names of the banlist or -1 if the file couldn't be mapped
+     * /param  filterBytes        Memory used by the bloom filter in bytes
+     * /param  falsePositiveRate  Estimated false positive rate of the bloom filter
+     */
+    void banListLoaded(QString fileName, int count, qint64 filterBytes, double falsePositiveRate);
+
+    /**
+     * /brief  Method called if the connector has reported the metrics of the banlist, shows them to the user
+     * /param  metrics  Size of the banlist, of its filter and the lookup counters
+     */
+    void banListMetricsReported(BanListMetrics metrics);
+
+    /**
+     * /brief  Method called if a chatter or a joining user matches a username pattern
+     * /param  username  Name of the user
+     * /param  channel   Channel where the user has been seen
+     * /param  pattern   Matching pattern
+     */
+    void usernamePatternMatched(QString username, QString channel, QString pattern);
+
+    /**
+     * /brief  Method called if the connector has compiled the username patterns
+     * /param  fileName     Name of the pattern file
+     * /param  count        Number of patterns or -1 if the patterns couldn't be compiled
+     * /param  errorString  Reason if the patterns couldn't be compiled
+     */
+    void usernamePatternsLoaded(QString fileName, int count, QString errorString);
+
+    /**
+     * /brief  Internally used to add or update a ban suggestion
+     * /param  username  Name of the suspected user
+     * /param  channel   Channel where the user has been seen
+     * /param  reason    Reason of the suggestion
+     * /param  message   Message that caused the suggestion
+     */
+    void addSuggestion(QString username, QString channel, QString reason, QString message);
+
+    /**
+     * /brief  Internally used to ban a suggested user and remove the suggestion
+     * /param  row  Row of the suggestion
+     */
+    void banSuggestion(int row);
+
+    /**
+     * /brief  Method called if user double clicks into the suggestion panel
+     * /param  index  Index of the item where the user clicked on
+     */
+    void on_suggestions_doubleClicked(const QModelIndex &index);
+
+    /**
+     * /brief  Method called if user clicks on the ban selected suggestions button
+     */
+    void on_banSuggestionButton_clicked();
+
+    /**
+     * /brief  Method called if user clicks on the clear suggestions button
+     */
+    void on_clearSuggestionsButton_clicked();
+
+    /**
+     * /brief  Method called if user clicks on the login menu item
+     */
+    void on_actionLogin_triggered();
+
+    /**
+     * /brief  Method called if user toggles the tracing menu item
+     * /param  checked  True if the spans shall be recorded
+     */
+    void on_actionTracing_toggled(bool checked);
+
+    /**
+     * /brief  Method called if user clicks on the write trace menu item, writes the spans of the last seconds as Chrome trace
+     */
+    void on_actionWriteTrace_triggered();
+
+    /**
+     * /brief  Method called if user clicks on the stall report menu item, shows the stalls of the ui and the connector thread
+     */
+    void on_actionStallReport_triggered();
+
+    /**
+     * /brief  Method called if user clicks on the banlist status menu item, requests the banlist metrics from the connector
+     */
+    void on_actionBanListStatus_triggered();
+
+    /**
+     * /brief  Method called if user clicks on the clear log button
+     */
+    void on_clearLogButton_clicked();
+
+    /**
+     * /brief  Method called if user selects another tab, the unread warnings are reset if the log is selected
+     * /param  index  Index of the selected tab
+     */
+    void on_UserModsTabWidget_currentChanged(int index);
+
+    /**
+     * /brief  Internally used to add an event to the log tab (and to the debug output)
+     * /param  text     Text of the event
+     * /param  warning  True if the event needs the attention of the user, it is counted in the tab title until the log is read
+     */
+    void logEvent(QString text, bool warning = false);
+
+    /**
+     * /brief  Method called if user clicks on the quit menu item
+     */
+    void on_actionQuit_triggered();
+
+    /**
+     * /brief  Method called if user clicks on the connect button
+     */
+    void on_connectButton_clicked();
+
+private:
+    /**
+     * /brief Internal used variables
+     */
+    Ui::MainWindowContent* ui;
+    QSettings* mSettings;
+    QString mLoginName;
+    QString mOauth2;
+    bool mSaveCredentials;
+    IconRightStyledItemDelegate* mIconRightDelegate;
+    QStandardItemModel* mChannelModel;
+    QStandardItemModel* mUserModel;
+    TwitchConnector* mTwitchConnector;
+    QThread* mConnectorThread;
+    ConnectionState mConnectionState;
+    QHash<QString, QStringList> mPendingBanReasons;
+    QHash<QString, QSet<QString> > mPendingBans;
+    QHash<QString, QSet<QString> > mPendingUnbans;
+    QStandardItemModel* mSuggestionModel;
+    QStandardItemModel* mSearchModel;
+    QCompleter* mUsernameCompleter;
+    QStringListModel* mUsernameCompleterModel;
+    QStringList mKeywords;
+    bool mAutoBan;
+    bool mTargetedBan;
+    int mSpamWaveChannels;
+    int mSpamWaveWindow;
+    int mRateLimitShort;
+    int mRateLimitLong;
+    int mRaidFactor;
+    int mRaidMinJoins;
+    int mTraceSeconds;
+    int mStallThreshold;
+    StallWatchdog* mGuiWatchdog;
+    StallWatchdog* mConnectorWatchdog;
+    int mUnreadWarnings;
+    QString mBanListFile;
+    bool mBanListFailed;
+
+};
+
+#endif /* MAINWINDOW_H */
@@ -0,0 +1,165 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    messagehistory.cpp
+ * /author  Hackspider
+ * /brief   Source file of the recent chat messages of every active user
+ */
+
+/* Necessary dependencies to the standard library */
+#include <string.h>
+
+/* Necessary dependencies to Qt framework */
+#include <QDateTime>
+#include <QHash>
+
+/* Necessary internal dependencies */
+#include "messagehistory.h"
+
+/**
+ * /brief  Helper to cut a utf-8 text without splitting a character
+ * /param  data       Pointer to the utf-8 text
+ * /param  length     Length of the text
+ * /param  maxLength  Maximum length
+ * /return Returns the length of the cut text
+ */
+static int cutUtf8(const char* data, int length, int maxLength)
+{
+    if (length <= maxLength)
+    {
+        return length;
+    }
+
+    /* Step back to the first byte of the character */
+    while ( maxLength > 0 && ( (unsigned char)data[maxLength] & 0xC0 ) == 0x80 )
+    {
+        maxLength--;
+    }
+
+    return maxLength;
+}
+
+/**
+ * /brief MessageHistory definition
+ */
+MessageHistory::MessageHistory()
+{
+    /* The whole table is allocated once */
+    HistoryEntry empty;
+    memset(&empty, 0, sizeof(empty));
+    mEntries.fill(empty, MESSAGE_HISTORY_SETS * MESSAGE_HISTORY_WAYS);
+}
+
+/**
+ * /brief Record definition
+ */
+void MessageHistory::Record(QLatin1String userName, QLatin1String channel, const char* data, int length, qint64 timestamp)
+{
+    if ( userName.size() == 0 || userName.size() > MESSAGE_HISTORY_NAME )
+    {
+        return;
+    }
+
+    uint hash = qHash(userName);
+    HistoryEntry* entry = const_cast<HistoryEntry*>( find(userName, hash) );
+
+    /* Replace the least recently active user of the set */
+    if (entry == nullptr)
+    {
+        HistoryEntry* set = mEntries.data() + (hash % MESSAGE_HISTORY_SETS) * MESSAGE_HISTORY_WAYS;
+
+        entry = set;
+        for (int way=1; way<MESSAGE_HISTORY_WAYS; way++)
+        {
+            if ( set[way].lastSeen < entry->lastSeen )
+            {
+                entry = set + way;
+            }
+        }
+
+        entry->hash = hash;
+        entry->nameLength = userName.size();
+        memcpy(entry->name, userName.data(), userName.size());
+        entry->count = 0;
+    }
+
+    entry->lastSeen = timestamp;
+
+    /* Overwrite the oldest message of the ring */
+    HistoryMessage& message = entry->messages[ entry->count % MESSAGE_HISTORY_DEPTH ];
+    message.timestamp = timestamp;
+    message.channelLength = qMin(channel.size(), MESSAGE_HISTORY_NAME);
+    memcpy(message.channel, channel.data(), message.channelLength);
+    message.textLength = cutUtf8(data, length, MESSAGE_HISTORY_TEXT);
+    memcpy(message.text, data, message.textLength);
+    entry->count++;
+}
+
+/**
+ * /brief Snapshot definition
+ */
+QStringList MessageHistory::Snapshot(const QString& userName) const
+{
+    QStringList messages;
+    QByteArray name = userName.toLower().toUtf8();
+    QLatin1String key(name.constData(), name.size());
+
+    const HistoryEntry* entry = find(key, qHash(key));
+    if (entry == nullptr)
+    {
+        return messages;
+    }
+
+    /* Oldest message first */
+    quint32 first = ( entry->count > MESSAGE_HISTORY_DEPTH ) ? entry->count - MESSAGE_HISTORY_DEPTH : 0;
+    for (quint32 i=first; i<entry->count; i++)
+    {
+        const HistoryMessage& message = entry->messages[ i % MESSAGE_HISTORY_DEPTH ];
+
+        messages << QString("%1 #%2: %3")
+                    .arg(QDateTime::fromMSecsSinceEpoch(message.timestamp).toString("yyyy.MM.dd hh:mm:ss"))
+                    .arg(QString::fromUtf8(message.channel, message.channelLength))
+                    .arg(QString::fromUtf8(message.text, message.textLength));
+    }
+
+    return messages;
+}
+
+/**
+ * /brief find definition
+ */
+const HistoryEntry* MessageHistory::find(QLatin1String userName, uint hash) const
+{
+    const HistoryEntry* set = mEntries.constData() + (hash % MESSAGE_HISTORY_SETS) * MESSAGE_HISTORY_WAYS;
+
+    for (int way=0; way<MESSAGE_HISTORY_WAYS; way++)
+    {
+        const HistoryEntry& candidate = set[way];
+        if ( candidate.count > 0 &&
+             candidate.hash == hash &&
+             candidate.nameLength == userName.size() &&
+             0 == memcmp(candidate.name, userName.data(), userName.size()) )
+        {
+            return &candidate;
+        }
+    }
+
+    return nullptr;
+}
@@ -0,0 +1,120 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    messagehistory.h
+ * /author  Hackspider
+ * /brief   Header file of the recent chat messages of every active user
+ */
+
+/* Include Guard */
+#ifndef MESSAGEHISTORY_H
+#define MESSAGEHISTORY_H
+
+/* Necessary dependencies to Qt framework */
+#include <QStringList>
+#include <QVector>
+
+/* Number of sets of the history table */
+#define MESSAGE_HISTORY_SETS 2048
+
+/* Number of users per set, the least recently active user of a full set is replaced */
+#define MESSAGE_HISTORY_WAYS 4
+
+/* Number of messages kept per user */
+#define MESSAGE_HISTORY_DEPTH 5
+
+/* Maximum length of a kept user or channel name (twitch names have up to 25 characters) */
+#define MESSAGE_HISTORY_NAME 32
+
+/* Maximum number of bytes kept of a message */
+#define MESSAGE_HISTORY_TEXT 256
+
+/* Type of a kept chat message */
+typedef struct
+{
+    qint64 timestamp;
+    int textLength;
+    int channelLength;
+    char channel[MESSAGE_HISTORY_NAME];
+    char text[MESSAGE_HISTORY_TEXT];
+} HistoryMessage;
+
+/* Type of a user with its recent messages */
+typedef struct
+{
+    uint hash;
+    int nameLength;
+    char name[MESSAGE_HISTORY_NAME];
+    qint64 lastSeen;
+    quint32 count;
+    HistoryMessage messages[MESSAGE_HISTORY_DEPTH];
+} HistoryEntry;
+
+/**
+ * /brief  The MessageHistory class declaration.
+ *
+ * Keeps the last MESSAGE_HISTORY_DEPTH messages of every active user in a
+ * ring per user. The users live in a fixed set associative table which is
+ * allocated once (MESSAGE_HISTORY_SETS * MESSAGE_HISTORY_WAYS entries, about
+ * 12 MB): a new user replaces the least recently active user of its set, so
+ * the memory stays the same however many users chat and nothing is
+ * allocated per message.
+ */
+class MessageHistory
+{
+public:
+    /**
+     * /brief  Constructor of the MessageHistory class
+     */
+    MessageHistory(void);
+
+    /**
+     * /brief  Method to keep a chat message of a user
+     * /param  userName   Author of the message
+     * /param  channel    Channel of the message
+     * /param  data       Pointer to the utf-8 text of the message
+     * /param  length     Length of the text (longer texts are cut)
+     * /param  timestamp  Time of the message in milliseconds since epoch
+     */
+    void Record(QLatin1String userName, QLatin1String channel, const char* data, int length, qint64 timestamp);
+
+    /**
+     * /brief   Method to get the kept messages of a user
+     * /param   userName  Name of the user (case insensitive)
+     * /return  Returns the messages as "<date> <time> #<channel>: <text>", the oldest first
+     */
+    QStringList Snapshot(const QString& userName) const;
+
+private:
+    /**
+     * /brief   Internally used method to search a user
+     * /param   userName  Name of the user
+     * /param   hash      Hash of the name
+     * /return  Returns the entry of the user or nullptr
+     */
+    const HistoryEntry* find(QLatin1String userName, uint hash) const;
+
+    /**
+     * /brief Internal used variables
+     */
+    QVector<HistoryEntry> mEntries;
+};
+
+#endif /* MESSAGEHISTORY_H */
@@ -0,0 +1,240 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    presenceindex.cpp
+ * /author  Hackspider
+ * /brief   Source file of the index of the users present in the connected channels
+ */
+
+/* Necessary internal dependencies */
+#include "presenceindex.h"
+
+/**
+ * /brief PresenceIndex definition
+ */
+PresenceIndex::PresenceIndex()
+    : mChannelNames(PRESENCE_MAX_CHANNELS),
+    mMemberCounts(PRESENCE_MAX_CHANNELS, 0),
+    mCompleteChannels(0),
+    mTruncatedChannels(0)
+{
+}
+
+/**
+ * /brief Join definition
+ */
+void PresenceIndex::Join(QLatin1String channel, QLatin1String userName)
+{
+    int id = channelId(channel, true);
+    if (id < 0)
+    {
+        return;
+    }
+
+    /* Look up the user without copying the name */
+    QHash<QByteArray, quint64>::iterator it = mUsers.find(QByteArray::fromRawData(userName.data(), userName.size()));
+    if ( it == mUsers.end() )
+    {
+        /* The user list of the channel lacks this user from now on */
+        if ( mUsers.count() >= PRESENCE_MAX_USERS )
+        {
+            mTruncatedChannels |= ( 1ULL << id );
+            mCompleteChannels &= ~( 1ULL << id );
+            return;
+        }
+        it = mUsers.insert(QByteArray(userName.data(), userName.size()), 0);
+    }
+
+    if ( ( it.value() & ( 1ULL << id ) ) == 0 )
+    {
+        it.value() |= ( 1ULL << id );
+
+        /* Twitch stops reporting the joins and parts of large channels */
+        if ( ++mMemberCounts[id] > PRESENCE_MAX_COMPLETE_MEMBERS )
+        {
+            mCompleteChannels &= ~( 1ULL << id );
+        }
+    }
+}
+
+/**
+ * /brief Part definition
+ */
+void PresenceIndex::Part(QLatin1String channel, QLatin1String userName)
+{
+    int id = channelId(channel, false);
+    if (id < 0)
+    {
+        return;
+    }
+
+    QHash<QByteArray, quint64>::iterator it = mUsers.find(QByteArray::fromRawData(userName.data(), userName.size()));
+    if ( it == mUsers.end() )
+    {
+        return;
+    }
+
+    if ( ( it.value() & ( 1ULL << id ) ) == 0 )
+    {
+        return;
+    }
+
+    /* Drop the user with the last channel */
+    mMemberCounts[id]--;
+    it.value() &= ~( 1ULL << id );
+    if ( it.value() == 0 )
+    {
+        mUsers.erase(it);
+    }
+}
+
+/**
+ * /brief Complete definition
+ */
+void PresenceIndex::Complete(QLatin1String channel)
+{
+    /* A channel without any listed name has no id and stays unindexed */
+    int id = channelId(channel, false);
+    if (id < 0)
+    {
+        return;
+    }
+
+    if ( ( mTruncatedChannels & ( 1ULL << id ) ) == 0 && mMemberCounts.at(id) <= PRESENCE_MAX_COMPLETE_MEMBERS )
+    {
+        mCompleteChannels |= ( 1ULL << id );
+    }
+}
+
+/**
+ * /brief RemoveChannel definition
+ */
+void PresenceIndex::RemoveChannel(const QString& channel)
+{
+    QByteArray name = channel.toUtf8();
+    int id = mChannelIds.value(name, -1);
+    if (id < 0)
+    {
+        return;
+    }
+
+    /* Remove the channel from all users and drop the users without a channel */
+    quint64 mask = ~( 1ULL << id );
+    QHash<QByteArray, quint64>::iterator it = mUsers.begin();
+    while ( it != mUsers.end() )
+    {
+        it.value() &= mask;
+        if ( it.value() == 0 )
+        {
+            it = mUsers.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    /* The id is free for the next channel */
+    mChannelIds.remove(name);
+    mChannelNames[id].clear();
+    mMemberCounts[id] = 0;
+    mCompleteChannels &= mask;
+    mTruncatedChannels &= mask;
+}
+
+/**
+ * /brief Clear definition
+ */
+void PresenceIndex::Clear()
+{
+    mUsers.clear();
+    mChannelIds.clear();
+    mChannelNames.fill(QString());
+    mMemberCounts.fill(0);
+    mCompleteChannels = 0;
+    mTruncatedChannels = 0;
+}
+
+/**
+ * /brief IsIndexed definition
+ */
+bool PresenceIndex::IsIndexed(const QString& channel) const
+{
+    int id = mChannelIds.value(channel.toUtf8(), -1);
+
+    return ( id >= 0 && ( mCompleteChannels & ( 1ULL << id ) ) != 0 );
+}
+
+/**
+ * /brief Channels definition
+ */
+QSet<QString> PresenceIndex::Channels(const QString& userName) const
+{
+    QSet<QString> channels;
+    quint64 mask = mUsers.value(userName.toLower().toUtf8(), 0);
+
+    /* Resolve the ids of all set bits */
+    while (mask != 0)
+    {
+        int id = 0;
+        while ( ( mask & ( 1ULL << id ) ) == 0 )
+        {
+            id++;
+        }
+
+        channels.insert(mChannelNames.at(id));
+        mask &= ~( 1ULL << id );
+    }
+
+    return channels;
+}
+
+/**
+ * /brief UserCount definition
+ */
+int PresenceIndex::UserCount() const
+{
+    return mUsers.count();
+}
+
+/**
+ * /brief channelId definition
+ */
+int PresenceIndex::channelId(QLatin1String channel, bool create)
+{
+    int id = mChannelIds.value(QByteArray::fromRawData(channel.data(), channel.size()), -1);
+    if ( id >= 0 || !create )
+    {
+        return id;
+    }
+
+    /* Assign the first free id */
+    for (id=0; id<PRESENCE_MAX_CHANNELS; id++)
+    {
+        if ( mChannelNames.at(id).isEmpty() )
+        {
+            mChannelNames[id] = QString(channel);
+            mChannelIds.insert(QByteArray(channel.data(), channel.size()), id);
+            return id;
+        }
+    }
+
+    return -1;
+}
@@ -0,0 +1,139 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    presenceindex.h
+ * /author  Hackspider
+ * /brief   Header file of the index of the users present in the connected channels
+ */
+
+/* Include Guard */
+#ifndef PRESENCEINDEX_H
+#define PRESENCEINDEX_H
+
+/* Necessary dependencies to Qt framework */
+#include <QByteArray>
+#include <QHash>
+#include <QSet>
+#include <QString>
+#include <QVector>
+
+/* Maximum number of indexed channels (one bit per channel and user) */
+#define PRESENCE_MAX_CHANNELS 64
+
+/* Maximum number of indexed users (bounds the memory to a few ten megabytes) */
+#define PRESENCE_MAX_USERS 500000
+
+/* Maximum number of members of a complete channel (twitch lists only the moderators and sends no JOIN/PART beyond 1000 chatters) */
+#define PRESENCE_MAX_COMPLETE_MEMBERS 1000
+
+/**
+ * /brief  The PresenceIndex class declaration.
+ *
+ * Keeps the members of the channels as reported by the user lists and the
+ * JOIN/PART messages. Every indexed channel gets a small id and every user a
+ * 64 bit set of the channels it is present in, so the channels of a user are
+ * answered with a single hash lookup. Users are dropped as soon as they have
+ * left their last channel. Channels beyond PRESENCE_MAX_CHANNELS and users
+ * beyond PRESENCE_MAX_USERS are not indexed.
+ *
+ * A channel only counts as indexed once its user list is complete: the end of
+ * the list has been reported, no member has been dropped and the channel has
+ * no more than PRESENCE_MAX_COMPLETE_MEMBERS members.
+ */
+class PresenceIndex
+{
+public:
+    /**
+     * /brief  Constructor of the PresenceIndex class
+     */
+    PresenceIndex(void);
+
+    /**
+     * /brief  Method to add a user to a channel
+     * /param  channel   Name of the channel
+     * /param  userName  Name of the user
+     */
+    void Join(QLatin1String channel, QLatin1String userName);
+
+    /**
+     * /brief  Method to remove a user from a channel
+     * /param  channel   Name of the channel
+     * /param  userName  Name of the user
+     */
+    void Part(QLatin1String channel, QLatin1String userName);
+
+    /**
+     * /brief  Method to mark the user list of a channel as complete (end of the list of names)
+     * /param  channel  Name of the channel
+     */
+    void Complete(QLatin1String channel);
+
+    /**
+     * /brief  Method to remove a channel and all its members
+     * /param  channel  Name of the channel
+     */
+    void RemoveChannel(const QString& channel);
+
+    /**
+     * /brief  Method to remove all channels and users
+     */
+    void Clear(void);
+
+    /**
+     * /brief   Method to check if the members of a channel are indexed completely
+     * /param   channel  Name of the channel
+     * /return  Returns true if the channel is indexed and its user list is complete
+     */
+    bool IsIndexed(const QString& channel) const;
+
+    /**
+     * /brief   Method to get the channels a user is present in
+     * /param   userName  Name of the user
+     * /return  Returns the channels of the user (empty if the user hasn't been seen)
+     */
+    QSet<QString> Channels(const QString& userName) const;
+
+    /**
+     * /brief   Method to get the number of indexed users
+     * /return  Returns the number of users present in at least one channel
+     */
+    int UserCount(void) const;
+
+private:
+    /**
+     * /brief   Internally used method to get the id of a channel
+     * /param   channel  Name of the channel
+     * /param   create   Assign a free id if the channel has none yet
+     * /return  Returns the id of the channel or -1
+     */
+    int channelId(QLatin1String channel, bool create);
+
+    /**
+     * /brief Internal used variables
+     */
+    QHash<QByteArray, quint64> mUsers;
+    QHash<QByteArray, int> mChannelIds;
+    QVector<QString> mChannelNames;
+    QVector<int> mMemberCounts;
+    quint64 mCompleteChannels;
+    quint64 mTruncatedChannels;
+};
+
+#endif /* PRESENCEINDEX_H */
@@ -0,0 +1,226 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    raiddetector.cpp
+ * /author  Hackspider
+ * /brief   Source file of the detection of join bursts (raids) per channel
+ */
+
+/* Necessary dependencies to the standard library */
+#include <string.h>
+#include <math.h>
+
+/* Necessary internal dependencies */
+#include "raiddetector.h"
+
+/**
+ * /brief RaidDetector definition
+ */
+RaidDetector::RaidDetector()
+    : mFactor(RAID_DEFAULT_FACTOR),
+    mMinJoins(RAID_DEFAULT_MIN_JOINS)
+{
+}
+
+/**
+ * /brief SetThreshold definition
+ */
+void RaidDetector::SetThreshold(int factor, int minJoins)
+{
+    mFactor = factor;
+    mMinJoins = minJoins;
+    mChannels.clear();
+}
+
+/**
+ * /brief IsEnabled definition
+ */
+bool RaidDetector::IsEnabled() const
+{
+    return (mFactor > 0);
+}
+
+/**
+ * /brief Add definition
+ */
+bool RaidDetector::Add(QLatin1String channel, QLatin1String userName, qint64 timestamp, QStringList* users, int* joins, double* baseline)
+{
+    if ( !IsEnabled() )
+    {
+        return false;
+    }
+
+    qint64 second = timestamp / 1000;
+
+    /* Look up the channel without copying its name */
+    QHash<QByteArray, RaidChannel>::iterator it = mChannels.find(QByteArray::fromRawData(channel.data(), channel.size()));
+    if ( it == mChannels.end() )
+    {
+        RaidChannel empty;
+        empty.firstSecond = second;
+        empty.lastSecond = second;
+        empty.baseline = 0.0;
+        empty.windowJoins = 0;
+        memset(empty.counts, 0, sizeof(empty.counts));
+        empty.active = false;
+        empty.lastReport = 0;
+        empty.sequence = 0;
+        empty.reported = 0;
+        empty.joins.resize(RAID_MAX_USERS);
+
+        it = mChannels.insert(QByteArray(channel.data(), channel.size()), empty);
+    }
+    RaidChannel& state = it.value();
+
+    /* Count the join */
+    advance(state, second);
+    state.counts[ second % RAID_WINDOW ]++;
+    state.windowJoins++;
+
+    /* Keep the joining user in the ring */
+    RaidJoin& join = state.joins[ state.sequence % RAID_MAX_USERS ];
+    join.timestamp = timestamp;
+    join.length = qMin(userName.size(), RAID_NAME_LENGTH);
+    memcpy(join.name, userName.data(), join.length);
+    state.sequence++;
+
+    if (joins != nullptr)
+    {
+        *joins = state.windowJoins;
+    }
+    if (baseline != nullptr)
+    {
+        *baseline = state.baseline * RAID_WINDOW;
+    }
+
+    /* No raid while the channel is observed for the first time */
+    if ( second - state.firstSecond < RAID_WARMUP )
+    {
+        return false;
+    }
+
+    double threshold = qMax( (double)mMinJoins, mFactor * state.baseline * RAID_WINDOW );
+
+    /* A raid lasts as long as the recent joins are above the threshold */
+    int recentJoins = 0;
+    for (int i=0; i<RAID_RECENT; i++)
+    {
+        recentJoins += state.counts[ (second - i) % RAID_WINDOW ];
+    }
+    bool raiding = ( recentJoins * RAID_WINDOW > threshold * RAID_RECENT );
+
+    /* Start of a raid: report all users which joined within the window */
+    if ( !state.active )
+    {
+        if ( !raiding || state.windowJoins <= threshold )
+        {
+            return false;
+        }
+
+        state.active = true;
+        state.lastReport = timestamp;
+        collect(state, timestamp - RAID_WINDOW * 1000, users);
+        return true;
+    }
+
+    /* End of a raid, the users joining from now on are no raiders */
+    if ( !raiding )
+    {
+        state.active = false;
+        state.reported = state.sequence;
+        return false;
+    }
+
+    /* Ongoing raid: report the further users once per second */
+    if ( timestamp - state.lastReport < 1000 )
+    {
+        return false;
+    }
+
+    state.lastReport = timestamp;
+    collect(state, 0, users);
+    return true;
+}
+
+/**
+ * /brief Remove definition
+ */
+void RaidDetector::Remove(const QString& channel)
+{
+    mChannels.remove(channel.toUtf8());
+}
+
+/**
+ * /brief advance definition
+ */
+void RaidDetector::advance(RaidChannel& state, qint64 second) const
+{
+    if ( second <= state.lastSecond )
+    {
+        return;
+    }
+
+    qint64 elapsed = second - state.lastSecond;
+
+    /* Learn the baseline from the finished seconds, but neither from the initial joins nor from a raid */
+    if ( !state.active && state.lastSecond - state.firstSecond >= RAID_WARMUP )
+    {
+        /* A single second (e.g. the beginning of a raid) must not move the baseline by much */
+        double joins = qMin( (double)state.counts[ state.lastSecond % RAID_WINDOW ],
+                             qMax( mFactor * state.baseline, (double)mMinJoins / RAID_WINDOW ) );
+
+        state.baseline += ( joins - state.baseline ) / RAID_BASELINE_WEIGHT;
+        state.baseline *= pow( 1.0 - 1.0 / RAID_BASELINE_WEIGHT, (double)(elapsed - 1) );
+    }
+
+    /* Drop the seconds which left the window */
+    for (qint64 i=0; i<qMin(elapsed, (qint64)RAID_WINDOW); i++)
+    {
+        int& count = state.counts[ (second - i) % RAID_WINDOW ];
+        state.windowJoins -= count;
+        count = 0;
+    }
+
+    state.lastSecond = second;
+}
+
+/**
+ * /brief collect definition
+ */
+void RaidDetector::collect(RaidChannel& state, qint64 since, QStringList* users)
+{
+    /* Only the joins still kept in the ring can be reported */
+    quint64 first = state.reported;
+    if ( state.sequence - first > RAID_MAX_USERS )
+    {
+        first = state.sequence - RAID_MAX_USERS;
+    }
+
+    for (quint64 s=first; s<state.sequence; s++)
+    {
+        const RaidJoin& join = state.joins.at( s % RAID_MAX_USERS );
+        if ( join.timestamp >= since )
+        {
+            users->append( QString::fromUtf8(join.name, join.length) );
+        }
+    }
+
+    state.reported = state.sequence;
+}
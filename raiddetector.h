@@ -0,0 +1,158 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    raiddetector.h
+ * /author  Hackspider
+ * /brief   Header file of the detection of join bursts (raids) per channel
+ */
+
+/* Include Guard */
+#ifndef RAIDDETECTOR_H
+#define RAIDDETECTOR_H
+
+/* Necessary dependencies to Qt framework */
+#include <QByteArray>
+#include <QHash>
+#include <QStringList>
+#include <QVector>
+
+/* Length of the join window in seconds (one counter per second is kept) */
+#define RAID_WINDOW 30
+
+/* Length of the window in seconds which decides if a raid is still ongoing */
+#define RAID_RECENT 5
+
+/* Time in seconds a channel is observed before a raid is reported (the initial joins are no raid) */
+#define RAID_WARMUP 60
+
+/* Weight of a second in the learned baseline (the baseline adapts within a few minutes) */
+#define RAID_BASELINE_WEIGHT 256
+
+/* Number of recent joining users kept per channel (bounds the memory) */
+#define RAID_MAX_USERS 1024
+
+/* Maximum length of a kept user name (twitch names have up to 25 characters) */
+#define RAID_NAME_LENGTH 32
+
+/* Default factor of the baseline the joins within the window must exceed */
+#define RAID_DEFAULT_FACTOR 5
+
+/* Default minimum number of joins within the window of a raid */
+#define RAID_DEFAULT_MIN_JOINS 50
+
+/* Type of a joining user */
+typedef struct
+{
+    qint64 timestamp;
+    int length;
+    char name[RAID_NAME_LENGTH];
+} RaidJoin;
+
+/* Type of the join statistics of a channel */
+typedef struct
+{
+    qint64 firstSecond;
+    qint64 lastSecond;
+    double baseline;
+    int windowJoins;
+    int counts[RAID_WINDOW];
+    bool active;
+    qint64 lastReport;
+    quint64 sequence;
+    quint64 reported;
+    QVector<RaidJoin> joins;
+} RaidChannel;
+
+/**
+ * /brief  The RaidDetector class declaration.
+ *
+ * Counts the joins of every channel per second and learns the usual number of
+ * joins per second as a moving average. A raid is reported once the joins
+ * within the window exceed a multiple of the baseline (and a minimum number),
+ * together with the users which joined within the window. While the joins of
+ * the last RAID_RECENT seconds stay above the threshold, the further joining
+ * users are reported once per second and the baseline is frozen. The cost per join is a hash lookup of the channel and a
+ * copy of the name into a fixed ring, nothing is allocated after the first
+ * join of a channel.
+ */
+class RaidDetector
+{
+public:
+    /**
+     * /brief  Constructor of the RaidDetector class
+     */
+    RaidDetector(void);
+
+    /**
+     * /brief  Method to set the detection threshold, forgets all channels
+     * /param  factor    Factor of the baseline the joins within the window must exceed (0 disables the detection)
+     * /param  minJoins  Minimum number of joins within the window
+     */
+    void SetThreshold(int factor, int minJoins);
+
+    /**
+     * /brief   Method to check if the detection is enabled
+     * /return  Returns true if the detection is enabled
+     */
+    bool IsEnabled(void) const;
+
+    /**
+     * /brief   Method to add a join and to check the channel for a raid
+     * /param   channel    Channel of the join
+     * /param   userName   Joining user
+     * /param   timestamp  Monotonic time of the join in milliseconds
+     * /param   users      Returns the joining users which haven't been reported yet
+     * /param   joins      Returns the number of joins within the window (may be nullptr)
+     * /param   baseline   Returns the usual number of joins within the window (may be nullptr)
+     * /return  Returns true if there are raiding users to report
+     */
+    bool Add(QLatin1String channel, QLatin1String userName, qint64 timestamp, QStringList* users, int* joins, double* baseline);
+
+    /**
+     * /brief  Method to forget a channel (e.g. after it has been parted)
+     * /param  channel  Name of the channel
+     */
+    void Remove(const QString& channel);
+
+private:
+    /**
+     * /brief  Internally used method to move the window of a channel to the current second
+     * /param  state   Join statistics of the channel
+     * /param  second  Current second
+     */
+    void advance(RaidChannel& state, qint64 second) const;
+
+    /**
+     * /brief  Internally used method to collect the joining users which haven't been reported yet
+     * /param  state  Join statistics of the channel
+     * /param  since  Oldest time of a reported join in milliseconds
+     * /param  users  List to append the users to
+     */
+    static void collect(RaidChannel& state, qint64 since, QStringList* users);
+
+    /**
+     * /brief Internal used variables
+     */
+    QHash<QByteArray, RaidChannel> mChannels;
+    int mFactor;
+    int mMinJoins;
+};
+
+#endif /* RAIDDETECTOR_H */
@@ -0,0 +1,227 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    ratetracker.cpp
+ * /author  Hackspider
+ * /brief   Source file of the per-user message rate tracker
+ */
+
+/* Necessary dependencies to the standard library */
+#include <string.h>
+#include <algorithm>
+
+/* Necessary dependencies to Qt framework */
+#include <QHash>
+
+/* Necessary internal dependencies */
+#include "ratetracker.h"
+
+/**
+ * /brief  Helper to sort the reported users by the number of messages
+ * /param  left   First user
+ * /param  right  Second user
+ * /return Returns true if the first user has more messages
+ */
+static bool moreMessages(const RateTrackerUser& left, const RateTrackerUser& right)
+{
+    return ( left.longCount > right.longCount ||
+             ( left.longCount == right.longCount && left.shortCount > right.shortCount ) );
+}
+
+/**
+ * /brief RateTracker definition
+ */
+RateTracker::RateTracker()
+    : mShortLimit(0),
+    mLongLimit(0)
+{
+    /* Track with the default limits */
+    SetLimits(RATE_DEFAULT_SHORT_LIMIT, RATE_DEFAULT_LONG_LIMIT);
+}
+
+/**
+ * /brief SetLimits definition
+ */
+void RateTracker::SetLimits(int shortLimit, int longLimit)
+{
+    mShortLimit = shortLimit;
+    mLongLimit = longLimit;
+
+    /* The table is only allocated while a limit is enabled */
+    if ( IsEnabled() )
+    {
+        RateEntry empty;
+        empty.hash = 0;
+        empty.lastSecond = 0;
+        empty.flagged = false;
+        memset(empty.counts, 0, sizeof(empty.counts));
+
+        mEntries.fill(empty, RATE_TRACKER_SETS * RATE_TRACKER_WAYS);
+    }
+    else
+    {
+        mEntries.clear();
+    }
+}
+
+/**
+ * /brief IsEnabled definition
+ */
+bool RateTracker::IsEnabled() const
+{
+    return ( mShortLimit > 0 || mLongLimit > 0 );
+}
+
+/**
+ * /brief Record definition
+ */
+bool RateTracker::Record(QLatin1String userName, qint64 timestamp, int* shortCount, int* longCount)
+{
+    if ( !IsEnabled() )
+    {
+        return false;
+    }
+
+    qint64 second = timestamp / 1000;
+    uint hash = qHash(userName);
+    RateEntry* set = mEntries.data() + (hash % RATE_TRACKER_SETS) * RATE_TRACKER_WAYS;
+
+    /* Search the user within its set, remember the least recently seen entry for a replacement */
+    RateEntry* entry = nullptr;
+    RateEntry* oldest = set;
+    for (int way=0; way<RATE_TRACKER_WAYS; way++)
+    {
+        RateEntry* candidate = set + way;
+
+        if ( candidate->hash == hash &&
+             candidate->userName.size() == userName.size() &&
+             0 == memcmp(candidate->userName.constData(), userName.data(), userName.size()) )
+        {
+            entry = candidate;
+            break;
+        }
+
+        if ( candidate->userName.isEmpty() ||
+             ( !oldest->userName.isEmpty() && candidate->lastSecond < oldest->lastSecond ) )
+        {
+            oldest = candidate;
+        }
+    }
+
+    /* Replace the least recently seen user of the set */
+    if (entry == nullptr)
+    {
+        entry = oldest;
+        entry->userName = QByteArray(userName.data(), userName.size());
+        entry->hash = hash;
+        entry->lastSecond = second;
+        entry->flagged = false;
+        memset(entry->counts, 0, sizeof(entry->counts));
+    }
+
+    /* Reset the counters of the seconds without a message */
+    if (second > entry->lastSecond)
+    {
+        qint64 elapsed = qMin(second - entry->lastSecond, (qint64)RATE_WINDOW_LONG);
+        for (qint64 i=0; i<elapsed; i++)
+        {
+            entry->counts[ (second - i) % RATE_WINDOW_LONG ] = 0;
+        }
+        entry->lastSecond = second;
+    }
+
+    /* Count the message (saturating) */
+    quint8& counter = entry->counts[ entry->lastSecond % RATE_WINDOW_LONG ];
+    if (counter < 255)
+    {
+        counter++;
+    }
+
+    int shortMessages = countWindow(*entry, entry->lastSecond, RATE_WINDOW_SHORT);
+    int longMessages = countWindow(*entry, entry->lastSecond, RATE_WINDOW_LONG);
+
+    if (shortCount != nullptr)
+    {
+        *shortCount = shortMessages;
+    }
+    if (longCount != nullptr)
+    {
+        *longCount = longMessages;
+    }
+
+    /* Report a user once until the rate falls below the limits again */
+    bool exceeded = ( ( mShortLimit > 0 && shortMessages > mShortLimit ) ||
+                      ( mLongLimit > 0 && longMessages > mLongLimit ) );
+    bool report = ( exceeded && !entry->flagged );
+    entry->flagged = exceeded;
+
+    return report;
+}
+
+/**
+ * /brief TopUsers definition
+ */
+QList<RateTrackerUser> RateTracker::TopUsers(int count, qint64 timestamp) const
+{
+    qint64 second = timestamp / 1000;
+    QList<RateTrackerUser> users;
+
+    /* Collect all users with messages within the long window */
+    for (int i=0; i<mEntries.count(); i++)
+    {
+        const RateEntry& entry = mEntries.at(i);
+        if ( entry.userName.isEmpty() || entry.lastSecond <= second - RATE_WINDOW_LONG )
+        {
+            continue;
+        }
+
+        RateTrackerUser user;
+        user.userName = QString::fromUtf8(entry.userName);
+        user.shortCount = countWindow(entry, second, RATE_WINDOW_SHORT);
+        user.longCount = countWindow(entry, second, RATE_WINDOW_LONG);
+        users.append(user);
+    }
+
+    /* Only the first users have to be sorted */
+    count = qBound(0, count, users.count());
+    std::partial_sort(users.begin(), users.begin() + count, users.end(), moreMessages);
+
+    return users.mid(0, count);
+}
+
+/**
+ * /brief countWindow definition
+ */
+int RateTracker::countWindow(const RateEntry& entry, qint64 second, int window)
+{
+    int total = 0;
+
+    /* Only the seconds up to the last message of the user and within the last minute are valid */
+    for (qint64 s=second-window+1; s<=second; s++)
+    {
+        if ( s < 0 || s > entry.lastSecond || s <= entry.lastSecond - RATE_WINDOW_LONG )
+        {
+            continue;
+        }
+        total += entry.counts[ s % RATE_WINDOW_LONG ];
+    }
+
+    return total;
+}
@@ -0,0 +1,139 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    ratetracker.h
+ * /author  Hackspider
+ * /brief   Header file of the per-user message rate tracker
+ */
+
+/* Include Guard */
+#ifndef RATETRACKER_H
+#define RATETRACKER_H
+
+/* Necessary dependencies to Qt framework */
+#include <QByteArray>
+#include <QList>
+#include <QString>
+#include <QVector>
+
+/* Length of the short window in seconds */
+#define RATE_WINDOW_SHORT 5
+
+/* Length of the long window in seconds (one counter per second is kept) */
+#define RATE_WINDOW_LONG 60
+
+/* Number of sets of the tracker table */
+#define RATE_TRACKER_SETS 8192
+
+/* Number of users per set, the least recently seen user of a full set is replaced */
+#define RATE_TRACKER_WAYS 4
+
+/* Default maximum number of messages of a user within the short window */
+#define RATE_DEFAULT_SHORT_LIMIT 8
+
+/* Default maximum number of messages of a user within the long window */
+#define RATE_DEFAULT_LONG_LIMIT 40
+
+/* Type of a tracked user */
+typedef struct
+{
+    QByteArray userName;
+    uint hash;
+    qint64 lastSecond;
+    bool flagged;
+    quint8 counts[RATE_WINDOW_LONG];
+} RateEntry;
+
+/* Type of a user reported by the tracker */
+typedef struct
+{
+    QString userName;
+    int shortCount;
+    int longCount;
+} RateTrackerUser;
+
+/**
+ * /brief  The RateTracker class declaration.
+ *
+ * Counts the messages of every user per second over the last minute. The
+ * users live in a fixed set associative table (RATE_TRACKER_SETS *
+ * RATE_TRACKER_WAYS entries): a user is looked up in the few entries of its
+ * set only, and a new user replaces the least recently seen user of the set.
+ * So the memory is bounded no matter how many users are seen per day, and
+ * idle users age out on their own.
+ */
+class RateTracker
+{
+public:
+    /**
+     * /brief  Constructor of the RateTracker class
+     */
+    RateTracker(void);
+
+    /**
+     * /brief  Method to set the limits, forgets all tracked users
+     * /param  shortLimit  Maximum number of messages within the short window (0 disables the limit)
+     * /param  longLimit   Maximum number of messages within the long window (0 disables the limit)
+     */
+    void SetLimits(int shortLimit, int longLimit);
+
+    /**
+     * /brief   Method to check if any limit is enabled
+     * /return  Returns true if any limit is enabled
+     */
+    bool IsEnabled(void) const;
+
+    /**
+     * /brief   Method to count a message of a user
+     * /param   userName    Author of the message
+     * /param   timestamp   Monotonic time of the message in milliseconds
+     * /param   shortCount  Returns the number of messages within the short window (may be nullptr)
+     * /param   longCount   Returns the number of messages within the long window (may be nullptr)
+     * /return  Returns true if the user exceeds a limit and hasn't been reported since the last time below the limits
+     */
+    bool Record(QLatin1String userName, qint64 timestamp, int* shortCount, int* longCount);
+
+    /**
+     * /brief   Method to get the users with the most messages within the long window
+     * /param   count      Maximum number of users (nothing is returned for a count below 1)
+     * /param   timestamp  Current monotonic time in milliseconds
+     * /return  Returns the users sorted by the number of messages (most first)
+     */
+    QList<RateTrackerUser> TopUsers(int count, qint64 timestamp) const;
+
+private:
+    /**
+     * /brief   Internally used method to sum up the counters of a user
+     * /param   entry   Tracked user
+     * /param   second  Current second
+     * /param   window  Length of the window in seconds
+     * /return  Returns the number of messages within the window
+     */
+    static int countWindow(const RateEntry& entry, qint64 second, int window);
+
+    /**
+     * /brief Internal used variables
+     */
+    QVector<RateEntry> mEntries;
+    int mShortLimit;
+    int mLongLimit;
+};
+
+#endif /* RATETRACKER_H */
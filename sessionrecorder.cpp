@@ -0,0 +1,210 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    sessionrecorder.cpp
+ * /author  Hackspider
+ * /brief   Source file of the recorder and reader of raw twitch sessions
+ */
+
+/* Necessary dependencies to Qt framework */
+#include <QtEndian>
+#include <QMutexLocker>
+
+/* Necessary internal dependencies */
+#include "sessionrecorder.h"
+
+/* Size of the header of a single record */
+#define RECORD_HEADER_SIZE 13
+
+/* Size of pending data which wakes up the recorder thread immediately */
+#define RECORD_FLUSH_SIZE (1024 * 1024)
+
+/* Maximum time in milliseconds until pending data is written */
+#define RECORD_FLUSH_INTERVAL 100
+
+/**
+ * /brief SessionRecorder definition
+ */
+SessionRecorder::SessionRecorder(QObject *parent)
+    : QThread(parent),
+    mRecording(false),
+    mStop(false)
+{
+    /* Nothing to do here */
+}
+
+/**
+ * /brief ~SessionRecorder definition
+ */
+SessionRecorder::~SessionRecorder()
+{
+    /* Make sure all pending data is written */
+    Stop();
+}
+
+/**
+ * /brief Start definition
+ */
+bool SessionRecorder::Start(const QString& fileName)
+{
+    /* Finish a running recording first */
+    Stop();
+
+    mFile.setFileName(fileName);
+    if ( !mFile.open(QIODevice::WriteOnly | QIODevice::Truncate) )
+    {
+        return false;
+    }
+
+    /* Write the magic bytes */
+    mFile.write(SESSION_FILE_MAGIC);
+
+    /* Start the recorder thread */
+    mStop = false;
+    mPending.clear();
+    mClock.start();
+    mRecording = true;
+    start(QThread::LowPriority);
+
+    return true;
+}
+
+/**
+ * /brief Stop definition
+ */
+void SessionRecorder::Stop()
+{
+    if ( !mRecording )
+    {
+        return;
+    }
+
+    /* Signal the recorder thread to write the remaining data and to finish */
+    mMutex.lock();
+    mRecording = false;
+    mStop = true;
+    mCondition.wakeOne();
+    mMutex.unlock();
+
+    wait();
+    mFile.close();
+}
+
+/**
+ * /brief IsRecording definition
+ */
+bool SessionRecorder::IsRecording() const
+{
+    return mRecording;
+}
+
+/**
+ * /brief Record definition
+ */
+void SessionRecorder::Record(RecordDirection direction, const QByteArray& data)
+{
+    if ( !mRecording || data.isEmpty() )
+    {
+        return;
+    }
+
+    /* Encode the record header */
+    char header[RECORD_HEADER_SIZE];
+    header[0] = (char)direction;
+    qToLittleEndian<quint64>((quint64)mClock.nsecsElapsed(), header + 1);
+    qToLittleEndian<quint32>((quint32)data.size(), header + 9);
+
+    /* Only append to the pending buffer, the file is written by the recorder thread */
+    QMutexLocker locker(&mMutex);
+    mPending.append(header, RECORD_HEADER_SIZE);
+    mPending.append(data);
+
+    if ( mPending.size() >= RECORD_FLUSH_SIZE )
+    {
+        mCondition.wakeOne();
+    }
+}
+
+/**
+ * /brief run definition
+ */
+void SessionRecorder::run()
+{
+    QByteArray writeBuffer;
+    bool stop = false;
+
+    while ( !stop )
+    {
+        /* Wait for pending data and swap it with the write buffer */
+        mMutex.lock();
+        if ( !mStop && mPending.size() < RECORD_FLUSH_SIZE )
+        {
+            mCondition.wait(&mMutex, RECORD_FLUSH_INTERVAL);
+        }
+        writeBuffer.swap(mPending);
+        stop = mStop;
+        mMutex.unlock();
+
+        /* Write the data without holding the lock */
+        if ( !writeBuffer.isEmpty() )
+        {
+            mFile.write(writeBuffer);
+            mFile.flush();
+            writeBuffer.clear();
+        }
+    }
+}
+
+/**
+ * /brief Open definition
+ */
+bool SessionReader::Open(const QString& fileName)
+{
+    mFile.setFileName(fileName);
+    if ( !mFile.open(QIODevice::ReadOnly) )
+    {
+        return false;
+    }
+
+    /* Check the magic bytes */
+    return ( mFile.read(qstrlen(SESSION_FILE_MAGIC)) == SESSION_FILE_MAGIC );
+}
+
+/**
+ * /brief ReadNext definition
+ */
+bool SessionReader::ReadNext(RecordDirection* direction, qint64* timestamp, QByteArray* data)
+{
+    /* Read the record header */
+    char header[RECORD_HEADER_SIZE];
+    if ( mFile.read(header, RECORD_HEADER_SIZE) != RECORD_HEADER_SIZE )
+    {
+        return false;
+    }
+
+    *direction = (RecordDirection)header[0];
+    *timestamp = (qint64)qFromLittleEndian<quint64>(header + 1);
+    quint32 length = qFromLittleEndian<quint32>(header + 9);
+
+    /* Read the raw data */
+    *data = mFile.read(length);
+
+    return ( (quint32)data->size() == length );
+}
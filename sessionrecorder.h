@@ -0,0 +1,144 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    sessionrecorder.h
+ * /author  Hackspider
+ * /brief   Header file of the recorder and reader of raw twitch sessions
+ */
+
+/* Include Guard */
+#ifndef SESSIONRECORDER_H
+#define SESSIONRECORDER_H
+
+/* Necessary dependencies to Qt framework */
+#include <QThread>
+#include <QFile>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QElapsedTimer>
+#include <QByteArray>
+
+/* Magic bytes at the beginning of every session file */
+#define SESSION_FILE_MAGIC "LPZREC01"
+
+/* Type to distinguish the direction of recorded data */
+typedef enum
+{
+    RECORD_INBOUND = 0,
+    RECORD_OUTBOUND,
+} RecordDirection;
+
+/**
+ * /brief  The SessionRecorder class declaration. Derived from QThread class.
+ *
+ * The session file starts with SESSION_FILE_MAGIC followed by records of
+ * 1 byte direction, 8 byte monotonic timestamp in nanoseconds, 4 byte length
+ * (all little endian) and the raw data. Record() only appends to a buffer, the
+ * file is written by the recorder thread.
+ */
+class SessionRecorder : public QThread
+{
+    Q_OBJECT
+public:
+    /**
+     * /brief  Constructor of the SessionRecorder class
+     * /param  parent  Parent of the SessionRecorder object according to Qt's object tree
+     */
+    explicit SessionRecorder(QObject *parent = nullptr);
+
+    /**
+     * /brief  Destructor of the SessionRecorder class
+     */
+    virtual ~SessionRecorder(void);
+
+    /**
+     * /brief   Method to start the recording into a file
+     * /param   fileName  Name of the session file
+     * /return  Returns true if the file could be opened
+     */
+    bool Start(const QString& fileName);
+
+    /**
+     * /brief  Method to stop the recording, all pending data is written before the method returns
+     */
+    void Stop(void);
+
+    /**
+     * /brief   Method to get the recording state
+     * /return  Returns true if the recorder is recording
+     */
+    bool IsRecording(void) const;
+
+    /**
+     * /brief  Method to record raw data (cheap, the data is only appended to the pending buffer)
+     * /param  direction  Direction of the data
+     * /param  data       Raw data
+     */
+    void Record(RecordDirection direction, const QByteArray& data);
+
+protected:
+    /**
+     * /brief  Recorder thread which writes the pending data into the file
+     */
+    void run(void);
+
+private:
+    /**
+     * /brief Internal used variables
+     */
+    QFile mFile;
+    QMutex mMutex;
+    QWaitCondition mCondition;
+    QByteArray mPending;
+    QElapsedTimer mClock;
+    bool mRecording;
+    bool mStop;
+};
+
+/**
+ * /brief  The SessionReader class declaration. Reads the records of a session file.
+ */
+class SessionReader
+{
+public:
+    /**
+     * /brief   Method to open a session file
+     * /param   fileName  Name of the session file
+     * /return  Returns true if the file could be opened and is a session file
+     */
+    bool Open(const QString& fileName);
+
+    /**
+     * /brief   Method to read the next record
+     * /param   direction  Pointer to store the direction of the record
+     * /param   timestamp  Pointer to store the timestamp of the record in nanoseconds
+     * /param   data       Pointer to store the raw data of the record
+     * /return  Returns false at the end of the file
+     */
+    bool ReadNext(RecordDirection* direction, qint64* timestamp, QByteArray* data);
+
+private:
+    /**
+     * /brief Internal used variables
+     */
+    QFile mFile;
+};
+
+#endif /* SESSIONRECORDER_H */
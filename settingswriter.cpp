@@ -0,0 +1,110 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    settingswriter.cpp
+ * /author  Hackspider
+ * /brief   Source file of the settings writer which persists the channel and user models
+ */
+
+/* Necessary internal dependencies */
+#include "settingswriter.h"
+#include "tracer.h"
+
+/**
+ * /brief WriteChannels definition
+ */
+void SettingsWriter::WriteChannels(QSettings* settings, QStandardItemModel* channelModel)
+{
+    /* Trace the persistence write */
+    TRACE_SPAN("SettingsWriter::WriteChannels");
+
+    /* First of all remove all channels from config */
+    settings->remove("channels");
+
+    /* Start the new channels array */
+    settings->beginWriteArray("channels");
+
+    /* Iterate over the whole channel model and store every entry in a separate settings object */
+    for (int i = 0; i< channelModel->rowCount(); i++)
+    {
+        /* Set the current array index based on the channel model */
+        settings->setArrayIndex(i);
+
+        /* Save the channel name */
+        settings->setValue("channelName",channelModel->item(i)->text());
+
+        /* Save the default connect value based on the check state of the channel's check box */
+        if ( Qt::Checked == channelModel->item(i)->checkState())
+        {
+            settings->setValue("channelDefaultConnect","true");
+        }
+        else
+        {
+            settings->setValue("channelDefaultConnect","false");
+        }
+    }
+
+    /* Complete array */
+    settings->endArray();
+}
+
+/**
+ * /brief WriteUsers definition
+ */
+void SettingsWriter::WriteUsers(QSettings* settings, QStandardItemModel* userModel)
+{
+    /* Trace the persistence write */
+    TRACE_SPAN("SettingsWriter::WriteUsers");
+
+    /* First of all remove all users from config */
+    settings->remove("users");
+
+    /* Start the new user array */
+    settings->beginWriteArray("users");
+
+    /* Iterate over the whole user model and store every entry in a separate settings object */
+    for (int i = 0; i< userModel->rowCount(); i++)
+    {
+        /* Set the current array index based on the user model */
+        settings->setArrayIndex(i);
+
+        /* Save the timestamp */
+        settings->setValue("timestamp",userModel->item(i,0)->text());
+
+        /* Save the username */
+        settings->setValue("username",userModel->item(i,1)->text());
+
+        /* Save the channel names */
+        settings->setValue("channelNames",userModel->item(i,2)->text());
+
+        /* Save the ban reason */
+        settings->setValue("banReason",userModel->item(i,3)->text());
+
+        /* Save the ban reason */
+        settings->setValue("banURL",userModel->item(i,4)->text());
+
+        /* Save the recent messages of the user */
+        QStandardItem* evidence = userModel->item(i,5);
+        settings->setValue("banEvidence", (evidence != nullptr) ? evidence->text() : QString());
+    }
+
+    /* Complete array */
+    settings->endArray();
+}
@@ -0,0 +1,55 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    settingswriter.h
+ * /author  Hackspider
+ * /brief   Header file of the settings writer which persists the channel and user models
+ */
+
+/* Include Guard */
+#ifndef SETTINGSWRITER_H
+#define SETTINGSWRITER_H
+
+/* Necessary dependencies to Qt framework */
+#include <QSettings>
+#include <QStandardItemModel>
+
+/**
+ * /brief  The SettingsWriter class declaration. Collection of static methods to store the models into the config file.
+ */
+class SettingsWriter
+{
+public:
+    /**
+     * /brief  Method to write the whole channel model into the "channels" array of the settings
+     * /param  settings      Pointer to the settings the channels shall be written to
+     * /param  channelModel  Pointer to the channel model
+     */
+    static void WriteChannels(QSettings* settings, QStandardItemModel* channelModel);
+
+    /**
+     * /brief  Method to write the whole user model into the "users" array of the settings
+     * /param  settings   Pointer to the settings the users shall be written to
+     * /param  userModel  Pointer to the user model
+     */
+    static void WriteUsers(QSettings* settings, QStandardItemModel* userModel);
+};
+
+#endif /* SETTINGSWRITER_H */
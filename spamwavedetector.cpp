@@ -0,0 +1,326 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    spamwavedetector.cpp
+ * /author  Hackspider
+ * /brief   Source file of the cross-channel spam wave detector
+ */
+
+/* Necessary dependencies to Qt framework */
+#include <QtAlgorithms>
+
+/* Necessary internal dependencies */
+#include "spamwavedetector.h"
+
+/* Maximum number of characters of a message that are fingerprinted (twitch limits messages to 500) */
+#define SPAM_WAVE_MAX_TEXT 500
+
+/* Number of 8 bit bands of the fingerprint used as bucket keys (must exceed SPAM_WAVE_MAX_DISTANCE) */
+#define SPAM_WAVE_BANDS 8
+
+/**
+ * /brief  Helper to spread a character trigram over 64 bits (finalizer of splitmix64)
+ * /param  trigram  Three characters packed into the lower 24 bits
+ * /return Returns the 64 bit hash of the trigram
+ */
+static quint64 hashTrigram(quint32 trigram)
+{
+    quint64 hash = trigram + 0x9E3779B97F4A7C15ULL;
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+    return hash ^ (hash >> 31);
+}
+
+/**
+ * /brief SpamWaveDetector definition
+ */
+SpamWaveDetector::SpamWaveDetector()
+    : mSequence(0),
+    mMinChannels(0),
+    mWindow(0)
+{
+    /* Detect waves with the default threshold */
+    SetThreshold(SPAM_WAVE_DEFAULT_CHANNELS, SPAM_WAVE_DEFAULT_WINDOW);
+}
+
+/**
+ * /brief SetThreshold definition
+ */
+void SpamWaveDetector::SetThreshold(int minChannels, qint64 window)
+{
+    mMinChannels = minChannels;
+    mWindow = window;
+
+    /* Forget all recent messages and reports */
+    mSequence = 0;
+    mBuckets.clear();
+    mReported.clear();
+
+    /* The ring of recent messages is only allocated while the detection is enabled */
+    if ( IsEnabled() )
+    {
+        mEntries.fill(SpamWaveEntry(), SPAM_WAVE_CAPACITY);
+    }
+    else
+    {
+        mEntries.clear();
+    }
+}
+
+/**
+ * /brief IsEnabled definition
+ */
+bool SpamWaveDetector::IsEnabled() const
+{
+    return ( mMinChannels >= 2 && mWindow > 0 );
+}
+
+/**
+ * /brief Fingerprint definition
+ */
+quint64 SpamWaveDetector::Fingerprint(const char* data, int length, int* normalizedLength)
+{
+    int votes[64] = {0};
+    quint32 trigram = 0;
+    unsigned char previous = 0;
+    int kept = 0;
+
+    for (int i=0; i<length && kept<SPAM_WAVE_MAX_TEXT; i++)
+    {
+        unsigned char byte = (unsigned char)data[i];
+
+        /* Ignore the case of ASCII letters */
+        if ( byte >= 'A' && byte <= 'Z' )
+        {
+            byte += 'a' - 'A';
+        }
+
+        /* Ignore white space and punctuation, multi byte characters (e.g. emojis) are kept */
+        if ( byte < 0x80 && !( (byte >= 'a' && byte <= 'z') || (byte >= '0' && byte <= '9') ) )
+        {
+            continue;
+        }
+
+        /* Ignore repeated characters (e.g. "freeeee") */
+        if ( kept > 0 && byte == previous )
+        {
+            continue;
+        }
+        previous = byte;
+        kept++;
+
+        /* Every trigram votes for the bits of its hash */
+        trigram = ( (trigram << 8) | byte ) & 0xFFFFFF;
+        if (kept >= 3)
+        {
+            quint64 hash = hashTrigram(trigram);
+            for (int bit=0; bit<64; bit++)
+            {
+                votes[bit] += ( (hash >> bit) & 1 ) ? 1 : -1;
+            }
+        }
+    }
+
+    if (normalizedLength != nullptr)
+    {
+        *normalizedLength = kept;
+    }
+
+    /* Every bit with a majority of votes is set */
+    quint64 fingerprint = 0;
+    for (int bit=0; bit<64; bit++)
+    {
+        if (votes[bit] > 0)
+        {
+            fingerprint |= (quint64)1 << bit;
+        }
+    }
+
+    return fingerprint;
+}
+
+/**
+ * /brief Add definition
+ */
+bool SpamWaveDetector::Add(QLatin1String userName, QLatin1String channel, const char* data, int length, qint64 timestamp, QStringList* users, QSet<QString>* channels)
+{
+    if ( !IsEnabled() )
+    {
+        return false;
+    }
+
+    /* Short messages (e.g. single emotes) are posted everywhere and are never a wave */
+    int normalizedLength = 0;
+    quint64 fingerprint = Fingerprint(data, length, &normalizedLength);
+    if (normalizedLength < SPAM_WAVE_MIN_LENGTH)
+    {
+        return false;
+    }
+
+    QByteArray channelName(channel.data(), channel.size());
+
+    /* Collect the recent copies of the message from the buckets of all bands */
+    QSet<QByteArray> waveChannels;
+    QList<QByteArray> authors;
+    waveChannels.insert(channelName);
+
+    for (int band=0; band<SPAM_WAVE_BANDS; band++)
+    {
+        quint32 key = ( (quint32)band << 8 ) | (quint32)( (fingerprint >> (band * 8)) & 0xFF );
+
+        QHash<quint32, QVector<quint64> >::iterator bucket = mBuckets.find(key);
+        if ( bucket == mBuckets.end() )
+        {
+            continue;
+        }
+
+        /* The oldest messages are at the front, drop the expired ones */
+        QVector<quint64>& sequences = bucket.value();
+        int expired = 0;
+        while ( expired < sequences.count() && !isValid(sequences.at(expired), timestamp) )
+        {
+            expired++;
+        }
+        if (expired > 0)
+        {
+            sequences.remove(0, expired);
+        }
+
+        /* Compare the newest messages only */
+        int compared = 0;
+        for (int i=sequences.count()-1; i>=0 && compared<SPAM_WAVE_MAX_CANDIDATES; i--, compared++)
+        {
+            const SpamWaveEntry& entry = mEntries.at( (int)(sequences.at(i) % SPAM_WAVE_CAPACITY) );
+
+            if ( qPopulationCount(entry.fingerprint ^ fingerprint) <= SPAM_WAVE_MAX_DISTANCE )
+            {
+                authors.append(entry.userName);
+                waveChannels.insert(entry.channel);
+            }
+        }
+    }
+
+    /* Add the message to the ring (overwrites the oldest message) and to the buckets */
+    quint64 sequence = mSequence++;
+    SpamWaveEntry& entry = mEntries[ (int)(sequence % SPAM_WAVE_CAPACITY) ];
+    entry.fingerprint = fingerprint;
+    entry.timestamp = timestamp;
+    entry.userName = QByteArray(userName.data(), userName.size());
+    entry.channel = channelName;
+
+    for (int band=0; band<SPAM_WAVE_BANDS; band++)
+    {
+        quint32 key = ( (quint32)band << 8 ) | (quint32)( (fingerprint >> (band * 8)) & 0xFF );
+        mBuckets[key].append(sequence);
+    }
+
+    /* Drop the buckets of overwritten messages once per round of the ring */
+    if (mSequence % SPAM_WAVE_CAPACITY == 0)
+    {
+        sweep(timestamp);
+    }
+
+    /* No wave unless the message has been seen in enough channels */
+    if (waveChannels.count() < mMinChannels)
+    {
+        return false;
+    }
+
+    /* Report every author once per window */
+    users->clear();
+    channels->clear();
+    authors.append(entry.userName);
+
+    foreach (const QByteArray& author, authors)
+    {
+        QHash<QByteArray, qint64>::iterator reported = mReported.find(author);
+        if ( reported != mReported.end() && reported.value() >= timestamp - mWindow )
+        {
+            continue;
+        }
+
+        mReported.insert(author, timestamp);
+        users->append(QString::fromUtf8(author));
+    }
+
+    foreach (const QByteArray& waveChannel, waveChannels)
+    {
+        channels->insert(QString::fromUtf8(waveChannel));
+    }
+
+    return !users->isEmpty();
+}
+
+/**
+ * /brief isValid definition
+ */
+bool SpamWaveDetector::isValid(quint64 sequence, qint64 timestamp) const
+{
+    /* The message has been overwritten by a newer one */
+    if (sequence + SPAM_WAVE_CAPACITY < mSequence)
+    {
+        return false;
+    }
+
+    /* The message is older than the window */
+    return ( mEntries.at( (int)(sequence % SPAM_WAVE_CAPACITY) ).timestamp >= timestamp - mWindow );
+}
+
+/**
+ * /brief sweep definition
+ */
+void SpamWaveDetector::sweep(qint64 timestamp)
+{
+    /* Drop the expired messages of all buckets and the empty buckets */
+    QHash<quint32, QVector<quint64> >::iterator bucket = mBuckets.begin();
+    while ( bucket != mBuckets.end() )
+    {
+        QVector<quint64>& sequences = bucket.value();
+        int expired = 0;
+        while ( expired < sequences.count() && !isValid(sequences.at(expired), timestamp) )
+        {
+            expired++;
+        }
+        sequences.remove(0, expired);
+
+        if ( sequences.isEmpty() )
+        {
+            bucket = mBuckets.erase(bucket);
+        }
+        else
+        {
+            ++bucket;
+        }
+    }
+
+    /* Drop the expired reports */
+    QHash<QByteArray, qint64>::iterator reported = mReported.begin();
+    while ( reported != mReported.end() )
+    {
+        if (reported.value() < timestamp - mWindow)
+        {
+            reported = mReported.erase(reported);
+        }
+        else
+        {
+            ++reported;
+        }
+    }
+}
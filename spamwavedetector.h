@@ -0,0 +1,145 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    spamwavedetector.h
+ * /author  Hackspider
+ * /brief   Header file of the cross-channel spam wave detector
+ */
+
+/* Include Guard */
+#ifndef SPAMWAVEDETECTOR_H
+#define SPAMWAVEDETECTOR_H
+
+/* Necessary dependencies to Qt framework */
+#include <QByteArray>
+#include <QHash>
+#include <QSet>
+#include <QStringList>
+#include <QVector>
+
+/* Default number of channels a message must be seen in to be a spam wave */
+#define SPAM_WAVE_DEFAULT_CHANNELS 3
+
+/* Default time window of a spam wave in milliseconds */
+#define SPAM_WAVE_DEFAULT_WINDOW 30000
+
+/* Number of recent chat messages kept for the comparison (bounds the memory) */
+#define SPAM_WAVE_CAPACITY 8192
+
+/* Maximum number of differing fingerprint bits of two messages treated as equal */
+#define SPAM_WAVE_MAX_DISTANCE 7
+
+/* Minimum number of normalized characters of a message to be fingerprinted */
+#define SPAM_WAVE_MIN_LENGTH 12
+
+/* Maximum number of recent messages compared per bucket (bounds the cost per message) */
+#define SPAM_WAVE_MAX_CANDIDATES 64
+
+/* Type of a fingerprinted chat message */
+typedef struct
+{
+    quint64 fingerprint;
+    qint64 timestamp;
+    QByteArray userName;
+    QByteArray channel;
+} SpamWaveEntry;
+
+/**
+ * /brief  The SpamWaveDetector class declaration.
+ *
+ * Every chat message is normalized (lower case, no punctuation or repeated
+ * characters) and reduced to a 64 bit SimHash of its character trigrams, so
+ * lightly mutated copies of a message differ in a few bits only. The
+ * fingerprints of the recent messages are indexed by eight 8 bit bands: two
+ * fingerprints within SPAM_WAVE_MAX_DISTANCE bits share at least one band, so
+ * only the messages of eight buckets have to be compared. A wave is reported
+ * once the same message has been posted in a minimum number of channels
+ * within the time window.
+ */
+class SpamWaveDetector
+{
+public:
+    /**
+     * /brief  Constructor of the SpamWaveDetector class
+     */
+    SpamWaveDetector(void);
+
+    /**
+     * /brief  Method to set the detection threshold, forgets all recent messages
+     * /param  minChannels  Number of channels a message must be seen in (less than 2 disables the detection)
+     * /param  window       Time window in milliseconds
+     */
+    void SetThreshold(int minChannels, qint64 window);
+
+    /**
+     * /brief   Method to check if the detection is enabled
+     * /return  Returns true if the detection is enabled
+     */
+    bool IsEnabled(void) const;
+
+    /**
+     * /brief   Method to add a chat message and to check it for a spam wave
+     * /param   userName   Author of the message
+     * /param   channel    Channel of the message
+     * /param   data       Pointer to the utf-8 text of the message
+     * /param   length     Length of the text
+     * /param   timestamp  Monotonic time of the message in milliseconds
+     * /param   users      Returns the authors of the wave which haven't been reported within the window
+     * /param   channels   Returns the channels where the wave has been seen
+     * /return  Returns true if the message belongs to a wave and there is at least one author to report
+     */
+    bool Add(QLatin1String userName, QLatin1String channel, const char* data, int length, qint64 timestamp, QStringList* users, QSet<QString>* channels);
+
+    /**
+     * /brief   Method to calculate the fingerprint of a text
+     * /param   data              Pointer to the utf-8 text
+     * /param   length            Length of the text
+     * /param   normalizedLength  Returns the number of characters after the normalization (may be nullptr)
+     * /return  Returns the 64 bit SimHash of the normalized text
+     */
+    static quint64 Fingerprint(const char* data, int length, int* normalizedLength);
+
+private:
+    /**
+     * /brief   Internally used method to check if a recent message is still part of the window
+     * /param   sequence   Sequence number of the message
+     * /param   timestamp  Current time in milliseconds
+     * /return  Returns true if the message hasn't been dropped or expired
+     */
+    bool isValid(quint64 sequence, qint64 timestamp) const;
+
+    /**
+     * /brief  Internally used method to drop expired messages and reports from the index
+     * /param  timestamp  Current time in milliseconds
+     */
+    void sweep(qint64 timestamp);
+
+    /**
+     * /brief Internal used variables
+     */
+    QVector<SpamWaveEntry> mEntries;
+    quint64 mSequence;
+    QHash<quint32, QVector<quint64> > mBuckets;
+    QHash<QByteArray, qint64> mReported;
+    int mMinChannels;
+    qint64 mWindow;
+};
+
+#endif /* SPAMWAVEDETECTOR_H */
@@ -0,0 +1,327 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    stallwatchdog.cpp
+ * /author  Hackspider
+ * /brief   Source file of the detection of event loop stalls and the handlers causing them
+ */
+
+/* Necessary dependencies to the standard library */
+#include <algorithm>
+
+/* Necessary dependencies to Qt framework */
+#include <QMetaObject>
+#include <QMutexLocker>
+#include <QDebug>
+
+/* Necessary internal dependencies */
+#include "stallwatchdog.h"
+
+/* Upper bounds of the histogram buckets in milliseconds, the last bucket is unbounded */
+static const int sBucketLimits[STALL_BUCKETS] = { 33, 50, 100, 250, 500, 1000, -1 };
+
+/* Handler marker of every thread */
+static thread_local QAtomicPointer<const char> sCurrentHandler(nullptr);
+
+/**
+ * /brief StallProbe definition
+ */
+StallProbe::StallProbe()
+    : QObject(nullptr),
+    mAnswered(0),
+    mHandler(nullptr)
+{
+    /* Nothing to do here */
+}
+
+/**
+ * /brief Answered definition
+ */
+quint64 StallProbe::Answered() const
+{
+    return mAnswered.loadAcquire();
+}
+
+/**
+ * /brief Handler definition
+ */
+QAtomicPointer<const char>* StallProbe::Handler() const
+{
+    return mHandler.loadAcquire();
+}
+
+/**
+ * /brief Pong definition
+ */
+void StallProbe::Pong(quint64 sequence)
+{
+    /* Answer with the handler marker of the watched thread */
+    mHandler.storeRelease(StallScope::Current());
+    mAnswered.storeRelease(sequence);
+}
+
+/**
+ * /brief StallWatchdog definition
+ */
+StallWatchdog::StallWatchdog(QThread* watched, int threshold, QObject *parent)
+    : QThread(parent),
+    mWatched(watched),
+    mThreshold(threshold),
+    mProbe(nullptr),
+    mStop(0)
+{
+    mHistogram.fill(0, STALL_BUCKETS);
+
+    /* The probe answers from the event loop of the watched thread */
+    mProbe = new StallProbe();
+    mProbe->moveToThread(mWatched);
+
+    mClock.start();
+    start(QThread::HighPriority);
+}
+
+/**
+ * /brief ~StallWatchdog definition
+ */
+StallWatchdog::~StallWatchdog()
+{
+    Stop();
+
+    /* The probe may still have a queued ping */
+    mProbe->deleteLater();
+}
+
+/**
+ * /brief Stop definition
+ */
+void StallWatchdog::Stop()
+{
+    mStop.storeRelease(1);
+    wait();
+}
+
+/**
+ * /brief run definition
+ */
+void StallWatchdog::run()
+{
+    quint64 sequence = 0;
+    qint64 sent = 0;
+    bool pending = false;
+    QHash<const char*, int> samples;
+
+    while ( 0 == mStop.loadAcquire() )
+    {
+        qint64 now = mClock.elapsed();
+
+        if ( pending && mProbe->Answered() == sequence )
+        {
+            /* The event loop has answered, record the latency if it has been a stall */
+            pending = false;
+            qint64 latency = now - sent;
+            if ( latency >= mThreshold )
+            {
+                recordStall(latency, samples);
+            }
+            samples.clear();
+        }
+
+        if ( !pending )
+        {
+            /* Ping the event loop of the watched thread */
+            if ( now - sent >= STALL_PING_INTERVAL )
+            {
+                sequence++;
+                sent = now;
+                pending = true;
+                QMetaObject::invokeMethod(mProbe, "Pong", Qt::QueuedConnection, Q_ARG(quint64, sequence));
+            }
+        }
+        else if ( now - sent >= mThreshold / 2 )
+        {
+            /* Sample the handler which keeps the event loop busy */
+            QAtomicPointer<const char>* handler = mProbe->Handler();
+            samples[ (handler != nullptr) ? handler->load() : nullptr ]++;
+        }
+
+        /* Sample only while a ping is pending, otherwise sleep until the next ping is due */
+        if (pending)
+        {
+            msleep(STALL_SAMPLE_INTERVAL);
+        }
+        else
+        {
+            msleep( (unsigned long)qMax((qint64)1, sent + STALL_PING_INTERVAL - mClock.elapsed()) );
+        }
+    }
+}
+
+/**
+ * /brief recordStall definition
+ */
+void StallWatchdog::recordStall(qint64 duration, const QHash<const char*, int>& samples)
+{
+    /* The handler seen most often is the offender */
+    const char* offender = nullptr;
+    int most = 0;
+    for (QHash<const char*, int>::const_iterator it = samples.constBegin(); it != samples.constEnd(); ++it)
+    {
+        if ( it.value() > most )
+        {
+            most = it.value();
+            offender = it.key();
+        }
+    }
+    QString handler = (offender != nullptr) ? QString(offender) : QString("event loop");
+
+    if ( duration >= STALL_WARN_THRESHOLD )
+    {
+        qWarning().noquote() << "Event loop of" << mWatched->objectName() << "stalled for" << duration << "ms in" << handler;
+    }
+
+    QMutexLocker locker(&mMutex);
+
+    /* Count the stall in its bucket */
+    int bucket = 0;
+    while ( bucket < STALL_BUCKETS - 1 && duration >= sBucketLimits[bucket] )
+    {
+        bucket++;
+    }
+    mHistogram[bucket]++;
+
+    /* Add the stall to its handler */
+    QHash<QString, StallOffender>::iterator entry = mOffenders.find(handler);
+    if ( entry == mOffenders.end() )
+    {
+        StallOffender newOffender;
+        newOffender.handler = handler;
+        newOffender.count = 0;
+        newOffender.totalTime = 0;
+        newOffender.maxTime = 0;
+        entry = mOffenders.insert(handler, newOffender);
+    }
+    entry.value().count++;
+    entry.value().totalTime += duration;
+    entry.value().maxTime = qMax(entry.value().maxTime, duration);
+}
+
+/**
+ * /brief Histogram definition
+ */
+QVector<int> StallWatchdog::Histogram() const
+{
+    QMutexLocker locker(&mMutex);
+    return mHistogram;
+}
+
+/**
+ * /brief BucketLimit definition
+ */
+int StallWatchdog::BucketLimit(int bucket) const
+{
+    return (bucket >= 0 && bucket < STALL_BUCKETS) ? sBucketLimits[bucket] : -1;
+}
+
+/**
+ * /brief TopOffenders definition
+ */
+QList<StallOffender> StallWatchdog::TopOffenders(int count) const
+{
+    mMutex.lock();
+    QList<StallOffender> offenders = mOffenders.values();
+    mMutex.unlock();
+
+    /* Most stall time first */
+    std::sort(offenders.begin(), offenders.end(), [](const StallOffender& a, const StallOffender& b) { return a.totalTime > b.totalTime; });
+
+    return offenders.mid(0, count);
+}
+
+/**
+ * /brief Report definition
+ */
+QString StallWatchdog::Report(int count) const
+{
+    QVector<int> histogram = Histogram();
+    QStringList lines;
+
+    int total = 0;
+    foreach (int stalls, histogram)
+    {
+        total += stalls;
+    }
+    lines << QString("%1: %2 stalls of at least %3 ms").arg(mWatched->objectName()).arg(total).arg(mThreshold);
+
+    /* One line per bucket */
+    int lower = mThreshold;
+    for (int i=0; i<histogram.count(); i++)
+    {
+        if ( BucketLimit(i) >= 0 && BucketLimit(i) <= lower )
+        {
+            /* Below the threshold */
+            continue;
+        }
+
+        if ( BucketLimit(i) < 0 )
+        {
+            lines << QString("  >= %1 ms: %2").arg(lower).arg(histogram.at(i));
+        }
+        else
+        {
+            lines << QString("  %1-%2 ms: %3").arg(lower).arg(BucketLimit(i)).arg(histogram.at(i));
+            lower = BucketLimit(i);
+        }
+    }
+
+    /* One line per offender */
+    QList<StallOffender> offenders = TopOffenders(count);
+    foreach (const StallOffender& offender, offenders)
+    {
+        lines << QString("  %1: %2 stalls, %3 ms total, %4 ms max")
+                 .arg(offender.handler).arg(offender.count).arg(offender.totalTime).arg(offender.maxTime);
+    }
+
+    return lines.join('\n');
+}
+
+/**
+ * /brief StallScope definition
+ */
+StallScope::StallScope(const char* name)
+    : mPrevious(sCurrentHandler.load())
+{
+    sCurrentHandler.store(name);
+}
+
+/**
+ * /brief ~StallScope definition
+ */
+StallScope::~StallScope()
+{
+    sCurrentHandler.store(mPrevious);
+}
+
+/**
+ * /brief Current definition
+ */
+QAtomicPointer<const char>* StallScope::Current()
+{
+    return &sCurrentHandler;
+}
@@ -0,0 +1,230 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    stallwatchdog.h
+ * /author  Hackspider
+ * /brief   Header file of the detection of event loop stalls and the handlers causing them
+ */
+
+/* Include Guard */
+#ifndef STALLWATCHDOG_H
+#define STALLWATCHDOG_H
+
+/* Necessary dependencies to Qt framework */
+#include <QThread>
+#include <QAtomicInteger>
+#include <QAtomicPointer>
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QHash>
+#include <QVector>
+#include <QStringList>
+
+/* Default minimum latency of the event loop in milliseconds which counts as stall */
+#define STALL_DEFAULT_THRESHOLD 16
+
+/* Latency of the event loop in milliseconds which is logged as warning */
+#define STALL_WARN_THRESHOLD 100
+
+/* Interval in milliseconds the event loop is pinged */
+#define STALL_PING_INTERVAL 10
+
+/* Interval in milliseconds the watchdog checks for the answer and samples the running handler while a ping is pending */
+#define STALL_SAMPLE_INTERVAL 2
+
+/* Number of buckets of the stall histogram */
+#define STALL_BUCKETS 7
+
+/* Type of a handler which caused stalls */
+typedef struct
+{
+    QString handler;
+    int count;
+    qint64 totalTime;
+    qint64 maxTime;
+} StallOffender;
+
+/**
+ * /brief  The StallProbe class declaration. Derived from QObject class.
+ *
+ * Lives in the watched thread and answers the pings of the watchdog. The
+ * answer is kept by the probe, so a ping still queued when the watchdog is
+ * destroyed is harmless.
+ */
+class StallProbe : public QObject
+{
+    Q_OBJECT
+public:
+    /**
+     * /brief  Constructor of the StallProbe class
+     */
+    StallProbe(void);
+
+    /**
+     * /brief   Method to get the sequence number of the last answered ping
+     * /return  Returns the sequence number
+     */
+    quint64 Answered(void) const;
+
+    /**
+     * /brief   Method to get the handler marker of the watched thread
+     * /return  Returns the marker or nullptr before the first answer
+     */
+    QAtomicPointer<const char>* Handler(void) const;
+
+public slots:
+    /**
+     * /brief  Method called by the event loop of the watched thread for every ping
+     * /param  sequence  Sequence number of the ping
+     */
+    void Pong(quint64 sequence);
+
+private:
+    /**
+     * /brief Internal used variables
+     */
+    QAtomicInteger<quint64> mAnswered;
+    QAtomicPointer< QAtomicPointer<const char> > mHandler;
+};
+
+/**
+ * /brief  The StallWatchdog class declaration. Derived from QThread class.
+ *
+ * Pings the event loop of the watched thread every STALL_PING_INTERVAL
+ * milliseconds by a queued call and measures how long the answer takes. A
+ * latency above the threshold is a stall: it is counted in a histogram and
+ * attributed to the handler which has been running most of the time while
+ * the watchdog waited for the answer. The handlers are marked with
+ * STALL_SCOPE(name), which costs two thread local stores; a stall in code
+ * without a marked handler (e.g. painting or sorting of a view) is
+ * attributed to "event loop".
+ */
+class StallWatchdog : public QThread
+{
+    Q_OBJECT
+public:
+    /**
+     * /brief  Constructor of the StallWatchdog class
+     * /param  watched    Thread whose event loop is watched
+     * /param  threshold  Minimum latency in milliseconds which counts as stall
+     * /param  parent     Parent of the StallWatchdog object according to Qt's object tree
+     */
+    explicit StallWatchdog(QThread* watched, int threshold = STALL_DEFAULT_THRESHOLD, QObject *parent = nullptr);
+
+    /**
+     * /brief  Destructor of the StallWatchdog class
+     */
+    virtual ~StallWatchdog(void);
+
+    /**
+     * /brief  Method to stop the watchdog thread
+     */
+    void Stop(void);
+
+    /**
+     * /brief   Method to get the histogram of the stalls
+     * /return  Returns the number of stalls per bucket (bucket bounds by BucketLimit)
+     */
+    QVector<int> Histogram(void) const;
+
+    /**
+     * /brief   Method to get the upper bound of a bucket of the histogram
+     * /param   bucket  Index of the bucket
+     * /return  Returns the upper bound in milliseconds (-1 for the last, unbounded bucket)
+     */
+    int BucketLimit(int bucket) const;
+
+    /**
+     * /brief   Method to get the handlers which caused the most stall time
+     * /param   count  Maximum number of handlers
+     * /return  Returns the handlers sorted by their total stall time (most first)
+     */
+    QList<StallOffender> TopOffenders(int count) const;
+
+    /**
+     * /brief   Method to get a readable report of the histogram and the top offenders
+     * /param   count  Maximum number of handlers
+     * /return  Returns the report, one line per bucket and handler
+     */
+    QString Report(int count = 10) const;
+
+protected:
+    /**
+     * /brief  Watchdog thread which pings the watched thread and samples its handler
+     */
+    void run(void);
+
+private:
+    /**
+     * /brief  Internally used method to record a stall
+     * /param  duration  Latency of the event loop in milliseconds
+     * /param  samples   Number of samples per handler during the stall
+     */
+    void recordStall(qint64 duration, const QHash<const char*, int>& samples);
+
+    /**
+     * /brief Internal used variables
+     */
+    QThread* mWatched;
+    int mThreshold;
+    StallProbe* mProbe;
+    QElapsedTimer mClock;
+    QAtomicInt mStop;
+    mutable QMutex mMutex;
+    QVector<int> mHistogram;
+    QHash<QString, StallOffender> mOffenders;
+};
+
+/**
+ * /brief  The StallScope class declaration. Marks the handler running in the current thread for the lifetime of the object.
+ */
+class StallScope
+{
+public:
+    /**
+     * /brief  Constructor of the StallScope class
+     * /param  name  Name of the handler (string literal, not copied)
+     */
+    explicit StallScope(const char* name);
+
+    /**
+     * /brief  Destructor of the StallScope class, marks the previous handler again
+     */
+    ~StallScope(void);
+
+    /**
+     * /brief   Method to get the handler marker of the current thread
+     * /return  Returns the marker
+     */
+    static QAtomicPointer<const char>* Current(void);
+
+private:
+    /**
+     * /brief Internal used variables
+     */
+    const char* mPrevious;
+};
+
+/* Mark the enclosing block as handler for the stall attribution */
+#define STALL_CONCAT_(a, b) a##b
+#define STALL_CONCAT(a, b) STALL_CONCAT_(a, b)
+#define STALL_SCOPE(name) StallScope STALL_CONCAT(stallScope, __LINE__)(name)
+
+#endif /* STALLWATCHDOG_H */
@@ -0,0 +1,1129 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    connectortest.cpp
+ * /author  Hackspider
+ * /brief   Unit tests of the twitch connector and its models
+ */
+
+/* Necessary dependencies to Qt framework */
+#include <QtTest>
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QTemporaryDir>
+
+/* Necessary internal dependencies */
+#include "commandqueue.h"
+#include "banstate.h"
+#include "twitchconnector.h"
+#include "presenceindex.h"
+#include "banlist.h"
+#include "usernamematcher.h"
+#include "keywordmatcher.h"
+
+/* Time in milliseconds to wait for the local test server */
+#define TEST_TIMEOUT 5000
+
+/**
+ * /brief  The ConnectorTest class declaration. Derived from QObject class.
+ */
+class ConnectorTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    /**
+     * /brief  Test that a command which is queued twice is sent once
+     */
+    void commandQueueDeduplicates(void);
+
+    /**
+     * /brief  Test that an answer belongs to the oldest unanswered command of its channel
+     */
+    void commandQueueAnswersOldest(void);
+
+    /**
+     * /brief  Test the additive increase and the multiplicative decrease of the send rate
+     */
+    void commandQueueLearnsRate(void);
+
+    /**
+     * /brief  Test the exponential backoff of a rate limited channel
+     */
+    void commandQueueBacksOff(void);
+
+    /**
+     * /brief  Test that an unanswered command is sent again and given up after the last attempt
+     */
+    void commandQueueRetries(void);
+
+    /**
+     * /brief  Test that the unanswered commands are sent again in order after a reconnect
+     */
+    void commandQueueRequeues(void);
+
+    /**
+     * /brief  Test that all pending and unanswered commands can be passed to another connection
+     */
+    void commandQueueTakesAll(void);
+
+    /**
+     * /brief  Test the known bans of the users (case insensitive names)
+     */
+    void banStateTracksChannels(void);
+
+    /**
+     * /brief  Test that a ban skips the channels where the ban is known or has been acknowledged
+     */
+    void banSkipsKnownBans(void);
+
+    /**
+     * /brief  Test that a failed unban keeps the ban known
+     */
+    void unbanKeepsBanOnFailure(void);
+
+    /**
+     * /brief  Test that a ban leaves out the channels where the badges show no moderator status
+     */
+    void banPrunesUnmoderatedChannels(void);
+
+    /**
+     * /brief  Test that a no_permission answer gives up the queued commands of its channel
+     */
+    void noPermissionPrunesChannel(void);
+
+    /**
+     * /brief  Test the moderator status of a further account
+     */
+    void accountLearnsModeratorStatus(void);
+
+    /**
+     * /brief  Test that a ban is spread across the accounts, a confirmed moderator before an unknown status
+     */
+    void banRoutesAcrossAccounts(void);
+
+    /**
+     * /brief  Test that the commands of an account without permission or connection are passed to the others
+     */
+    void accountReroutesCommands(void);
+
+    /**
+     * /brief  Test that the standby connection takes over a lost connection without a state change
+     */
+    void standbyTakesOver(void);
+
+    /**
+     * /brief  Test that a keyword only matches whole words, case insensitive
+     */
+    void keywordMatchesWholeWords(void);
+
+    /**
+     * /brief  Test the '*' edges of a keyword and the edges which aren't word characters
+     */
+    void keywordOpensEdges(void);
+
+    /**
+     * /brief  Test terms which overlap or share their bytes
+     */
+    void keywordMatchesOverlappingTerms(void);
+
+    /**
+     * /brief  Test every construct of the username patterns
+     */
+    void usernamePatternMatchesConstructs(void);
+
+    /**
+     * /brief  Test that the first of several matching patterns is reported
+     */
+    void usernamePatternReportsFirstMatch(void);
+
+    /**
+     * /brief  Test that a malformed pattern is rejected and the previous patterns are kept
+     */
+    void usernamePatternRejectsMalformed(void);
+
+    /**
+     * /brief  Test that patterns exceeding USERNAME_PATTERN_MAX_STATES are rejected
+     */
+    void usernamePatternLimitsStates(void);
+
+    /**
+     * /brief  Test that the names of a built banlist file are found by Contains
+     */
+    void banListRoundTrip(void);
+
+    /**
+     * /brief  Test a user list split over several messages and reads
+     */
+    void namesListSplitAcrossReads(void);
+
+    /**
+     * /brief  Test that a failed login reports the disconnected state once
+     */
+    void loginFailureDisconnectsOnce(void);
+
+private:
+    /**
+     * /brief   Internally used method to create a set of channels
+     * /param   names  Names of the channels
+     * /return  Returns the set of channels
+     */
+    static QSet<QString> createChannels(const QStringList& names);
+
+    /**
+     * /brief  Internally used method to log the connector in and to confirm the join of all channels
+     * /param  connector  Connector without a connection
+     * /param  channels   Names of the channels to be joined
+     */
+    static void connectConnector(TwitchConnector& connector, const QStringList& channels);
+
+    /**
+     * /brief   Internally used method to add a further account which is logged in and reports its moderator status
+     * /param   connector  Connector which shall own the account (before it is connected, so the account isn't connected for real)
+     * /param   moderated  Names of the channels where the account is a moderator
+     * /param   unmoderated  Names of the channels where the account isn't a moderator
+     * /return  Returns the account
+     */
+    static AccountConnection* addAccount(TwitchConnector& connector, const QStringList& moderated, const QStringList& unmoderated);
+
+    /**
+     * /brief   Internally used method to read from a socket of the test server until a text has been received
+     * /param   socket  Socket of the test server
+     * /param   text    Text to wait for
+     * /return  Returns the data read, it doesn't contain the text after TEST_TIMEOUT
+     */
+    static QByteArray readUntil(QTcpSocket* socket, const QByteArray& text);
+};
+
+/**
+ * /brief createChannels definition
+ */
+QSet<QString> ConnectorTest::createChannels(const QStringList& names)
+{
+    QSet<QString> channels;
+    foreach (const QString& name, names)
+    {
+        channels.insert(name);
+    }
+
+    return channels;
+}
+
+/**
+ * /brief connectConnector definition
+ */
+void ConnectorTest::connectConnector(TwitchConnector& connector, const QStringList& channels)
+{
+    connector.SetChannels(createChannels(channels));
+    connector.ProcessData(":tmi.twitch.tv 001 bot :Welcome, GLHF!\r\n");
+
+    foreach (const QString& channel, channels)
+    {
+        connector.ProcessData(":bot.tmi.twitch.tv 366 bot #" + channel.toUtf8() + " :End of /NAMES list\r\n");
+    }
+}
+
+/**
+ * /brief addAccount definition
+ */
+AccountConnection* ConnectorTest::addAccount(TwitchConnector& connector, const QStringList& moderated, const QStringList& unmoderated)
+{
+    AccountConnection* account = connector.AddAccount("second", "oauth:second");
+    account->ProcessData(":tmi.twitch.tv 001 second :Welcome, GLHF!\r\n");
+
+    foreach (const QString& channel, moderated)
+    {
+        account->ProcessData("@badges=moderator/1;mod=1 :tmi.twitch.tv USERSTATE #" + channel.toUtf8() + "\r\n");
+    }
+    foreach (const QString& channel, unmoderated)
+    {
+        account->ProcessData("@badges=;mod=0 :tmi.twitch.tv USERSTATE #" + channel.toUtf8() + "\r\n");
+    }
+
+    return account;
+}
+
+/**
+ * /brief readUntil definition
+ */
+QByteArray ConnectorTest::readUntil(QTcpSocket* socket, const QByteArray& text)
+{
+    QByteArray data;
+    QElapsedTimer timer;
+    timer.start();
+
+    /* Keep the event loop running, the connector lives in the same thread */
+    while ( !data.contains(text) && timer.elapsed() < TEST_TIMEOUT )
+    {
+        QTest::qWait(10);
+        data.append(socket->readAll());
+    }
+
+    return data;
+}
+
+/**
+ * /brief commandQueueDeduplicates definition
+ */
+void ConnectorTest::commandQueueDeduplicates()
+{
+    CommandQueue queue;
+    queue.Add(createChannels(QStringList() << "a" << "b"), ".ban", "spammer");
+    queue.Add(createChannels(QStringList() << "a"), ".ban", "spammer");
+    QCOMPARE(queue.Metrics().pending, 2);
+
+    QList<QueuedCommand> failed;
+    QByteArray commands = queue.Take(0, createChannels(QStringList() << "a" << "b"), &failed);
+    QCOMPARE(commands.count("PRIVMSG #a :.ban spammer\r\n"), 1);
+    QCOMPARE(commands.count("PRIVMSG #b :.ban spammer\r\n"), 1);
+    QCOMPARE(queue.Metrics().pending, 0);
+    QCOMPARE(queue.Metrics().inFlight, 2);
+}
+
+/**
+ * /brief commandQueueAnswersOldest definition
+ */
+void ConnectorTest::commandQueueAnswersOldest()
+{
+    CommandQueue queue;
+    queue.Add(createChannels(QStringList() << "a"), ".ban", "first");
+    queue.Add(createChannels(QStringList() << "a"), ".ban", "second");
+    queue.Add(createChannels(QStringList() << "b"), ".ban", "third");
+
+    QList<QueuedCommand> failed;
+    queue.Take(0, createChannels(QStringList() << "a" << "b"), &failed);
+    QCOMPARE(queue.Metrics().inFlight, 3);
+
+    QueuedCommand answered;
+    QCOMPARE(queue.Answer(QLatin1String("a"), QLatin1String("ban_success"), 100, &answered), COMMAND_ACKNOWLEDGED);
+    QCOMPARE(answered.userName, QString("first"));
+    QCOMPARE(queue.Answer(QLatin1String("a"), QLatin1String("bad_ban_mod"), 100, &answered), COMMAND_REJECTED);
+    QCOMPARE(answered.userName, QString("second"));
+
+    /* Notices without a command are unrelated, even in a channel with an unanswered command */
+    QCOMPARE(queue.Answer(QLatin1String("b"), QLatin1String("host_on"), 100, &answered), COMMAND_UNRELATED);
+    QCOMPARE(queue.Answer(QLatin1String("a"), QLatin1String("ban_success"), 100, &answered), COMMAND_UNRELATED);
+    QCOMPARE(queue.Metrics().inFlight, 1);
+    QCOMPARE(queue.Metrics().acknowledged, (qint64)1);
+    QCOMPARE(queue.Metrics().failed, (qint64)1);
+}
+
+/**
+ * /brief commandQueueLearnsRate definition
+ */
+void ConnectorTest::commandQueueLearnsRate()
+{
+    CommandQueue queue;
+    QSet<QString> channels = createChannels(QStringList() << "a");
+    QList<QueuedCommand> failed;
+    QCOMPARE(queue.Metrics().rate, COMMAND_INITIAL_RATE);
+
+    /* Every acknowledged command increases the rate a little */
+    queue.Add(channels, ".ban", "first");
+    queue.Take(0, channels, &failed);
+    queue.Answer(QLatin1String("a"), QLatin1String("ban_success"), 0, nullptr);
+    double increased = queue.Metrics().rate;
+    QVERIFY(increased > COMMAND_INITIAL_RATE);
+
+    /* A rate limit notice halves the rate and empties the bucket */
+    queue.Add(channels, ".ban", "second");
+    queue.Take(0, channels, &failed);
+    QCOMPARE(queue.Answer(QLatin1String("a"), QLatin1String("msg_ratelimit"), 0, nullptr), COMMAND_RATE_LIMITED);
+    QCOMPARE(queue.Metrics().rate, increased / 2.0);
+    QCOMPARE(queue.Metrics().pending, 1);
+
+    /* The rate never drops below the minimum */
+    for (int i=0; i<20; i++)
+    {
+        queue.Take(1000000 * (i + 1), channels, &failed);
+        queue.Answer(QLatin1String("a"), QLatin1String("msg_ratelimit"), 1000000 * (i + 1), nullptr);
+    }
+    QCOMPARE(queue.Metrics().rate, COMMAND_MIN_RATE);
+}
+
+/**
+ * /brief commandQueueBacksOff definition
+ */
+void ConnectorTest::commandQueueBacksOff()
+{
+    CommandQueue queue;
+    QSet<QString> channels = createChannels(QStringList() << "a");
+    QList<QueuedCommand> failed;
+
+    queue.Add(channels, ".ban", "spammer");
+    queue.Take(0, channels, &failed);
+
+    /* The channel waits COMMAND_INITIAL_BACKOFF after the first rate limit notice */
+    queue.Answer(QLatin1String("a"), QLatin1String("msg_ratelimit"), 1000, nullptr);
+    QVERIFY(queue.Take(1000 + COMMAND_INITIAL_BACKOFF - 1, channels, &failed).isEmpty());
+    QCOMPARE(queue.Take(1000 + COMMAND_INITIAL_BACKOFF, channels, &failed), QByteArray("PRIVMSG #a :.ban spammer\r\n"));
+
+    /* The backoff doubles with every further notice */
+    qint64 now = 1000 + COMMAND_INITIAL_BACKOFF;
+    queue.Answer(QLatin1String("a"), QLatin1String("msg_ratelimit"), now, nullptr);
+    QVERIFY(queue.Take(now + 2 * COMMAND_INITIAL_BACKOFF - 1, channels, &failed).isEmpty());
+    QCOMPARE(queue.Take(now + 2 * COMMAND_INITIAL_BACKOFF, channels, &failed), QByteArray("PRIVMSG #a :.ban spammer\r\n"));
+
+    /* An acknowledged command ends the backoff of its channel */
+    now += 2 * COMMAND_INITIAL_BACKOFF;
+    queue.Answer(QLatin1String("a"), QLatin1String("ban_success"), now, nullptr);
+    queue.Add(channels, ".ban", "other");
+    QCOMPARE(queue.Take(now + 10000, channels, &failed), QByteArray("PRIVMSG #a :.ban other\r\n"));
+    QCOMPARE(queue.Metrics().rateLimited, (qint64)2);
+    QVERIFY(failed.isEmpty());
+}
+
+/**
+ * /brief commandQueueRetries definition
+ */
+void ConnectorTest::commandQueueRetries()
+{
+    CommandQueue queue;
+    QSet<QString> channels = createChannels(QStringList() << "a");
+    QList<QueuedCommand> failed;
+
+    queue.Add(channels, ".ban", "spammer");
+    QVERIFY( !queue.Take(0, channels, &failed).isEmpty() );
+
+    /* Without an answer the command is sent again after COMMAND_ACK_TIMEOUT */
+    QVERIFY(queue.Take(COMMAND_ACK_TIMEOUT - 1, channels, &failed).isEmpty());
+    for (int attempt=1; attempt<COMMAND_MAX_ATTEMPTS; attempt++)
+    {
+        QCOMPARE(queue.Take(attempt * COMMAND_ACK_TIMEOUT, channels, &failed), QByteArray("PRIVMSG #a :.ban spammer\r\n"));
+    }
+    QVERIFY(failed.isEmpty());
+
+    /* The last attempt is given up */
+    QVERIFY(queue.Take(COMMAND_MAX_ATTEMPTS * COMMAND_ACK_TIMEOUT, channels, &failed).isEmpty());
+    QCOMPARE(failed.count(), 1);
+    QCOMPARE(failed.first().userName, QString("spammer"));
+    QCOMPARE(queue.Metrics().retried, (qint64)(COMMAND_MAX_ATTEMPTS - 1));
+    QCOMPARE(queue.Metrics().failed, (qint64)1);
+    QVERIFY(queue.IsEmpty());
+}
+
+/**
+ * /brief commandQueueRequeues definition
+ */
+void ConnectorTest::commandQueueRequeues()
+{
+    CommandQueue queue;
+    QSet<QString> channels = createChannels(QStringList() << "a");
+    QList<QueuedCommand> failed;
+
+    queue.Add(channels, ".ban", "first");
+    queue.Add(channels, ".ban", "second");
+    queue.Take(0, channels, &failed);
+    queue.Add(channels, ".ban", "third");
+    QCOMPARE(queue.Metrics().inFlight, 2);
+
+    /* The answers of the lost connection never arrive, the commands are sent again in their order */
+    queue.Requeue();
+    QCOMPARE(queue.Metrics().inFlight, 0);
+    QCOMPARE(queue.Metrics().pending, 3);
+
+    QByteArray commands = queue.Take(0, channels, &failed);
+    QVERIFY(commands.indexOf("first") < commands.indexOf("second"));
+    QVERIFY(commands.indexOf("second") < commands.indexOf("third"));
+
+    /* So the answers still belong to the oldest command */
+    QueuedCommand answered;
+    queue.Answer(QLatin1String("a"), QLatin1String("ban_success"), 0, &answered);
+    QCOMPARE(answered.userName, QString("first"));
+}
+
+/**
+ * /brief commandQueueTakesAll definition
+ */
+void ConnectorTest::commandQueueTakesAll()
+{
+    CommandQueue queue;
+    QList<QueuedCommand> failed;
+
+    /* One unanswered command and one waiting for the join of its channel */
+    queue.Add(createChannels(QStringList() << "a"), ".ban", "sent");
+    queue.Take(0, createChannels(QStringList() << "a"), &failed);
+    queue.Add(createChannels(QStringList() << "b"), ".ban", "waiting");
+    QVERIFY(queue.Take(0, createChannels(QStringList() << "a"), &failed).isEmpty());
+
+    QList<QueuedCommand> taken = queue.TakeAll();
+    QCOMPARE(taken.count(), 2);
+    QCOMPARE(taken.at(0).userName, QString("sent"));
+    QCOMPARE(taken.at(1).userName, QString("waiting"));
+    QVERIFY(queue.IsEmpty());
+
+    /* An answer to a taken command is unrelated now */
+    QCOMPARE(queue.Answer(QLatin1String("a"), QLatin1String("ban_success"), 0, nullptr), COMMAND_UNRELATED);
+}
+
+/**
+ * /brief banStateTracksChannels definition
+ */
+void ConnectorTest::banStateTracksChannels()
+{
+    BanState state;
+    state.Add("Spammer", "a");
+    state.Add("spammer", createChannels(QStringList() << "a" << "b"));
+    QCOMPARE(state.Count(), 2);
+    QVERIFY(state.IsBanned("SPAMMER", "b"));
+    QVERIFY( !state.IsBanned("spammer", "c") );
+    QCOMPARE(state.Channels("spammer"), createChannels(QStringList() << "a" << "b"));
+
+    state.Remove("spammer", "a");
+    state.Remove("spammer", "c");
+    QCOMPARE(state.Count(), 1);
+    QCOMPARE(state.Channels("Spammer"), createChannels(QStringList() << "b"));
+
+    state.Remove("spammer", "b");
+    QCOMPARE(state.Count(), 0);
+    QVERIFY(state.Channels("spammer").isEmpty());
+}
+
+/**
+ * /brief banSkipsKnownBans definition
+ */
+void ConnectorTest::banSkipsKnownBans()
+{
+    TwitchConnector connector("localhost", 6667, "bot", "oauth:bot");
+    connectConnector(connector, QStringList() << "a" << "b" << "c");
+
+    /* A ban loaded from the history is skipped */
+    connector.AddKnownBans("spammer", createChannels(QStringList() << "a"));
+    int skipped = -1;
+    QCOMPARE(connector.banUser("spammer", &skipped), createChannels(QStringList() << "b" << "c"));
+    QCOMPARE(skipped, 1);
+
+    /* So is an acknowledged ban, but not a ban which is still waiting for its answer */
+    QSignalSpy acknowledgedSpy(&connector, SIGNAL(commandAcknowledged(QString,QString,QString)));
+    connector.ProcessData("@msg-id=ban_success :tmi.twitch.tv NOTICE #b :spammer is now banned from this channel.\r\n");
+    QCOMPARE(acknowledgedSpy.count(), 1);
+    QCOMPARE(acknowledgedSpy.at(0).at(2).toString(), QString("b"));
+
+    QCOMPARE(connector.banUser("spammer", &skipped), createChannels(QStringList() << "c"));
+    QCOMPARE(skipped, 2);
+
+    /* The ban of another moderator counts as well, a timeout doesn't */
+    connector.ProcessData("@ban-duration=600 :tmi.twitch.tv CLEARCHAT #a :timedout\r\n");
+    connector.ProcessData(":tmi.twitch.tv CLEARCHAT #c :banned\r\n");
+    QCOMPARE(connector.banUser("timedout", &skipped).count(), 3);
+    QCOMPARE(skipped, 0);
+    QCOMPARE(connector.banUser("banned", &skipped), createChannels(QStringList() << "a" << "b"));
+    QCOMPARE(skipped, 1);
+}
+
+/**
+ * /brief unbanKeepsBanOnFailure definition
+ */
+void ConnectorTest::unbanKeepsBanOnFailure()
+{
+    TwitchConnector connector("localhost", 6667, "bot", "oauth:bot");
+    connectConnector(connector, QStringList() << "a" << "b" << "c");
+
+    /* Only the channels with a known ban are unbanned */
+    connector.AddKnownBans("spammer", createChannels(QStringList() << "a" << "b"));
+    int skipped = -1;
+    QCOMPARE(connector.unbanUser("spammer", &skipped), createChannels(QStringList() << "a" << "b"));
+    QCOMPARE(skipped, 1);
+
+    /* The unban of a fails, the unban of b succeeds */
+    QSignalSpy failedSpy(&connector, SIGNAL(commandFailed(QString,QString,QString,QString)));
+    connector.ProcessData("@msg-id=usage_unban :tmi.twitch.tv NOTICE #a :Usage: \"/unban <username>\"\r\n");
+    connector.ProcessData("@msg-id=unban_success :tmi.twitch.tv NOTICE #b :spammer is no longer banned from this chat room.\r\n");
+    QCOMPARE(failedSpy.count(), 1);
+    QCOMPARE(failedSpy.at(0).at(0).toString(), QString(".unban"));
+    QCOMPARE(failedSpy.at(0).at(2).toString(), QString("a"));
+
+    /* So the user is still banned in a */
+    QCOMPARE(connector.banUser("spammer", &skipped), createChannels(QStringList() << "b" << "c"));
+    QCOMPARE(skipped, 1);
+}
+
+/**
+ * /brief banPrunesUnmoderatedChannels definition
+ */
+void ConnectorTest::banPrunesUnmoderatedChannels()
+{
+    TwitchConnector connector("localhost", 6667, "bot", "oauth:bot");
+    connectConnector(connector, QStringList() << "a" << "b" << "c" << "d");
+
+    /* Moderator, no moderator, broadcaster and no status reported yet */
+    QSignalSpy moderatorSpy(&connector, SIGNAL(moderatorChanged(QString,bool)));
+    connector.ProcessData("@badges=moderator/1;mod=1 :tmi.twitch.tv USERSTATE #a\r\n"
+                          "@badges=;mod=0 :tmi.twitch.tv USERSTATE #b\r\n"
+                          "@badges=broadcaster/1;mod=0 :tmi.twitch.tv USERSTATE #c\r\n");
+    QCOMPARE(moderatorSpy.count(), 3);
+    QCOMPARE(connector.GetUnmoderatedChannels(), createChannels(QStringList() << "b"));
+    QCOMPARE(connector.banUser("spammer"), createChannels(QStringList() << "a" << "c" << "d"));
+
+    /* USERSTATE is repeated after every message, only a change is notified */
+    connector.ProcessData("@badges=;mod=0 :tmi.twitch.tv USERSTATE #b\r\n");
+    QCOMPARE(moderatorSpy.count(), 3);
+
+    /* A promotion makes the channel bannable again */
+    connector.ProcessData("@badges=moderator/1;mod=1 :tmi.twitch.tv USERSTATE #b\r\n");
+    QCOMPARE(moderatorSpy.count(), 4);
+    QVERIFY(connector.GetUnmoderatedChannels().isEmpty());
+    QCOMPARE(connector.banUser("other").count(), 4);
+}
+
+/**
+ * /brief noPermissionPrunesChannel definition
+ */
+void ConnectorTest::noPermissionPrunesChannel()
+{
+    TwitchConnector connector("localhost", 6667, "bot", "oauth:bot");
+    connectConnector(connector, QStringList() << "a" << "b");
+
+    connector.banUser("first");
+    connector.banUser("second");
+    QCOMPARE(connector.GetCommandQueueMetrics().inFlight, 4);
+
+    /* The answer fails the first command of a, the second one isn't worth sending anymore */
+    QSignalSpy failedSpy(&connector, SIGNAL(commandFailed(QString,QString,QString,QString)));
+    connector.ProcessData("@msg-id=no_permission :tmi.twitch.tv NOTICE #a :You don't have permission to perform that action.\r\n");
+    QCOMPARE(failedSpy.count(), 2);
+    QCOMPARE(failedSpy.at(0).at(2).toString(), QString("a"));
+    QCOMPARE(failedSpy.at(1).at(2).toString(), QString("a"));
+    QCOMPARE(connector.GetCommandQueueMetrics().inFlight, 2);
+
+    QCOMPARE(connector.GetUnmoderatedChannels(), createChannels(QStringList() << "a"));
+    QCOMPARE(connector.banUser("third"), createChannels(QStringList() << "b"));
+}
+
+/**
+ * /brief accountLearnsModeratorStatus definition
+ */
+void ConnectorTest::accountLearnsModeratorStatus()
+{
+    AccountConnection account("localhost", 6667, "second", "oauth:second");
+    account.SetChannels(createChannels(QStringList() << "a" << "b" << "c"));
+    account.ProcessData(":tmi.twitch.tv 001 second :Welcome, GLHF!\r\n");
+    QCOMPARE(account.GetState(), CONNECTED);
+
+    /* Until the probe is answered the account may moderate everywhere */
+    QVERIFY(account.MayModerate("a"));
+    QVERIFY( !account.IsModeratorKnown("a") );
+
+    account.ProcessData("@badges=moderator/1;mod=1 :tmi.twitch.tv USERSTATE #a\r\n"
+                        "@badges=;mod=0 :tmi.twitch.tv USERSTATE #b\r\n"
+                        "@badges=;mod=1 :tmi.twitch.tv USERSTATE #other\r\n");
+    QVERIFY(account.MayModerate("a"));
+    QVERIFY(account.IsModeratorKnown("a"));
+    QVERIFY( !account.MayModerate("b") );
+    QVERIFY(account.IsModeratorKnown("b"));
+    QVERIFY( !account.IsModeratorKnown("c") );
+    QVERIFY( !account.IsModeratorKnown("other") );
+    QCOMPARE(account.GetUnmoderatedCount(), 1);
+
+    /* A removed channel is forgotten, the status is learned again by the next connection */
+    account.SetChannels(createChannels(QStringList() << "a" << "c"));
+    QCOMPARE(account.GetUnmoderatedCount(), 0);
+    account.ProcessData(":tmi.twitch.tv NOTICE * :Login authentication failed\r\n");
+    QCOMPARE(account.GetState(), DISCONNECTED);
+    QVERIFY(account.IsLoginRejected());
+    QVERIFY( !account.IsModeratorKnown("a") );
+}
+
+/**
+ * /brief banRoutesAcrossAccounts definition
+ */
+void ConnectorTest::banRoutesAcrossAccounts()
+{
+    TwitchConnector connector("localhost", 6667, "bot", "oauth:bot");
+    connector.SetChannels(createChannels(QStringList() << "a" << "b" << "c" << "d"));
+    AccountConnection* account = addAccount(connector, QStringList() << "b" << "c" << "d", QStringList() << "a");
+    connectConnector(connector, QStringList() << "a" << "b" << "c" << "d");
+
+    /* This connection moderates a, not b, its status in c and d is unknown */
+    connector.ProcessData("@badges=moderator/1;mod=1 :tmi.twitch.tv USERSTATE #a\r\n"
+                          "@badges=;mod=0 :tmi.twitch.tv USERSTATE #b\r\n");
+
+    /* c and d go to the confirmed moderator, although this connection has the smaller backlog */
+    QCOMPARE(connector.banUser("spammer").count(), 4);
+    QCOMPARE(connector.GetCommandQueueMetrics().inFlight, 1);
+    QCOMPARE(account->GetCommandQueueMetrics().inFlight, 3);
+
+    /* The acknowledged bans of the account are skipped by the next fan-out */
+    QSignalSpy acknowledgedSpy(&connector, SIGNAL(commandAcknowledged(QString,QString,QString)));
+    account->ProcessData("@msg-id=ban_success :tmi.twitch.tv NOTICE #b :spammer is now banned from this channel.\r\n");
+    QCOMPARE(acknowledgedSpy.count(), 1);
+    int skipped = -1;
+    QCOMPARE(connector.banUser("spammer", &skipped), createChannels(QStringList() << "a" << "c" << "d"));
+    QCOMPARE(skipped, 1);
+
+    /* The metrics list this connection first */
+    QList<AccountMetrics> metrics = connector.GetAccountMetrics();
+    QCOMPARE(metrics.count(), 2);
+    QCOMPARE(metrics.at(0).loginName, QString("bot"));
+    QCOMPARE(metrics.at(1).loginName, QString("second"));
+    QCOMPARE(metrics.at(1).unmoderated, 1);
+}
+
+/**
+ * /brief accountReroutesCommands definition
+ */
+void ConnectorTest::accountReroutesCommands()
+{
+    TwitchConnector connector("localhost", 6667, "bot", "oauth:bot");
+    connector.SetChannels(createChannels(QStringList() << "a" << "b" << "c"));
+    AccountConnection* account = addAccount(connector, QStringList() << "a" << "b" << "c", QStringList());
+    connectConnector(connector, QStringList() << "a" << "b" << "c");
+
+    /* This connection isn't a moderator of a, its status in b and c is unknown */
+    connector.ProcessData("@badges=;mod=0 :tmi.twitch.tv USERSTATE #a\r\n");
+    connector.banUser("spammer");
+    QCOMPARE(account->GetCommandQueueMetrics().inFlight, 3);
+
+    /* The account lost its permission in b, this connection may try */
+    QSignalSpy failedSpy(&connector, SIGNAL(commandFailed(QString,QString,QString,QString)));
+    account->ProcessData("@msg-id=no_permission :tmi.twitch.tv NOTICE #b :You don't have permission to perform that action.\r\n");
+    QCOMPARE(failedSpy.count(), 0);
+    QCOMPARE(connector.GetCommandQueueMetrics().inFlight, 1);
+    QCOMPARE(account->GetCommandQueueMetrics().inFlight, 2);
+
+    /* The account loses its connection: c is passed on, no other account may moderate a */
+    account->ProcessData(":tmi.twitch.tv NOTICE * :Login authentication failed\r\n");
+    QCOMPARE(account->GetCommandQueueMetrics().inFlight, 0);
+    QCOMPARE(account->GetCommandQueueMetrics().pending, 0);
+    QCOMPARE(connector.GetCommandQueueMetrics().inFlight, 2);
+    QCOMPARE(failedSpy.count(), 1);
+    QCOMPARE(failedSpy.at(0).at(2).toString(), QString("a"));
+    QCOMPARE(failedSpy.at(0).at(3).toString(), QString("account disconnected"));
+
+    /* A disconnected account isn't routed to */
+    QCOMPARE(connector.banUser("other"), createChannels(QStringList() << "b" << "c"));
+}
+
+/**
+ * /brief standbyTakesOver definition
+ */
+void ConnectorTest::standbyTakesOver()
+{
+    QTcpServer server;
+    QVERIFY(server.listen(QHostAddress::LocalHost));
+
+    TwitchConnector connector("127.0.0.1", server.serverPort(), "bot", "oauth:bot");
+    connector.SetChannels(createChannels(QStringList() << "a" << "b"));
+    connector.SetStandby(true);
+    connector.Connect();
+
+    /* The connection requests the membership messages, the standby connection doesn't */
+    QTRY_VERIFY_WITH_TIMEOUT(server.hasPendingConnections(), TEST_TIMEOUT);
+    QTcpSocket* first = server.nextPendingConnection();
+    QTRY_VERIFY_WITH_TIMEOUT(server.hasPendingConnections(), TEST_TIMEOUT);
+    QTcpSocket* second = server.nextPendingConnection();
+    QByteArray firstLogin = readUntil(first, "twitch.tv/commands\r\n");
+    QByteArray secondLogin = readUntil(second, "twitch.tv/commands\r\n");
+    QVERIFY(firstLogin.contains("membership") != secondLogin.contains("membership"));
+    QTcpSocket* connection = firstLogin.contains("membership") ? first : second;
+    QTcpSocket* standby = firstLogin.contains("membership") ? second : first;
+
+    /* Moderator of a, not of b */
+    connection->write(":tmi.twitch.tv 001 bot :Welcome, GLHF!\r\n"
+                      ":bot.tmi.twitch.tv 366 bot #a :End of /NAMES list\r\n"
+                      ":bot.tmi.twitch.tv 366 bot #b :End of /NAMES list\r\n"
+                      "@badges=moderator/1;mod=1 :tmi.twitch.tv USERSTATE #a\r\n"
+                      "@badges=;mod=0 :tmi.twitch.tv USERSTATE #b\r\n");
+    standby->write(":tmi.twitch.tv 001 bot :Welcome, GLHF!\r\n");
+    QTRY_COMPARE_WITH_TIMEOUT(connector.GetUnmoderatedChannels(), createChannels(QStringList() << "b"), TEST_TIMEOUT);
+    QTRY_COMPARE_WITH_TIMEOUT(connector.GetStandbyState(), CONNECTED, TEST_TIMEOUT);
+
+    QCOMPARE(connector.banUser("spammer"), createChannels(QStringList() << "a"));
+    QVERIFY(readUntil(connection, "PRIVMSG #a :.ban spammer\r\n").contains("PRIVMSG #a :.ban spammer\r\n"));
+
+    /* Lose the connection without a disconnect request */
+    QSignalSpy stateSpy(&connector, SIGNAL(stateChanged(ConnectionState)));
+    QSignalSpy failedOverSpy(&connector, SIGNAL(failedOver(int)));
+    connection->disconnectFromHost();
+    QTRY_COMPARE_WITH_TIMEOUT(failedOverSpy.count(), 1, TEST_TIMEOUT);
+    QCOMPARE(failedOverSpy.at(0).at(0).toInt(), 2);
+
+    /* Still connected as the same account, so neither the state nor the moderator status changed */
+    QCOMPARE(stateSpy.count(), 0);
+    QCOMPARE(connector.GetConnectionState(), CONNECTED);
+    QCOMPARE(connector.banUser("other"), createChannels(QStringList() << "a"));
+
+    /* The membership request, the joins, the unanswered ban and the new ban continue on the socket of the standby connection */
+    QByteArray data = readUntil(standby, "PRIVMSG #a :.ban other\r\n");
+    QVERIFY(data.contains("CAP REQ :twitch.tv/membership twitch.tv/tags twitch.tv/commands\r\n"));
+    QVERIFY(data.indexOf("twitch.tv/membership") < data.indexOf("JOIN #"));
+    QVERIFY(data.contains("JOIN #a\r\n"));
+    QVERIFY(data.contains("JOIN #b\r\n"));
+    QVERIFY(data.contains("PRIVMSG #a :.ban spammer\r\n"));
+    QVERIFY(data.contains("PRIVMSG #a :.ban other\r\n"));
+
+    /* The answers on the taken over socket reach the connector */
+    QSignalSpy acknowledgedSpy(&connector, SIGNAL(commandAcknowledged(QString,QString,QString)));
+    standby->write("@msg-id=ban_success :tmi.twitch.tv NOTICE #a :spammer is now banned from this channel.\r\n");
+    QTRY_COMPARE_WITH_TIMEOUT(acknowledgedSpy.count(), 1, TEST_TIMEOUT);
+    QCOMPARE(acknowledgedSpy.at(0).at(1).toString(), QString("spammer"));
+
+    /* A new standby connection is built in the background */
+    QTRY_VERIFY_WITH_TIMEOUT(server.hasPendingConnections(), TEST_TIMEOUT);
+
+    /* A requested disconnect isn't taken over */
+    connector.Disconnect();
+    QTRY_COMPARE_WITH_TIMEOUT(connector.GetConnectionState(), DISCONNECTED, TEST_TIMEOUT);
+    QCOMPARE(failedOverSpy.count(), 1);
+}
+
+/**
+ * /brief keywordMatchesWholeWords definition
+ */
+void ConnectorTest::keywordMatchesWholeWords()
+{
+    KeywordMatcher matcher;
+    QVERIFY(matcher.IsEmpty());
+    QCOMPARE(matcher.Match("anything", 8), -1);
+
+    matcher.Compile(QStringList() << " Ass " << "free coins" << "" << "ASS");
+    QVERIFY( !matcher.IsEmpty() );
+    QCOMPARE(matcher.Term(0), QString("ass"));
+    QCOMPARE(matcher.Term(1), QString("free coins"));
+    QCOMPARE(matcher.Term(2), QString());
+
+    /* Inside of a word nothing matches, at the edges of the text and next to punctuation it does */
+    QByteArray text = "first class";
+    QCOMPARE(matcher.Match(text.constData(), text.size()), -1);
+    text = "assumption";
+    QCOMPARE(matcher.Match(text.constData(), text.size()), -1);
+    text = "ass";
+    QCOMPARE(matcher.Match(text.constData(), text.size()), 0);
+    text = "you ass!";
+    QCOMPARE(matcher.Match(text.constData(), text.size()), 0);
+    text = "get_ass";
+    QCOMPARE(matcher.Match(text.constData(), text.size()), -1);
+
+    /* Upper case input matches, a non-ASCII byte counts as a word character */
+    text = "Get FREE COINS now";
+    QCOMPARE(matcher.Match(text.constData(), text.size()), 1);
+    text = "freecoins";
+    QCOMPARE(matcher.Match(text.constData(), text.size()), -1);
+    text = "\xc3\xa4ass ass\xc3\xa4";
+    QCOMPARE(matcher.Match(text.constData(), text.size()), -1);
+}
+
+/**
+ * /brief keywordOpensEdges definition
+ */
+void ConnectorTest::keywordOpensEdges()
+{
+    KeywordMatcher matcher;
+    matcher.Compile(QStringList() << "*coin" << "scam*" << "*bot*" << "bit.ly/");
+
+    QByteArray text = "buy BITCOIN";
+    QCOMPARE(matcher.Match(text.constData(), text.size()), 0);
+    text = "coins";
+    QCOMPARE(matcher.Match(text.constData(), text.size()), -1);
+    text = "scammers here";
+    QCOMPARE(matcher.Match(text.constData(), text.size()), 1);
+    text = "noscam";
+    QCOMPARE(matcher.Match(text.constData(), text.size()), -1);
+    text = "robots";
+    QCOMPARE(matcher.Match(text.constData(), text.size()), 2);
+
+    /* The '/' edge needs no boundary, the 'b' edge does */
+    text = "see bit.ly/abc";
+    QCOMPARE(matcher.Match(text.constData(), text.size()), 3);
+    text = "orbit.ly/abc";
+    QCOMPARE(matcher.Match(text.constData(), text.size()), -1);
+
+    /* A term which is only a '*' is ignored */
+    matcher.Compile(QStringList() << "*" << "**");
+    QVERIFY(matcher.IsEmpty());
+}
+
+/**
+ * /brief keywordMatchesOverlappingTerms definition
+ */
+void ConnectorTest::keywordMatchesOverlappingTerms()
+{
+    KeywordMatcher matcher;
+    matcher.Compile(QStringList() << "he" << "she" << "hers");
+
+    /* Every term ending inside of the word is rejected, the next word matches */
+    QByteArray text = "ushers";
+    QCOMPARE(matcher.Match(text.constData(), text.size()), -1);
+    text = "ushers hers";
+    QCOMPARE(matcher.Match(text.constData(), text.size()), 2);
+    text = "ushe he";
+    QCOMPARE(matcher.Match(text.constData(), text.size()), 0);
+
+    /* The same bytes with different edges, the open term matches inside of a word */
+    matcher.Compile(QStringList() << "coin" << "*coin");
+    text = "bitcoin";
+    QCOMPARE(matcher.Match(text.constData(), text.size()), 1);
+    text = "coin";
+    QVERIFY(matcher.Match(text.constData(), text.size()) >= 0);
+
+    /* A term which ends inside of the path of a longer term is found through the output link */
+    matcher.Compile(QStringList() << "buy followers now" << "*followers");
+    text = "buy followers today";
+    QCOMPARE(matcher.Match(text.constData(), text.size()), 1);
+    text = "buy followers now";
+    QVERIFY(matcher.Match(text.constData(), text.size()) >= 0);
+}
+
+/**
+ * /brief usernamePatternMatchesConstructs definition
+ */
+void ConnectorTest::usernamePatternMatchesConstructs()
+{
+    UsernameMatcher matcher;
+    QVERIFY(matcher.IsEmpty());
+    QCOMPARE(matcher.Match("anyone", 6), -1);
+
+    QString error;
+    QVERIFY(matcher.Compile(QStringList() << "hoss00312_*" << "coolbot[0-9]+" << "x?z" << "[^a-z]bot" << "[A-C_]end", &error));
+    QVERIFY(error.isEmpty());
+
+    /* '*' matches any number of characters, the pattern has to match the whole name */
+    QByteArray name = "hoss00312_abc";
+    QCOMPARE(matcher.Match(name.constData(), name.size()), 0);
+    name = "HOSS00312_";
+    QCOMPARE(matcher.Match(name.constData(), name.size()), 0);
+    name = "hoss00312";
+    QCOMPARE(matcher.Match(name.constData(), name.size()), -1);
+    name = "xhoss00312_";
+    QCOMPARE(matcher.Match(name.constData(), name.size()), -1);
+
+    /* '+' repeats the preceding set at least once */
+    name = "coolbot1234";
+    QCOMPARE(matcher.Match(name.constData(), name.size()), 1);
+    name = "coolbot";
+    QCOMPARE(matcher.Match(name.constData(), name.size()), -1);
+    name = "coolbot12a";
+    QCOMPARE(matcher.Match(name.constData(), name.size()), -1);
+
+    /* '?' matches exactly one character */
+    name = "xyz";
+    QCOMPARE(matcher.Match(name.constData(), name.size()), 2);
+    name = "xz";
+    QCOMPARE(matcher.Match(name.constData(), name.size()), -1);
+    name = "xyyz";
+    QCOMPARE(matcher.Match(name.constData(), name.size()), -1);
+
+    /* A negated set, upper case letters are folded before the set is checked */
+    name = "1bot";
+    QCOMPARE(matcher.Match(name.constData(), name.size()), 3);
+    name = "abot";
+    QCOMPARE(matcher.Match(name.constData(), name.size()), -1);
+    name = "Abot";
+    QCOMPARE(matcher.Match(name.constData(), name.size()), -1);
+
+    /* A set with a range and a single character, the pattern is folded as well */
+    name = "_end";
+    QCOMPARE(matcher.Match(name.constData(), name.size()), 4);
+    name = "Bend";
+    QCOMPARE(matcher.Match(name.constData(), name.size()), 4);
+    name = "dend";
+    QCOMPARE(matcher.Match(name.constData(), name.size()), -1);
+}
+
+/**
+ * /brief usernamePatternReportsFirstMatch definition
+ */
+void ConnectorTest::usernamePatternReportsFirstMatch()
+{
+    UsernameMatcher matcher;
+    QVERIFY(matcher.Compile(QStringList() << "spam*" << "*bot" << "spam*bot", nullptr));
+    QByteArray name = "spambot";
+    QCOMPARE(matcher.Match(name.constData(), name.size()), 0);
+    name = "coolbot";
+    QCOMPARE(matcher.Match(name.constData(), name.size()), 1);
+    QCOMPARE(matcher.Pattern(1), QString("*bot"));
+
+    /* The order of the list decides */
+    QVERIFY(matcher.Compile(QStringList() << "*bot" << "spam*", nullptr));
+    name = "spambot";
+    QCOMPARE(matcher.Match(name.constData(), name.size()), 0);
+    QCOMPARE(matcher.Pattern(0), QString("*bot"));
+
+    /* Empty and duplicate patterns don't take an index */
+    QVERIFY(matcher.Compile(QStringList() << "  " << "Spam*" << "spam*" << "*bot", nullptr));
+    QCOMPARE(matcher.Pattern(0), QString("spam*"));
+    QCOMPARE(matcher.Pattern(1), QString("*bot"));
+    QCOMPARE(matcher.Pattern(2), QString());
+}
+
+/**
+ * /brief usernamePatternRejectsMalformed definition
+ */
+void ConnectorTest::usernamePatternRejectsMalformed()
+{
+    UsernameMatcher matcher;
+    QVERIFY(matcher.Compile(QStringList() << "keep*", nullptr));
+
+    QStringList malformed;
+    malformed << "[abc" << "ab[" << "+abc" << "a++" << "*+";
+    foreach (const QString& pattern, malformed)
+    {
+        QString error;
+        QVERIFY( !matcher.Compile(QStringList() << "good*" << pattern, &error) );
+        QCOMPARE(error, QString("Malformed pattern: " + pattern));
+
+        /* The previous patterns are kept */
+        QByteArray name = "keepme";
+        QCOMPARE(matcher.Match(name.constData(), name.size()), 0);
+        name = "goodme";
+        QCOMPARE(matcher.Match(name.constData(), name.size()), -1);
+    }
+
+    /* A ']' right after the '[' belongs to the set */
+    QVERIFY(matcher.Compile(QStringList() << "a[]]b", nullptr));
+    QByteArray name = "a]b";
+    QCOMPARE(matcher.Match(name.constData(), name.size()), 0);
+}
+
+/**
+ * /brief usernamePatternLimitsStates definition
+ */
+void ConnectorTest::usernamePatternLimitsStates()
+{
+    /* An 'a' at a fixed distance from the end needs a state for every combination of the last characters */
+    UsernameMatcher matcher;
+    QVERIFY(matcher.Compile(QStringList() << "*a" + QString(10, '?'), nullptr));
+    QVERIFY(matcher.StateCount() > 1000);
+    QVERIFY(matcher.StateCount() <= USERNAME_PATTERN_MAX_STATES);
+    QByteArray name = "xxa0123456789";
+    QCOMPARE(matcher.Match(name.constData(), name.size()), 0);
+
+    QString error;
+    QVERIFY( !matcher.Compile(QStringList() << "*a" + QString(15, '?'), &error) );
+    QCOMPARE(error, QString("Too many states, simplify the patterns"));
+
+    /* The previous patterns are kept */
+    QCOMPARE(matcher.Match(name.constData(), name.size()), 0);
+}
+
+/**
+ * /brief banListRoundTrip definition
+ */
+void ConnectorTest::banListRoundTrip()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    QString fileName = dir.filePath("banlist.bin");
+
+    /* Mixed case, surrounding whitespace, a duplicate, an empty name and a Latin-1 letter */
+    QList<QByteArray> names;
+    names << "SpamBot01" << "  hoss00312_  " << "spambot01" << "" << "J\xc4RGEN";
+    QVERIFY(BanList::Build(names, fileName));
+
+    BanList banList;
+    QVERIFY(banList.Open(fileName));
+    QCOMPARE(banList.Count(), (quint32)3);
+
+    /* Without and with the filter in front */
+    for (int i=0; i<2; i++)
+    {
+        QVERIFY(banList.Contains(QLatin1String("spambot01")));
+        QVERIFY(banList.Contains(QLatin1String("SPAMBOT01")));
+        QVERIFY(banList.Contains(QLatin1String("hoss00312_")));
+
+        /* Only ASCII is folded, on building as well as on the lookup */
+        QVERIFY(banList.Contains(QLatin1String("j\xc4rgen")));
+        QVERIFY(banList.Contains(QLatin1String("J\xc4RGEN")));
+        QVERIFY( !banList.Contains(QLatin1String("j\xe4rgen")) );
+
+        QVERIFY( !banList.Contains(QLatin1String("spambot0")) );
+        QVERIFY( !banList.Contains(QLatin1String("someone")) );
+
+        banList.BuildFilter(0.01, 1024 * 1024);
+    }
+}
+
+/**
+ * /brief namesListSplitAcrossReads definition
+ */
+void ConnectorTest::namesListSplitAcrossReads()
+{
+    TwitchConnector connector("localhost", 6667, "bot", "oauth:bot");
+    connector.SetTargetedBan(true);
+    connector.SetChannels(createChannels(QStringList() << "a" << "b"));
+    connector.ProcessData(":tmi.twitch.tv 001 bot :Welcome, GLHF!\r\n");
+    QSignalSpy joinedSpy(&connector, SIGNAL(channelJoined(QString)));
+
+    /* The list of a large channel is split into several messages, the second one into two reads */
+    connector.ProcessData(":bot.tmi.twitch.tv 353 bot = #a :viewer1 spammer\r\n");
+    connector.ProcessData(":bot.tmi.twitch.tv 353 bot = #a :viewer2 vie");
+    connector.ProcessData("wer3 viewer4\r\n");
+    QCOMPARE(joinedSpy.count(), 0);
+    QVERIFY(connector.GetUserChannels("viewer3").isEmpty());
+
+    /* Only the end of the list connects the channel */
+    connector.ProcessData(":bot.tmi.twitch.tv 366 bot #a :End of /NAMES list\r\n");
+    QCOMPARE(joinedSpy.count(), 1);
+    QCOMPARE(joinedSpy.at(0).at(0).toString(), QString("a"));
+    QCOMPARE(connector.GetUserChannels("viewer3"), createChannels(QStringList() << "a"));
+    QCOMPARE(connector.GetUserChannels("spammer"), createChannels(QStringList() << "a"));
+    QVERIFY(connector.GetUserChannels("vie").isEmpty());
+    QVERIFY(connector.GetUserChannels("wer3").isEmpty());
+
+    connector.ProcessData(":bot.tmi.twitch.tv 353 bot = #b :viewer1\r\n");
+    QCOMPARE(joinedSpy.count(), 1);
+    connector.ProcessData(":bot.tmi.twitch.tv 366 bot #b :End of /NAMES list\r\n");
+    QCOMPARE(joinedSpy.count(), 2);
+
+    /* The complete lists leave out the channels the user isn't present in */
+    QCOMPARE(connector.banUser("spammer"), createChannels(QStringList() << "a"));
+    QCOMPARE(connector.banUser("viewer1"), createChannels(QStringList() << "a" << "b"));
+
+    /* The index of a channel is used only once its list is complete */
+    PresenceIndex index;
+    index.Join(QLatin1String("a"), QLatin1String("viewer1"));
+    index.Join(QLatin1String("a"), QLatin1String("viewer2"));
+    QVERIFY( !index.IsIndexed("a") );
+    index.Complete(QLatin1String("a"));
+    QVERIFY(index.IsIndexed("a"));
+    QVERIFY( !index.IsIndexed("b") );
+}
+
+/**
+ * /brief loginFailureDisconnectsOnce definition
+ */
+void ConnectorTest::loginFailureDisconnectsOnce()
+{
+    QTcpServer server;
+    QVERIFY(server.listen(QHostAddress::LocalHost));
+
+    TwitchConnector connector("127.0.0.1", server.serverPort(), "bot", "oauth:bot");
+    QSignalSpy stateSpy(&connector, SIGNAL(stateChanged(ConnectionState)));
+    QSignalSpy loginSpy(&connector, SIGNAL(loginFailed(QString)));
+    connector.Connect();
+    QCOMPARE(stateSpy.count(), 1);
+
+    QTRY_VERIFY_WITH_TIMEOUT(server.hasPendingConnections(), TEST_TIMEOUT);
+    QTcpSocket* connection = server.nextPendingConnection();
+    QVERIFY(readUntil(connection, "NICK bot\r\n").contains("NICK bot\r\n"));
+
+    /* The rejected login closes the socket, its disconnected signal doesn't change the state again */
+    connection->write(":tmi.twitch.tv NOTICE * :Login authentication failed\r\n");
+    QTRY_COMPARE_WITH_TIMEOUT(loginSpy.count(), 1, TEST_TIMEOUT);
+    QTRY_COMPARE_WITH_TIMEOUT(connection->state(), QAbstractSocket::UnconnectedState, TEST_TIMEOUT);
+    QTest::qWait(50);
+
+    QCOMPARE(connector.GetConnectionState(), DISCONNECTED);
+    QCOMPARE(stateSpy.count(), 2);
+}
+
+QTEST_MAIN(ConnectorTest)
+
+#include "connectortest.moc"
@@ -0,0 +1,23 @@
+#-------------------------------------------------
+#
+# Unit tests of the twitch connector and its models
+#
+# Run "make check" to run all tests
+#
+#-------------------------------------------------
+
+QT       += core network testlib
+
+TARGET = tests
+TEMPLATE = app
+CONFIG += console testcase
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+INCLUDEPATH += ..
+
+include(../twitchcore.pri)
+
+SOURCES += \
+    connectortest.cpp
@@ -0,0 +1,20 @@
+#-------------------------------------------------
+#
+# Builder of the memory mapped banlist from text lists
+#
+#-------------------------------------------------
+
+QT       += core network
+QT       -= gui
+
+TARGET = banlistbuilder
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+include(../../twitchcore.pri)
+
+SOURCES += \
+    main.cpp
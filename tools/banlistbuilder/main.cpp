@@ -0,0 +1,122 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    main.cpp
+ * /author  Hackspider
+ * /brief   Source file of the banlist builder entry
+ */
+
+/* Necessary dependencies to Qt framework */
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QTextStream>
+
+/* Necessary internal dependencies */
+#include "banlist.h"
+
+/**
+ * /brief  Banlist builder main entry
+ */
+int main(int argc, char *argv[])
+{
+    /* Create a new QCoreApplication, no ui is needed */
+    QCoreApplication application(argc, argv);
+
+    /* Define all command line options */
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Builds a memory mapped banlist from text lists (one name per line, # starts a comment)");
+    parser.addHelpOption();
+    parser.addPositionalArgument("lists", "Text lists of names.", "<list> [<list>...]");
+
+    QCommandLineOption outputOption(QStringList() << "o" << "output", "Name of the banlist file.", "file", "banlist.bin");
+    QCommandLineOption verifyOption("verify", "Check every name against the written banlist.");
+    parser.addOption(outputOption);
+    parser.addOption(verifyOption);
+
+    parser.process(application);
+
+    if ( parser.positionalArguments().isEmpty() )
+    {
+        parser.showHelp(1);
+    }
+
+    QTextStream out(stdout);
+    QElapsedTimer clock;
+    clock.start();
+
+    /* Read the names of all lists */
+    QList<QByteArray> names;
+    foreach (const QString& fileName, parser.positionalArguments())
+    {
+        QFile file(fileName);
+        if ( !file.open(QIODevice::ReadOnly) )
+        {
+            out << "Failed to open list " << fileName << endl;
+            return 1;
+        }
+
+        while ( !file.atEnd() )
+        {
+            QByteArray line = file.readLine().trimmed();
+            if ( !line.isEmpty() && !line.startsWith('#') )
+            {
+                names.append(line);
+            }
+        }
+    }
+
+    /* Write the banlist */
+    QString outputName = parser.value(outputOption);
+    if ( !BanList::Build(names, outputName) )
+    {
+        out << "Failed to write banlist " << outputName << endl;
+        return 1;
+    }
+
+    BanList banList;
+    if ( !banList.Open(outputName) )
+    {
+        out << "Failed to map banlist " << outputName << endl;
+        return 1;
+    }
+
+    out << "Wrote " << banList.Count() << " names (" << names.count() << " lines) to " << outputName
+        << " in " << clock.elapsed() << " ms" << endl;
+
+    /* Optionally check that every name is found */
+    if ( parser.isSet(verifyOption) )
+    {
+        int missing = 0;
+        foreach (const QByteArray& name, names)
+        {
+            if ( !banList.Contains(QLatin1String(name.constData(), name.size())) )
+            {
+                missing++;
+            }
+        }
+
+        out << "Verified " << names.count() << " names, " << missing << " missing" << endl;
+        return (missing == 0) ? 0 : 1;
+    }
+
+    return 0;
+}
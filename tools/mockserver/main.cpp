@@ -0,0 +1,86 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    main.cpp
+ * /author  Hackspider
+ * /brief   Source file of the mock twitch irc service entry
+ */
+
+/* Necessary dependencies to Qt framework */
+#include <QCoreApplication>
+#include <QCommandLineParser>
+
+/* Necessary internal dependencies */
+#include "mocktwitchserver.h"
+
+/**
+ * /brief  Mock twitch irc service main entry
+ */
+int main(int argc, char *argv[])
+{
+    /* Create a new QCoreApplication, no ui is needed */
+    QCoreApplication application(argc, argv);
+
+    /* Define all command line options */
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Local mock of the twitch irc service for load and latency testing");
+    parser.addHelpOption();
+
+    QCommandLineOption portOption("port", "Port to listen on.", "port", "6667");
+    QCommandLineOption floodRateOption("flood-rate", "Chat messages per second and client (0 disables the flood).", "rate", "0");
+    QCommandLineOption floodChannelsOption("flood-channels", "Synthetic channels flooded in addition to the joined ones.", "count", "0");
+    QCommandLineOption floodUsersOption("flood-users", "Number of distinct users of the flood.", "count", "1000");
+    QCommandLineOption namesOption("names", "Users listed in the NAMES reply of every join.", "count", "0");
+    QCommandLineOption commandLimitOption("command-limit", "Moderation commands accepted per rate limit window.", "count", "100");
+    QCommandLineOption commandWindowOption("command-window", "Rate limit window in milliseconds.", "ms", "30000");
+    QCommandLineOption unmoderatedOption("unmoderated-every", "Every n-th channel the client isn't a moderator of (0 moderates all).", "n", "0");
+
+    parser.addOption(portOption);
+    parser.addOption(floodRateOption);
+    parser.addOption(floodChannelsOption);
+    parser.addOption(floodUsersOption);
+    parser.addOption(namesOption);
+    parser.addOption(commandLimitOption);
+    parser.addOption(commandWindowOption);
+    parser.addOption(unmoderatedOption);
+
+    parser.process(application);
+
+    /* Fill the configuration based on the command line */
+    MockTwitchConfig config;
+    config.port          = (quint16)parser.value(portOption).toUInt();
+    config.floodRate     = parser.value(floodRateOption).toInt();
+    config.floodChannels = parser.value(floodChannelsOption).toInt();
+    config.floodUsers    = parser.value(floodUsersOption).toInt();
+    config.namesCount    = parser.value(namesOption).toInt();
+    config.commandLimit  = parser.value(commandLimitOption).toInt();
+    config.commandWindow = parser.value(commandWindowOption).toInt();
+    config.unmoderatedEvery = parser.value(unmoderatedOption).toInt();
+
+    /* Create and start the mock service */
+    MockTwitchServer server(config);
+    if ( !server.Listen() )
+    {
+        return 1;
+    }
+
+    /* Start the application */
+    return application.exec();
+}
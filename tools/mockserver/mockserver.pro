@@ -0,0 +1,22 @@
+#-------------------------------------------------
+#
+# Local mock of the twitch irc service for load and latency testing
+#
+#-------------------------------------------------
+
+QT       += core network
+QT       -= gui
+
+TARGET = mockserver
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+SOURCES += \
+    main.cpp \
+    mocktwitchserver.cpp
+
+HEADERS += \
+    mocktwitchserver.h
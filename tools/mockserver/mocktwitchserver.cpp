@@ -0,0 +1,454 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    mocktwitchserver.cpp
+ * /author  Hackspider
+ * /brief   Source file of the mock twitch irc service
+ */
+
+/* Necessary dependencies to Qt framework */
+#include <QDebug>
+
+/* Necessary internal dependencies */
+#include "mocktwitchserver.h"
+
+/* Maximum length of a single NAMES reply line */
+#define NAMES_LINE_LENGTH 400
+
+/* Interval of the flood generation in milliseconds */
+#define FLOOD_INTERVAL 10
+
+/* Time in milliseconds without further commands until a fan-out counts as completed */
+#define FANOUT_IDLE_TIME 1000
+
+/**
+ * /brief MockTwitchServer definition
+ */
+MockTwitchServer::MockTwitchServer(const MockTwitchConfig& config, QObject *parent)
+    : QObject(parent),
+    mConfig(config),
+    mServer(nullptr),
+    mFloodTimer(nullptr),
+    mStatisticsTimer(nullptr),
+    mJoins(0),
+    mParts(0),
+    mCommands(0),
+    mRateLimited(0),
+    mNoPermission(0),
+    mFloodMessages(0)
+{
+    /* Create the tcp server */
+    mServer = new QTcpServer(this);
+    connect(mServer, SIGNAL(newConnection()), this, SLOT(newConnection()));
+
+    /* Create the flood timer */
+    mFloodTimer = new QTimer(this);
+    mFloodTimer->setInterval(FLOOD_INTERVAL);
+    connect(mFloodTimer, SIGNAL(timeout()), this, SLOT(floodTimer()));
+
+    /* Create the statistics timer */
+    mStatisticsTimer = new QTimer(this);
+    mStatisticsTimer->setInterval(1000);
+    connect(mStatisticsTimer, SIGNAL(timeout()), this, SLOT(statisticsTimer()));
+
+    /* Start the monotonic clock used for all timestamps */
+    mClock.start();
+}
+
+/**
+ * /brief ~MockTwitchServer definition
+ */
+MockTwitchServer::~MockTwitchServer()
+{
+    /* All objects are deleted by Qt's object tree */
+}
+
+/**
+ * /brief Listen definition
+ */
+bool MockTwitchServer::Listen()
+{
+    /* Listen on the configured port */
+    if ( !mServer->listen(QHostAddress::Any, mConfig.port) )
+    {
+        qWarning().noquote() << "Failed to listen on port" << mConfig.port << ":" << mServer->errorString();
+        return false;
+    }
+
+    /* Start the timers */
+    if (mConfig.floodRate > 0)
+    {
+        mFloodTimer->start();
+    }
+    mStatisticsTimer->start();
+
+    qInfo().noquote() << "Mock twitch service listening on port" << mServer->serverPort();
+    return true;
+}
+
+/**
+ * /brief newConnection definition
+ */
+void MockTwitchServer::newConnection()
+{
+    /* Accept all pending clients */
+    while (mServer->hasPendingConnections())
+    {
+        QTcpSocket* socket = mServer->nextPendingConnection();
+
+        /* Create a new session for the client */
+        Session session;
+        session.floodCredit = 0.0;
+        session.floodSequence = 0;
+        mSessions.insert(socket, session);
+
+        connect(socket, SIGNAL(readyRead()),    this, SLOT(readyRead()));
+        connect(socket, SIGNAL(disconnected()), this, SLOT(disconnected()));
+    }
+}
+
+/**
+ * /brief readyRead definition
+ */
+void MockTwitchServer::readyRead()
+{
+    QTcpSocket* socket = qobject_cast<QTcpSocket*>(sender());
+    if ( socket == nullptr || !mSessions.contains(socket) )
+    {
+        return;
+    }
+
+    Session& session = mSessions[socket];
+
+    /* Append the received data to the incomplete line of the last read */
+    session.buffer.append(socket->readAll());
+
+    /* Handle all complete lines */
+    int start = 0;
+    int end = session.buffer.indexOf('\n', start);
+    while (end >= 0)
+    {
+        QByteArray line = session.buffer.mid(start, end - start);
+        if ( line.endsWith('\r') )
+        {
+            line.chop(1);
+        }
+
+        handleLine(socket, session, line);
+
+        start = end + 1;
+        end = session.buffer.indexOf('\n', start);
+    }
+
+    /* Keep the incomplete line for the next read */
+    session.buffer.remove(0, start);
+}
+
+/**
+ * /brief disconnected definition
+ */
+void MockTwitchServer::disconnected()
+{
+    QTcpSocket* socket = qobject_cast<QTcpSocket*>(sender());
+    if ( socket == nullptr )
+    {
+        return;
+    }
+
+    /* Forget the session and delete the socket */
+    mSessions.remove(socket);
+    socket->deleteLater();
+}
+
+/**
+ * /brief handleLine definition
+ */
+void MockTwitchServer::handleLine(QTcpSocket* socket, Session& session, const QByteArray& line)
+{
+    if ( line.startsWith("PASS ") )
+    {
+        /* Twitch only accepts tokens with the oauth: prefix */
+        if ( !line.mid(5).startsWith("oauth:") )
+        {
+            socket->write(":tmi.twitch.tv NOTICE * :Improperly formatted auth\r\n");
+            socket->disconnectFromHost();
+        }
+    }
+    else if ( line.startsWith("NICK ") )
+    {
+        session.nick = line.mid(5).trimmed();
+
+        /* Send the welcome sequence */
+        QByteArray welcome;
+        welcome.append(":tmi.twitch.tv 001 " + session.nick + " :Welcome, GLHF!\r\n");
+        welcome.append(":tmi.twitch.tv 002 " + session.nick + " :Your host is tmi.twitch.tv\r\n");
+        welcome.append(":tmi.twitch.tv 003 " + session.nick + " :This server is rather new\r\n");
+        welcome.append(":tmi.twitch.tv 004 " + session.nick + " :-\r\n");
+        welcome.append(":tmi.twitch.tv 375 " + session.nick + " :-\r\n");
+        welcome.append(":tmi.twitch.tv 372 " + session.nick + " :You are in a maze of twisty passages, all alike.\r\n");
+        welcome.append(":tmi.twitch.tv 376 " + session.nick + " :>\r\n");
+        socket->write(welcome);
+    }
+    else if ( line.startsWith("CAP REQ ") )
+    {
+        /* Acknowledge all requested capabilities */
+        socket->write(":tmi.twitch.tv CAP * ACK " + line.mid(8) + "\r\n");
+    }
+    else if ( line.startsWith("PING") )
+    {
+        socket->write(":tmi.twitch.tv PONG tmi.twitch.tv :tmi.twitch.tv\r\n");
+    }
+    else if ( line.startsWith("JOIN ") )
+    {
+        QByteArray reply;
+        const QByteArray prefix = ":" + session.nick + "!" + session.nick + "@" + session.nick + ".tmi.twitch.tv";
+
+        /* A single JOIN may contain a comma separated list of channels */
+        foreach (QByteArray channel, line.mid(5).trimmed().split(','))
+        {
+            if ( !channel.startsWith('#') )
+            {
+                continue;
+            }
+            channel.remove(0, 1);
+
+            session.channels.insert(channel);
+            mJoins++;
+
+            reply.append(prefix + " JOIN #" + channel + "\r\n");
+
+            /* Send the NAMES reply, split into several lines for large channels */
+            QByteArray namesPrefix = ":" + session.nick + ".tmi.twitch.tv 353 " + session.nick + " = #" + channel + " :";
+            QByteArray names = session.nick;
+            for (int i=0; i<mConfig.namesCount; i++)
+            {
+                if ( names.size() > NAMES_LINE_LENGTH )
+                {
+                    reply.append(namesPrefix + names + "\r\n");
+                    names.clear();
+                }
+                else
+                {
+                    names.append(' ');
+                }
+                names.append("chatter" + QByteArray::number(i));
+            }
+            reply.append(namesPrefix + names + "\r\n");
+            reply.append(":" + session.nick + ".tmi.twitch.tv 366 " + session.nick + " #" + channel + " :End of /NAMES list\r\n");
+
+            /* Tell the client its badges and moderator status in the channel */
+            if ( isModerated(channel) )
+            {
+                reply.append("@badges=moderator/1;mod=1;user-type=mod :tmi.twitch.tv USERSTATE #" + channel + "\r\n");
+            }
+            else
+            {
+                reply.append("@badges=;mod=0;user-type= :tmi.twitch.tv USERSTATE #" + channel + "\r\n");
+            }
+        }
+
+        socket->write(reply);
+    }
+    else if ( line.startsWith("PART ") )
+    {
+        QByteArray reply;
+        const QByteArray prefix = ":" + session.nick + "!" + session.nick + "@" + session.nick + ".tmi.twitch.tv";
+
+        foreach (QByteArray channel, line.mid(5).trimmed().split(','))
+        {
+            if ( !channel.startsWith('#') )
+            {
+                continue;
+            }
+            channel.remove(0, 1);
+
+            session.channels.remove(channel);
+            mParts++;
+
+            reply.append(prefix + " PART #" + channel + "\r\n");
+        }
+
+        socket->write(reply);
+    }
+    else if ( line.startsWith("PRIVMSG #") )
+    {
+        /* Split into channel and message */
+        int separator = line.indexOf(" :");
+        if ( separator < 0 )
+        {
+            return;
+        }
+
+        QByteArray channel = line.mid(9, separator - 9);
+        QList<QByteArray> message = line.mid(separator + 2).split(' ');
+
+        /* Only moderation commands are of interest */
+        if ( message.count() >= 2 &&
+             ( message.at(0) == ".ban" || message.at(0) == ".unban" ) )
+        {
+            handleCommand(socket, session, channel, message.at(0), message.at(1));
+        }
+    }
+}
+
+/**
+ * /brief handleCommand definition
+ */
+void MockTwitchServer::handleCommand(QTcpSocket* socket, Session& session, const QByteArray& channel, const QByteArray& command, const QByteArray& userName)
+{
+    qint64 now = mClock.elapsed();
+
+    mCommands++;
+
+    /* Drop all commands outside of the rate limit window */
+    while ( !session.commandTimes.isEmpty() &&
+            session.commandTimes.head() <= now - mConfig.commandWindow )
+    {
+        session.commandTimes.dequeue();
+    }
+
+    /* Reject the command if the rate limit is exceeded */
+    if ( session.commandTimes.count() >= mConfig.commandLimit )
+    {
+        mRateLimited++;
+        socket->write("@msg-id=msg_ratelimit :tmi.twitch.tv NOTICE #" + channel + " :Your message was not sent because you are sending messages too quickly.\r\n");
+        return;
+    }
+    session.commandTimes.enqueue(now);
+
+    /* Only moderators may ban */
+    if ( !isModerated(channel) )
+    {
+        mNoPermission++;
+        socket->write("@msg-id=no_permission :tmi.twitch.tv NOTICE #" + channel + " :You don't have permission to perform that action.\r\n");
+        return;
+    }
+
+    /* Keep track of the fan-out progress of the user */
+    if ( !mFanOuts.contains(userName) )
+    {
+        FanOut fanOut;
+        fanOut.first = now;
+        fanOut.last = now;
+        fanOut.channels = 0;
+        mFanOuts.insert(userName, fanOut);
+    }
+    FanOut& fanOut = mFanOuts[userName];
+    fanOut.last = now;
+    fanOut.channels++;
+
+    /* Acknowledge the command */
+    if ( command == ".ban" )
+    {
+        socket->write("@msg-id=ban_success :tmi.twitch.tv NOTICE #" + channel + " :" + userName + " is now banned from this channel.\r\n");
+    }
+    else
+    {
+        socket->write("@msg-id=unban_success :tmi.twitch.tv NOTICE #" + channel + " :" + userName + " is no longer banned from this chat room.\r\n");
+    }
+}
+
+/**
+ * /brief floodTimer definition
+ */
+void MockTwitchServer::floodTimer()
+{
+    QHash<QTcpSocket*, Session>::iterator it;
+
+    for (it = mSessions.begin(); it != mSessions.end(); ++it)
+    {
+        Session& session = it.value();
+
+        /* All joined channels and the synthetic ones are flooded */
+        QList<QByteArray> channels = session.channels.toList();
+        for (int i=0; i<mConfig.floodChannels; i++)
+        {
+            channels << "flood" + QByteArray::number(i);
+        }
+
+        if ( channels.isEmpty() || session.nick.isEmpty() )
+        {
+            continue;
+        }
+
+        /* Calculate the number of messages of this interval */
+        session.floodCredit += (double)mConfig.floodRate * FLOOD_INTERVAL / 1000.0;
+        int messages = (int)session.floodCredit;
+        session.floodCredit -= messages;
+
+        /* Generate all messages into a single buffer */
+        QByteArray flood;
+        for (int i=0; i<messages; i++)
+        {
+            quint64 sequence = session.floodSequence++;
+            QByteArray user = "flooder" + QByteArray::number(sequence % (quint64)qMax(1, mConfig.floodUsers));
+            QByteArray channel = channels.at(sequence % channels.count());
+
+            flood.append(":" + user + "!" + user + "@" + user + ".tmi.twitch.tv PRIVMSG #" + channel + " :buy followers at example dot com " + QByteArray::number(sequence) + "\r\n");
+        }
+
+        mFloodMessages += messages;
+        it.key()->write(flood);
+    }
+}
+
+/**
+ * /brief isModerated definition
+ */
+bool MockTwitchServer::isModerated(const QByteArray& channel) const
+{
+    /* Stable for a channel across clients and connections */
+    return ( mConfig.unmoderatedEvery <= 0 || (qHash(channel) % (uint)mConfig.unmoderatedEvery) != 0 );
+}
+
+/**
+ * /brief statisticsTimer definition
+ */
+void MockTwitchServer::statisticsTimer()
+{
+    qint64 now = mClock.elapsed();
+
+    qInfo().noquote() << QString("stats clients=%1 joins=%2 parts=%3 commands=%4 ratelimited=%5 nopermission=%6 flood=%7")
+                         .arg(mSessions.count())
+                         .arg(mJoins)
+                         .arg(mParts)
+                         .arg(mCommands)
+                         .arg(mRateLimited)
+                         .arg(mNoPermission)
+                         .arg(mFloodMessages);
+
+    /* Report all completed fan-outs */
+    QHash<QByteArray, FanOut>::iterator it = mFanOuts.begin();
+    while (it != mFanOuts.end())
+    {
+        if ( now - it.value().last > FANOUT_IDLE_TIME )
+        {
+            qInfo().noquote() << QString("fanout user=%1 channels=%2 duration_ms=%3")
+                                 .arg(QString::fromUtf8(it.key()))
+                                 .arg(it.value().channels)
+                                 .arg(it.value().last - it.value().first);
+            it = mFanOuts.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
@@ -0,0 +1,173 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    mocktwitchserver.h
+ * /author  Hackspider
+ * /brief   Header file of the mock twitch irc service
+ */
+
+/* Include Guard */
+#ifndef MOCKTWITCHSERVER_H
+#define MOCKTWITCHSERVER_H
+
+/* Necessary dependencies to Qt framework */
+#include <QObject>
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QSet>
+#include <QQueue>
+
+/**
+ * /brief  Configuration of the mock twitch irc service
+ */
+typedef struct
+{
+    quint16 port;             /* Port to listen on */
+    int floodRate;            /* Generated chat messages per second and client (0 disables the flood) */
+    int floodChannels;        /* Number of synthetic channels flooded in addition to the joined ones */
+    int floodUsers;           /* Number of distinct users the flood is generated from */
+    int namesCount;           /* Number of users listed in the NAMES reply of every join */
+    int commandLimit;         /* Number of moderation commands accepted per rate limit window */
+    int commandWindow;        /* Rate limit window in milliseconds */
+    int unmoderatedEvery;     /* Every n-th channel the client isn't a moderator of (0 moderates all channels) */
+} MockTwitchConfig;
+
+/**
+ * /brief  The MockTwitchServer class declaration. Derived from QObject class.
+ */
+class MockTwitchServer : public QObject
+{
+    Q_OBJECT
+public:
+    /**
+     * /brief  Constructor of the MockTwitchServer class
+     * /param  config  Configuration of the mock service
+     * /param  parent  Parent of the MockTwitchServer object according to Qt's object tree
+     */
+    explicit MockTwitchServer(const MockTwitchConfig& config, QObject *parent = nullptr);
+
+    /**
+     * /brief  Destructor of the MockTwitchServer class
+     */
+    virtual ~MockTwitchServer(void);
+
+    /**
+     * /brief   Method to start listening for clients
+     * /return  Returns true if the server listens
+     */
+    bool Listen(void);
+
+private slots:
+    /**
+     * /brief  Method will be called if a new client connects
+     */
+    void newConnection(void);
+
+    /**
+     * /brief  Method will be called if a client sends data
+     */
+    void readyRead(void);
+
+    /**
+     * /brief  Method will be called if a client disconnects
+     */
+    void disconnected(void);
+
+    /**
+     * /brief  Method will be called cyclic to generate the chat flood
+     */
+    void floodTimer(void);
+
+    /**
+     * /brief  Method will be called every second to print the statistics
+     */
+    void statisticsTimer(void);
+
+private:
+    /**
+     * /brief  State of a single connected client
+     */
+    typedef struct
+    {
+        QByteArray buffer;                  /* Incomplete line received from the client */
+        QByteArray nick;                    /* Nick name of the client */
+        QSet<QByteArray> channels;          /* Channels the client has joined */
+        QQueue<qint64> commandTimes;        /* Timestamps of the moderation commands within the rate limit window */
+        double floodCredit;                 /* Fraction of flood messages not sent yet */
+        quint64 floodSequence;              /* Sequence number of the flood messages */
+    } Session;
+
+    /**
+     * /brief  Progress of the ban fan-out of a single user
+     */
+    typedef struct
+    {
+        qint64 first;                       /* Timestamp of the first moderation command */
+        qint64 last;                        /* Timestamp of the latest moderation command */
+        int channels;                       /* Number of channels the command has been received for */
+    } FanOut;
+
+    /**
+     * /brief  Internally used method to handle a single line of a client
+     * /param  socket   Pointer to the socket of the client
+     * /param  session  Reference to the session of the client
+     * /param  line     Line received from the client
+     */
+    void handleLine(QTcpSocket* socket, Session& session, const QByteArray& line);
+
+    /**
+     * /brief  Internally used method to handle a moderation command
+     * /param  socket   Pointer to the socket of the client
+     * /param  session  Reference to the session of the client
+     * /param  channel  Channel the command has been sent to
+     * /param  command  Command (e.g. ".ban")
+     * /param  userName User the command applies to
+     */
+    void handleCommand(QTcpSocket* socket, Session& session, const QByteArray& channel, const QByteArray& command, const QByteArray& userName);
+
+    /**
+     * /brief   Internally used method to check if the client is a moderator of a channel
+     * /param   channel  Name of the channel
+     * /return  Returns true if moderation commands are permitted
+     */
+    bool isModerated(const QByteArray& channel) const;
+
+    /**
+     * /brief Internal used variables
+     */
+    MockTwitchConfig mConfig;
+    QTcpServer* mServer;
+    QTimer* mFloodTimer;
+    QTimer* mStatisticsTimer;
+    QElapsedTimer mClock;
+    QHash<QTcpSocket*, Session> mSessions;
+    QHash<QByteArray, FanOut> mFanOuts;
+    quint64 mJoins;
+    quint64 mParts;
+    quint64 mCommands;
+    quint64 mRateLimited;
+    quint64 mNoPermission;
+    quint64 mFloodMessages;
+};
+
+#endif /* MOCKTWITCHSERVER_H */
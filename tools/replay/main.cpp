@@ -0,0 +1,153 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    main.cpp
+ * /author  Hackspider
+ * /brief   Source file of the session replay entry
+ */
+
+/* Necessary dependencies to Qt framework */
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QThread>
+#include <QTextStream>
+
+/* Necessary internal dependencies */
+#include "twitchconnector.h"
+#include "sessionrecorder.h"
+
+/**
+ * /brief  Single inbound record of a session
+ */
+typedef struct
+{
+    qint64 timestamp;
+    QByteArray data;
+} ReplayRecord;
+
+/**
+ * /brief  Session replay main entry
+ */
+int main(int argc, char *argv[])
+{
+    /* Create a new QCoreApplication, no ui is needed */
+    QCoreApplication application(argc, argv);
+
+    /* Define all command line options */
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Replays a recorded twitch session through the parser of the connector");
+    parser.addHelpOption();
+    parser.addPositionalArgument("session", "Session file recorded by the connector.");
+
+    QCommandLineOption realtimeOption("realtime", "Replay with the original timing instead of as fast as possible.");
+    QCommandLineOption repeatOption("repeat", "Number of times the session is replayed.", "count", "1");
+    parser.addOption(realtimeOption);
+    parser.addOption(repeatOption);
+
+    parser.process(application);
+
+    if ( parser.positionalArguments().count() != 1 )
+    {
+        parser.showHelp(1);
+    }
+
+    QTextStream out(stdout);
+
+    /* Load the whole session upfront to keep file access out of the measurement */
+    SessionReader reader;
+    if ( !reader.Open(parser.positionalArguments().at(0)) )
+    {
+        out << "Failed to open session file " << parser.positionalArguments().at(0) << endl;
+        return 1;
+    }
+
+    QList<ReplayRecord> records;
+    QSet<QString> channels;
+    qint64 totalBytes = 0;
+    qint64 totalLines = 0;
+
+    RecordDirection direction;
+    ReplayRecord record;
+    while ( reader.ReadNext(&direction, &record.timestamp, &record.data) )
+    {
+        if ( direction == RECORD_INBOUND )
+        {
+            totalBytes += record.data.size();
+            totalLines += record.data.count('\n');
+            records.append(record);
+        }
+        else
+        {
+            /* Restore the channels from the recorded JOIN commands */
+            foreach (const QByteArray& line, record.data.split('\n'))
+            {
+                if ( line.startsWith("JOIN #") )
+                {
+                    channels.insert(QString::fromUtf8(line.mid(6).trimmed()));
+                }
+            }
+        }
+    }
+
+    /* The connector is never connected to the twitch service, so nothing is sent during the replay */
+    TwitchConnector connector("localhost", 6667, "replay", "oauth:replay");
+    connector.SetChannels(channels);
+
+    bool realtime = parser.isSet(realtimeOption);
+    int repeat = qMax(1, parser.value(repeatOption).toInt());
+
+    /* Feed all inbound records into the parser */
+    QElapsedTimer clock;
+    clock.start();
+
+    for (int r=0; r<repeat; r++)
+    {
+        qint64 start = clock.nsecsElapsed();
+
+        for (int i=0; i<records.count(); i++)
+        {
+            if ( realtime )
+            {
+                /* Wait until the original point of time of the record */
+                qint64 due = start + records.at(i).timestamp - records.at(0).timestamp;
+                qint64 remaining = due - clock.nsecsElapsed();
+                if ( remaining > 0 )
+                {
+                    QThread::usleep((unsigned long)(remaining / 1000));
+                }
+            }
+
+            connector.ProcessData(records.at(i).data);
+        }
+    }
+
+    /* Report the throughput */
+    double seconds = (double)clock.nsecsElapsed() / 1e9;
+    out << "records=" << records.count() * repeat
+        << " bytes=" << totalBytes * repeat
+        << " lines=" << totalLines * repeat
+        << " seconds=" << seconds
+        << " lines_per_second=" << (seconds > 0.0 ? (double)(totalLines * repeat) / seconds : 0.0)
+        << " megabytes_per_second=" << (seconds > 0.0 ? (double)(totalBytes * repeat) / seconds / 1e6 : 0.0)
+        << endl;
+
+    return 0;
+}
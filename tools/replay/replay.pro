@@ -0,0 +1,20 @@
+#-------------------------------------------------
+#
+# Deterministic replay of recorded twitch sessions through the connector
+#
+#-------------------------------------------------
+
+QT       += core network
+QT       -= gui
+
+TARGET = replay
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+include(../../twitchcore.pri)
+
+SOURCES += \
+    main.cpp
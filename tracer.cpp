@@ -0,0 +1,193 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    tracer.cpp
+ * /author  Hackspider
+ * /brief   Source file of the scoped trace spans and their Chrome trace export
+ */
+
+/* Necessary dependencies to the standard library */
+#include <algorithm>
+
+/* Necessary dependencies to Qt framework */
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QList>
+#include <QVector>
+#include <QSaveFile>
+#include <QThread>
+
+/* Necessary internal dependencies */
+#include "tracer.h"
+
+/* Type of the span ring of a thread, the rings are never freed so an export can still read them */
+typedef struct
+{
+    int threadId;
+    QString threadName;
+    QAtomicInteger<quint64> head;
+    TraceEvent events[TRACE_RING_SIZE];
+} TraceRing;
+
+/* Recording state of all threads */
+QAtomicInt Tracer::sEnabled(0);
+
+/* Rings of all threads which have recorded a span */
+static QMutex sRingMutex;
+static QList<TraceRing*> sRings;
+
+/* Ring of the calling thread */
+static thread_local TraceRing* sThreadRing = nullptr;
+
+/**
+ * /brief  Helper to get the clock of the tracer, started on first use
+ * /return Returns the clock
+ */
+static const QElapsedTimer& traceClock()
+{
+    static QElapsedTimer clock = []() { QElapsedTimer timer; timer.start(); return timer; }();
+    return clock;
+}
+
+/**
+ * /brief SetEnabled definition
+ */
+void Tracer::SetEnabled(bool enabled)
+{
+    /* Start the clock before the first span */
+    traceClock();
+    sEnabled.store(enabled ? 1 : 0);
+}
+
+/**
+ * /brief Now definition
+ */
+qint64 Tracer::Now()
+{
+    return traceClock().nsecsElapsed();
+}
+
+/**
+ * /brief Record definition
+ */
+void Tracer::Record(const char* name, qint64 start, qint64 end)
+{
+    TraceRing* ring = sThreadRing;
+
+    /* The first span of a thread registers its ring */
+    if (ring == nullptr)
+    {
+        ring = new TraceRing;
+        ring->head.store(0);
+        ring->threadName = (QThread::currentThread() != nullptr) ? QThread::currentThread()->objectName() : QString();
+
+        QMutexLocker locker(&sRingMutex);
+        ring->threadId = sRings.count() + 1;
+        sRings.append(ring);
+        sThreadRing = ring;
+    }
+
+    /* Only this thread writes the ring, the head is published after the event */
+    quint64 head = ring->head.load();
+    TraceEvent& event = ring->events[head & (TRACE_RING_SIZE - 1)];
+    event.name = name;
+    event.start = start;
+    event.duration = end - start;
+    ring->head.storeRelease(head + 1);
+}
+
+/**
+ * /brief WriteChromeTrace definition
+ */
+int Tracer::WriteChromeTrace(const QString& fileName, int seconds)
+{
+    qint64 now = Now();
+    qint64 since = now - (qint64)seconds * 1000000000LL;
+
+    QList<TraceRing*> rings;
+    sRingMutex.lock();
+    rings = sRings;
+    sRingMutex.unlock();
+
+    QByteArray json = "{\"traceEvents\":[\n";
+    int count = 0;
+    QVector<TraceEvent> events;
+
+    foreach (TraceRing* ring, rings)
+    {
+        /* Copy the events, the recording thread keeps on writing meanwhile */
+        quint64 head = ring->head.loadAcquire();
+        quint64 first = (head > TRACE_RING_SIZE) ? head - TRACE_RING_SIZE : 0;
+
+        events.clear();
+        for (quint64 i=first; i<head; i++)
+        {
+            events.append(ring->events[i & (TRACE_RING_SIZE - 1)]);
+        }
+
+        /* Drop the events which may have been overwritten while copying (plus the one being written of a full ring) */
+        quint64 overwritten = ring->head.loadAcquire() - head + ( (head >= TRACE_RING_SIZE) ? 1 : 0 );
+        int skip = (int)qMin<quint64>(overwritten, events.count());
+
+        /* Name the thread */
+        json.append( QString("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%1,\"args\":{\"name\":\"%2\"}},\n")
+                     .arg(ring->threadId)
+                     .arg(ring->threadName.isEmpty() ? QString("thread %1").arg(ring->threadId) : ring->threadName).toUtf8() );
+
+        for (int i=skip; i<events.count(); i++)
+        {
+            const TraceEvent& event = events.at(i);
+            if ( event.start < since )
+            {
+                continue;
+            }
+
+            /* Complete events with microsecond timestamps */
+            json.append("{\"name\":\"");
+            json.append(event.name);
+            json.append("\",\"ph\":\"X\",\"pid\":1,\"tid\":");
+            json.append(QByteArray::number(ring->threadId));
+            json.append(",\"ts\":");
+            json.append(QByteArray::number(event.start / 1000.0, 'f', 3));
+            json.append(",\"dur\":");
+            json.append(QByteArray::number(event.duration / 1000.0, 'f', 3));
+            json.append("},\n");
+            count++;
+        }
+    }
+
+    /* Remove the separator of the last event */
+    if ( json.endsWith(",\n") )
+    {
+        json.chop(2);
+        json.append("\n");
+    }
+    json.append("],\"displayTimeUnit\":\"ms\"}\n");
+
+    QSaveFile file(fileName);
+    if ( !file.open(QIODevice::WriteOnly) )
+    {
+        return -1;
+    }
+    file.write(json);
+
+    return file.commit() ? count : -1;
+}
@@ -0,0 +1,150 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    tracer.h
+ * /author  Hackspider
+ * /brief   Header file of the scoped trace spans and their Chrome trace export
+ */
+
+/* Include Guard */
+#ifndef TRACER_H
+#define TRACER_H
+
+/* Necessary dependencies to Qt framework */
+#include <QString>
+#include <QAtomicInteger>
+
+/* Number of spans kept per thread (power of two), the oldest spans are overwritten */
+#define TRACE_RING_SIZE 65536
+
+/* Default number of seconds written by a trace export */
+#define TRACE_DEFAULT_SECONDS 30
+
+/* Type of a recorded span */
+typedef struct
+{
+    const char* name;
+    qint64 start;
+    qint64 duration;
+} TraceEvent;
+
+/**
+ * /brief  The Tracer class declaration.
+ *
+ * Every thread records its spans into its own ring of TRACE_RING_SIZE
+ * events with monotonic nanosecond timestamps, so recording takes no lock
+ * and shares no cache line with other threads. The names are string
+ * literals and are not copied. While the tracer is disabled a span costs a
+ * single relaxed atomic load. WriteChromeTrace() writes the spans of the
+ * last seconds of all threads in the Chrome trace event format (loadable by
+ * chrome://tracing and Perfetto).
+ */
+class Tracer
+{
+public:
+    /**
+     * /brief  Method to enable or disable the recording of spans
+     * /param  enabled  True to record spans
+     */
+    static void SetEnabled(bool enabled);
+
+    /**
+     * /brief   Method to get the recording state
+     * /return  Returns true if spans are recorded
+     */
+    static inline bool IsEnabled(void)
+    {
+        return ( sEnabled.load() != 0 );
+    }
+
+    /**
+     * /brief   Method to get the monotonic time of the tracer
+     * /return  Returns the nanoseconds since the tracer clock has been started
+     */
+    static qint64 Now(void);
+
+    /**
+     * /brief  Method to record a span of the calling thread
+     * /param  name   Name of the span (string literal, not copied)
+     * /param  start  Start of the span as returned by Now
+     * /param  end    End of the span as returned by Now
+     */
+    static void Record(const char* name, qint64 start, qint64 end);
+
+    /**
+     * /brief   Method to write the recorded spans as Chrome trace event file
+     * /param   fileName  Name of the json file
+     * /param   seconds   Number of seconds back from now to write
+     * /return  Returns the number of written spans or -1 if the file couldn't be written
+     */
+    static int WriteChromeTrace(const QString& fileName, int seconds = TRACE_DEFAULT_SECONDS);
+
+private:
+    /**
+     * /brief Internal used variables
+     */
+    static QAtomicInt sEnabled;
+};
+
+/**
+ * /brief  The TraceSpan class declaration. Records the lifetime of the object as span.
+ */
+class TraceSpan
+{
+public:
+    /**
+     * /brief  Constructor of the TraceSpan class, starts the span if the tracer is enabled
+     * /param  name  Name of the span (string literal, not copied)
+     */
+    inline explicit TraceSpan(const char* name)
+        : mName(name),
+        mStart( Tracer::IsEnabled() ? Tracer::Now() : -1 )
+    {
+    }
+
+    /**
+     * /brief  Destructor of the TraceSpan class, records the span
+     */
+    inline ~TraceSpan(void)
+    {
+        if (mStart >= 0)
+        {
+            Tracer::Record(mName, mStart, Tracer::Now());
+        }
+    }
+
+private:
+    /**
+     * /brief Internal used variables
+     */
+    const char* mName;
+    qint64 mStart;
+};
+
+/* Scoped span until the end of the enclosing block, compiled out without LPZ_TRACE */
+#ifdef LPZ_TRACE
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+#define TRACE_SPAN(name) TraceSpan TRACE_CONCAT(traceSpan, __LINE__)(name)
+#else
+#define TRACE_SPAN(name)
+#endif
+
+#endif /* TRACER_H */
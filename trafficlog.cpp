@@ -0,0 +1,362 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    trafficlog.cpp
+ * /author  Hackspider
+ * /brief   Source file of the asynchronous rotating log of the raw twitch traffic
+ */
+
+/* Necessary dependencies to the standard library */
+#include <string.h>
+
+/* Necessary dependencies to Qt framework */
+#include <QtEndian>
+#include <QDateTime>
+#include <QDebug>
+
+/* Necessary internal dependencies */
+#include "trafficlog.h"
+
+/* Size of the header of a record in the ring: 8 byte timestamp, 1 byte direction, 4 byte length */
+#define TRAFFIC_LOG_RECORD_HEADER 13
+
+/**
+ * /brief TrafficLog definition
+ */
+TrafficLog::TrafficLog(QObject *parent)
+    : QThread(parent),
+    mHead(0),
+    mTail(0),
+    mStop(0),
+    mLogging(false),
+    mMaxBytes(TRAFFIC_LOG_DEFAULT_MAX_BYTES),
+    mInterval(TRAFFIC_LOG_DEFAULT_INTERVAL),
+    mCompress(false),
+    mRecords(0),
+    mBytes(0),
+    mDroppedRecords(0),
+    mDroppedBytes(0),
+    mFiles(0)
+{
+    /* Nothing to do here, the ring is allocated when the log is started */
+}
+
+/**
+ * /brief ~TrafficLog definition
+ */
+TrafficLog::~TrafficLog()
+{
+    /* Make sure all appended data is written */
+    Stop();
+}
+
+/**
+ * /brief Start definition
+ */
+bool TrafficLog::Start(const QString& baseName, qint64 maxBytes, int interval, bool compress)
+{
+    /* Finish a running log first */
+    Stop();
+
+    if ( baseName.isEmpty() )
+    {
+        return false;
+    }
+
+    mBaseName = baseName;
+    mMaxBytes = maxBytes;
+    mInterval = interval;
+    mCompress = compress;
+    mPartial[RECORD_INBOUND].clear();
+    mPartial[RECORD_OUTBOUND].clear();
+
+    /* The ring is allocated once and kept for further logs */
+    if ( mRing.size() != TRAFFIC_LOG_RING_SIZE )
+    {
+        mRing.resize(TRAFFIC_LOG_RING_SIZE);
+    }
+    mHead.store(0);
+    mTail.store(0);
+
+    /* Start the writer thread */
+    mStop.store(0);
+    mLogging = true;
+    start(QThread::LowPriority);
+
+    return true;
+}
+
+/**
+ * /brief Stop definition
+ */
+void TrafficLog::Stop()
+{
+    if ( !mLogging )
+    {
+        return;
+    }
+
+    /* Signal the writer thread to write the remaining data and to finish */
+    mLogging = false;
+    mStop.storeRelease(1);
+
+    wait();
+}
+
+/**
+ * /brief IsLogging definition
+ */
+bool TrafficLog::IsLogging() const
+{
+    return mLogging;
+}
+
+/**
+ * /brief Append definition
+ */
+void TrafficLog::Append(RecordDirection direction, const QByteArray& data)
+{
+    if ( !mLogging || data.isEmpty() )
+    {
+        return;
+    }
+
+    /* Only the writer thread moves the tail, so the free space can only grow while we copy */
+    quint64 size = TRAFFIC_LOG_RECORD_HEADER + (quint64)data.size();
+    quint64 head = mHead.load();
+    quint64 tail = mTail.loadAcquire();
+
+    if ( size > TRAFFIC_LOG_RING_SIZE - (head - tail) )
+    {
+        /* The writer can't keep up, drop the record instead of blocking */
+        mDroppedRecords.fetchAndAddRelaxed(1);
+        mDroppedBytes.fetchAndAddRelaxed(data.size());
+        return;
+    }
+
+    /* Encode the record header */
+    char header[TRAFFIC_LOG_RECORD_HEADER];
+    qToLittleEndian<qint64>(QDateTime::currentMSecsSinceEpoch(), header);
+    header[8] = (char)direction;
+    qToLittleEndian<quint32>((quint32)data.size(), header + 9);
+
+    copyIn(head, header, TRAFFIC_LOG_RECORD_HEADER);
+    copyIn(head + TRAFFIC_LOG_RECORD_HEADER, data.constData(), data.size());
+
+    /* Publish the record to the writer thread */
+    mHead.storeRelease(head + size);
+}
+
+/**
+ * /brief Metrics definition
+ */
+TrafficLogMetrics TrafficLog::Metrics() const
+{
+    TrafficLogMetrics metrics;
+
+    metrics.records = mRecords.load();
+    metrics.bytes = mBytes.load();
+    metrics.droppedRecords = mDroppedRecords.load();
+    metrics.droppedBytes = mDroppedBytes.load();
+    metrics.files = mFiles.load();
+
+    return metrics;
+}
+
+/**
+ * /brief run definition
+ */
+void TrafficLog::run()
+{
+    QByteArray batch;
+    QByteArray data;
+    quint64 reportedDrops = mDroppedRecords.load();
+    bool stop = false;
+
+    while ( !stop )
+    {
+        /* Check the stop request before the head, so everything appended before is still written */
+        stop = ( mStop.loadAcquire() != 0 );
+
+        quint64 head = mHead.loadAcquire();
+        quint64 tail = mTail.load();
+
+        /* Format all published records into one batch */
+        while ( tail < head )
+        {
+            char header[TRAFFIC_LOG_RECORD_HEADER];
+            copyOut(tail, header, TRAFFIC_LOG_RECORD_HEADER);
+
+            qint64 timestamp = qFromLittleEndian<qint64>(header);
+            RecordDirection direction = ( header[8] == RECORD_OUTBOUND ) ? RECORD_OUTBOUND : RECORD_INBOUND;
+            int length = (int)qFromLittleEndian<quint32>(header + 9);
+
+            data.resize(length);
+            copyOut(tail + TRAFFIC_LOG_RECORD_HEADER, data.data(), length);
+            formatRecord(direction, timestamp, data, &batch);
+
+            tail += TRAFFIC_LOG_RECORD_HEADER + length;
+            mRecords.fetchAndAddRelaxed(1);
+            mBytes.fetchAndAddRelaxed(length);
+        }
+
+        /* Release the space to the network path before the slow write */
+        mTail.storeRelease(tail);
+
+        if ( !batch.isEmpty() )
+        {
+            writeBatch(batch);
+            batch.clear();
+        }
+
+        /* Start a new file once the current one is too old */
+        if ( mFile.isOpen() && mInterval > 0 && mFileAge.elapsed() >= (qint64)mInterval * 1000 )
+        {
+            mFile.close();
+        }
+
+        /* Report drops once per batch */
+        quint64 drops = mDroppedRecords.load();
+        if ( drops != reportedDrops )
+        {
+            qWarning().noquote() << "Traffic log dropped" << (drops - reportedDrops) << "records, the writer can't keep up";
+            reportedDrops = drops;
+        }
+
+        if ( !stop )
+        {
+            msleep(TRAFFIC_LOG_FLUSH_INTERVAL);
+        }
+    }
+
+    mFile.close();
+}
+
+/**
+ * /brief copyIn definition
+ */
+void TrafficLog::copyIn(quint64 position, const char* data, int length)
+{
+    int offset = (int)(position & (TRAFFIC_LOG_RING_SIZE - 1));
+    int first = qMin(length, TRAFFIC_LOG_RING_SIZE - offset);
+
+    /* Copy up to the end of the ring and the rest to its beginning */
+    memcpy(mRing.data() + offset, data, first);
+    memcpy(mRing.data(), data + first, length - first);
+}
+
+/**
+ * /brief copyOut definition
+ */
+void TrafficLog::copyOut(quint64 position, char* data, int length) const
+{
+    int offset = (int)(position & (TRAFFIC_LOG_RING_SIZE - 1));
+    int first = qMin(length, TRAFFIC_LOG_RING_SIZE - offset);
+
+    /* Copy up to the end of the ring and the rest from its beginning */
+    memcpy(data, mRing.constData() + offset, first);
+    memcpy(data + first, mRing.constData(), length - first);
+}
+
+/**
+ * /brief formatRecord definition
+ */
+void TrafficLog::formatRecord(RecordDirection direction, qint64 timestamp, const QByteArray& data, QByteArray* batch)
+{
+    /* Lines may be split over several reads, keep the incomplete line per direction */
+    QByteArray& partial = mPartial[direction];
+    partial.append(data);
+
+    QByteArray prefix = QDateTime::fromMSecsSinceEpoch(timestamp).toString("yyyy-MM-dd hh:mm:ss.zzz").toLatin1();
+    prefix.append( (direction == RECORD_INBOUND) ? " < " : " > " );
+
+    int start = 0;
+    int end = partial.indexOf('\n');
+    while ( end >= 0 )
+    {
+        int length = end - start;
+        if ( length > 0 && partial.at(end - 1) == '\r' )
+        {
+            length--;
+        }
+
+        batch->append(prefix);
+        batch->append(partial.constData() + start, length);
+        batch->append('\n');
+
+        start = end + 1;
+        end = partial.indexOf('\n', start);
+    }
+
+    partial.remove(0, start);
+}
+
+/**
+ * /brief writeBatch definition
+ */
+void TrafficLog::writeBatch(const QByteArray& batch)
+{
+    /* Start a new file with the current time in its name */
+    if ( !mFile.isOpen() )
+    {
+        QString fileName = mBaseName + QDateTime::currentDateTime().toString("-yyyyMMdd-hhmmss");
+        QString extension = mCompress ? ".log.z" : ".log";
+
+        /* Several files within a second get a number */
+        int number = 1;
+        QString candidate = fileName + extension;
+        while ( QFile::exists(candidate) )
+        {
+            candidate = QString("%1-%2%3").arg(fileName).arg(number++).arg(extension);
+        }
+
+        mFile.setFileName(candidate);
+        if ( !mFile.open(QIODevice::WriteOnly | QIODevice::Append) )
+        {
+            qWarning().noquote() << "Traffic log" << candidate << "can't be opened:" << mFile.errorString();
+            mDroppedBytes.fetchAndAddRelaxed(batch.size());
+            return;
+        }
+
+        mFileAge.start();
+        mFiles.fetchAndAddRelaxed(1);
+    }
+
+    /* Write the batch with a single write, compressed as one segment if requested */
+    if (mCompress)
+    {
+        QByteArray segment = qCompress(batch);
+        char length[4];
+        qToBigEndian<quint32>((quint32)segment.size(), length);
+        segment.prepend(length, 4);
+        mFile.write(segment);
+    }
+    else
+    {
+        mFile.write(batch);
+    }
+    mFile.flush();
+
+    /* Start a new file once the current one is too large */
+    if ( mMaxBytes > 0 && mFile.size() >= mMaxBytes )
+    {
+        mFile.close();
+    }
+}
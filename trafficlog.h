@@ -0,0 +1,184 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    trafficlog.h
+ * /author  Hackspider
+ * /brief   Header file of the asynchronous rotating log of the raw twitch traffic
+ */
+
+/* Include Guard */
+#ifndef TRAFFICLOG_H
+#define TRAFFICLOG_H
+
+/* Necessary dependencies to Qt framework */
+#include <QThread>
+#include <QFile>
+#include <QAtomicInteger>
+#include <QElapsedTimer>
+#include <QByteArray>
+
+/* Necessary internal dependencies */
+#include "sessionrecorder.h"
+
+/* Size of the ring buffer between the network path and the writer thread (power of two) */
+#define TRAFFIC_LOG_RING_SIZE (8 * 1024 * 1024)
+
+/* Interval in milliseconds the writer thread collects the appended data */
+#define TRAFFIC_LOG_FLUSH_INTERVAL 100
+
+/* Default size of a log file in bytes before the next file is started */
+#define TRAFFIC_LOG_DEFAULT_MAX_BYTES (64LL * 1024 * 1024)
+
+/* Default age of a log file in seconds before the next file is started */
+#define TRAFFIC_LOG_DEFAULT_INTERVAL 3600
+
+/* Type of the counters of the traffic log */
+typedef struct
+{
+    quint64 records;
+    quint64 bytes;
+    quint64 droppedRecords;
+    quint64 droppedBytes;
+    quint64 files;
+} TrafficLogMetrics;
+
+/**
+ * /brief  The TrafficLog class declaration. Derived from QThread class.
+ *
+ * Append() copies the raw data into a single producer, single consumer ring
+ * buffer without taking a lock, so a flood never stalls the socket: if the
+ * writer can't keep up, the data is dropped and counted instead. The writer
+ * thread collects the data every TRAFFIC_LOG_FLUSH_INTERVAL milliseconds,
+ * formats it as "<date> <time> <direction> <line>" lines and writes the batch
+ * with a single write. A new file
+ * "<base>-yyyyMMdd-hhmmss.log" is started once the file exceeds the maximum
+ * size or age. With compression every batch is written as a segment of a
+ * 4 byte big endian length followed by the qCompress'ed lines (".log.z").
+ */
+class TrafficLog : public QThread
+{
+    Q_OBJECT
+public:
+    /**
+     * /brief  Constructor of the TrafficLog class
+     * /param  parent  Parent of the TrafficLog object according to Qt's object tree
+     */
+    explicit TrafficLog(QObject *parent = nullptr);
+
+    /**
+     * /brief  Destructor of the TrafficLog class
+     */
+    virtual ~TrafficLog(void);
+
+    /**
+     * /brief   Method to start the logging
+     * /param   baseName  Path and base name of the log files
+     * /param   maxBytes  Size of a log file in bytes before the next file is started (0 for no limit)
+     * /param   interval  Age of a log file in seconds before the next file is started (0 for no limit)
+     * /param   compress  True to compress every written segment with qCompress
+     * /return  Returns true if the writer thread has been started
+     */
+    bool Start(const QString& baseName, qint64 maxBytes, int interval, bool compress);
+
+    /**
+     * /brief  Method to stop the logging, all appended data is written before the method returns
+     */
+    void Stop(void);
+
+    /**
+     * /brief   Method to get the logging state
+     * /return  Returns true if the log is running
+     */
+    bool IsLogging(void) const;
+
+    /**
+     * /brief  Method to append raw data to the log (lock free, must always be called from the same thread)
+     * /param  direction  Direction of the data
+     * /param  data       Raw data
+     */
+    void Append(RecordDirection direction, const QByteArray& data);
+
+    /**
+     * /brief   Method to get the counters of the log
+     * /return  Returns the number of written and dropped records and bytes and the number of files
+     */
+    TrafficLogMetrics Metrics(void) const;
+
+protected:
+    /**
+     * /brief  Writer thread which formats and writes the appended data
+     */
+    void run(void);
+
+private:
+    /**
+     * /brief  Internally used method to copy data into the ring buffer
+     * /param  position  Position in the ring (not wrapped)
+     * /param  data      Pointer to the data
+     * /param  length    Length of the data
+     */
+    void copyIn(quint64 position, const char* data, int length);
+
+    /**
+     * /brief  Internally used method to copy data out of the ring buffer
+     * /param  position  Position in the ring (not wrapped)
+     * /param  data      Pointer to the destination
+     * /param  length    Length of the data
+     */
+    void copyOut(quint64 position, char* data, int length) const;
+
+    /**
+     * /brief  Internally used method to format the complete lines of a record
+     * /param  direction  Direction of the record
+     * /param  timestamp  Time of the record in milliseconds since epoch
+     * /param  data       Raw data of the record
+     * /param  batch      Pointer to the batch the lines are appended to
+     */
+    void formatRecord(RecordDirection direction, qint64 timestamp, const QByteArray& data, QByteArray* batch);
+
+    /**
+     * /brief  Internally used method to write a batch, starts a new file if necessary
+     * /param  batch  Formatted lines
+     */
+    void writeBatch(const QByteArray& batch);
+
+    /**
+     * /brief Internal used variables
+     */
+    QByteArray mRing;
+    QAtomicInteger<quint64> mHead;
+    QAtomicInteger<quint64> mTail;
+    QAtomicInt mStop;
+    bool mLogging;
+    QString mBaseName;
+    qint64 mMaxBytes;
+    int mInterval;
+    bool mCompress;
+    QFile mFile;
+    QElapsedTimer mFileAge;
+    QByteArray mPartial[2];
+    QAtomicInteger<quint64> mRecords;
+    QAtomicInteger<quint64> mBytes;
+    QAtomicInteger<quint64> mDroppedRecords;
+    QAtomicInteger<quint64> mDroppedBytes;
+    QAtomicInteger<quint64> mFiles;
+};
+
+#endif /* TRAFFICLOG_H */
@@ -1,524 +1,1859 @@
-/****************************************************************************
- * Copyright (C) 2018 by Sebastian Ziganki                                  *
- *                                                                          *
- * This file is part of Lpz3ncLittleHelper.                                 *
- *                                                                          *
- *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
- *   modify it under the terms of the GNU Lesser General Public License as  *
- *   published by the Free Software Foundation, either version 3 of the     *
- *   License.                                                               *
- *                                                                          *
- *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
- *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
- *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
- *   GNU Lesser General Public License for more details.                    *
- *                                                                          *
- *   You should have received a copy of the GNU Lesser General Public       *
- *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
- ****************************************************************************/
-
-/**
- * /file    twitchconnector.cpp
- * /author  Hackspider
- * /brief   Source file of the twitch connector
- */
-
-/* Necessary dependencies to Qt framework */
-#include <QTextStream>
-#include <QRegularExpression>
-
-/* Necessary internal dependencies */
-#include "twitchconnector.h"
-
-/**
- * /brief TwitchConnector definition
- */
-TwitchConnector::TwitchConnector(
-                                  QString connectURL,
-                                  quint16 port,
-                                  QString loginName,
-                                  QString loginPass,
-                                  QStandardItemModel* channelModel,
-                                  QLabel* connectionIcon,
-                                  QPushButton* connectButton,
-                                  QObject *parent)
-    : QObject(parent),
-    mSocket(nullptr),
-    mConnectURL(connectURL),
-    mPort(port),
-    mCyclicTimer(nullptr),
-    mState(DISCONNECTED),
-    mLoginName(loginName),
-    mLoginPass(loginPass),
-    mChannelModel(channelModel),
-    mConnectionIcon(connectionIcon),
-    mConnectionButton(connectButton)
-{
-    /* Make sure no channel is tracked */
-    mConnectedChannels.clear();
-
-    /* Create a new tcp socket */
-    mSocket = new QTcpSocket();
-
-    /* Create a new cyclic timer */
-    mCyclicTimer = new QTimer();
-
-    /* Set intervall to 3 minutes for PING/PONG */
-    mCyclicTimer->setInterval(180000);
-
-    /* Connect the cyclic timer */
-    connect(mCyclicTimer, SIGNAL(timeout()), this, SLOT(pingTimer()));
-
-    /* Connect the tcp socket signals to corresponding methods */
-    connect(mSocket, SIGNAL(connected()),                         this, SLOT(connected()));
-    connect(mSocket, SIGNAL(disconnected()),                      this, SLOT(disconnected()));
-    connect(mSocket, SIGNAL(error(QAbstractSocket::SocketError)), this, SLOT(error(QAbstractSocket::SocketError)));
-    connect(mSocket, SIGNAL(readyRead()),                         this, SLOT(readyRead()));
-
-    /* Connect the channel model signals to corresponding methods */
-    connect(mChannelModel, SIGNAL(itemChanged(QStandardItem*)),       this, SLOT(channelModelItemChanged(QStandardItem*)));
-    connect(mChannelModel, SIGNAL(rowsInserted(QModelIndex,int,int)), this, SLOT(channelRowsChanged(QModelIndex,int,int)));
-    connect(mChannelModel, SIGNAL(rowsRemoved(QModelIndex,int,int)),  this, SLOT(channelRowsChanged(QModelIndex,int,int)));
-
-    /* Set the ui elements to disabled */
-    disconnectUI();
-}
-
-/**
- * /brief ~TwitchConnector definition
- */
-TwitchConnector::~TwitchConnector()
-{
-    /* Check for null pointer and delete elements */
-    if (mSocket != nullptr)
-    {
-        mSocket->disconnectFromHost();
-        delete mSocket;
-    }
-    if (mCyclicTimer != nullptr)
-    {
-        delete mCyclicTimer;
-    }
-}
-
-/**
- * /brief connected definition
- */
-void TwitchConnector::connected()
-{
-    /* Create pass and nick strings */
-    QString pass = "PASS " + mLoginPass + "\r\n";
-    QString nick = "NICK " + mLoginName + "\r\n";
-
-    /* Write pass and nick to tcp socket */
-    mSocket->write(pass.toLocal8Bit());
-    mSocket->write(nick.toLocal8Bit());
-}
-
-/**
- * /brief disconnected definition
- */
-void TwitchConnector::disconnected()
-{
-    /* Set the ui elements to disabled */
-    disconnectUI();
-}
-
-/**
- * /brief error definition
- */
-void TwitchConnector::error(QAbstractSocket::SocketError error)
-{
-    /* In case of error disconnect from host */
-    mSocket->disconnectFromHost();
-}
-
-/**
- * /brief readyRead definition
- */
-void TwitchConnector::readyRead()
-{
-    /* Read all available data into a text stream */
-    QTextStream textStream(mSocket->readAll().data());
-
-    /* Iterate over all lines received */
-    while (!textStream.atEnd())
-    {
-        /* Read a single line from received data */
-        QString line = textStream.readLine();
-
-        /* Parse successful connection message using regex */
-        QRegularExpression successConnectMessage("(:tmi\\.twitch\\.tv)\\s([0-9]{3,3})\\s(.+?)\\s:(Welcome,\\sGLHF!)");
-        QRegularExpressionMatch successConnectMessageMatch = successConnectMessage.match(line);
-
-        /* If the regex matches */
-        if (successConnectMessageMatch.hasMatch())
-        {
-            /* Set the ui elements to connected */
-            connectUI();
-
-            /* Start the ping/pong timer */
-            mCyclicTimer->start();
-
-            /* Iterate over all channels */
-            for (int i=0; i<mChannelModel->rowCount(); i++)
-            {
-                /* If the channel shall be connected */
-                if (Qt::Checked == mChannelModel->item(i)->checkState() )
-                {
-                    /* Create a join string */
-                    QString join = "JOIN #" + mChannelModel->item(i)->text() + "\r\n";
-
-                    /* Write join string to tcp socket */
-                    mSocket->write(join.toLocal8Bit());
-
-                }
-            }
-
-        }
-
-        /* Parse oauth failed message using regex */
-        QRegularExpression oauthFailedMessage("(:tmi.twitch.tv)\\s(NOTICE)\\s(\\*)\\s(:Improperly formatted auth)");
-        QRegularExpressionMatch oauthFailedMessageMatch = oauthFailedMessage.match(line);
-
-        /* Parse connect failed message using regex */
-        QRegularExpression connectFailedMessage("(:tmi.twitch.tv)\\s(NOTICE)\\s(\\*)\\s(:Login authentication failed)");
-        QRegularExpressionMatch connectFailedMessageMatch = connectFailedMessage.match(line);
-
-        /* If one of the regex matches */
-        if ( oauthFailedMessageMatch.hasMatch() ||
-             connectFailedMessageMatch.hasMatch() )
-        {
-            /* Set the ui elements to connected */
-            disconnectUI();
-
-            /* Stop the cyclic ping/pong timer */
-            mCyclicTimer->stop();
-        }
-
-        /* Parse channel connected message using regex */
-        QRegularExpression channelConnected(":(.+)(.tmi.twitch.tv)\\s([0-9]{3,3})\\s(.+)\\s=\\s\\#(.+)\\s:(.+)");
-        QRegularExpressionMatch channelConnectedMatch = channelConnected.match(line);
-
-        /* If the regex matches */
-        if ( channelConnectedMatch.hasMatch() )
-        {
-            /* Local channel name variable */
-            QString channelName;
-
-            /* The captured groups must be exactly 6 */
-            if ( channelConnectedMatch.lastCapturedIndex() == 6 )
-            {
-                /* Channel name equals group nr. 5 */
-                channelName = channelConnectedMatch.captured(5);
-
-                /* Iterate over all channel items */
-                for (int i=0; i<mChannelModel->rowCount(); i++)
-                {
-                    /* If channel name matches */
-                    if  ( 0 == mChannelModel->item(i)->text().compare(channelName) )
-                    {
-                        /* Set the channel icon to OK */
-                        mChannelModel->item(i)->setIcon(QIcon(":/icons/images/OK.png"));
-
-                        /* Keep track of the connected channels */
-                        mConnectedChannels.insert(channelName);
-                    }
-                }
-
-            }
-        }
-
-        /* Parse channel disconnect message using regex */
-        QRegularExpression channelDisconnected(":(.+)\\!(.+)\\@(.+)\\.tmi.twitch.tv\\sPART\\s\\#(.+)");
-        QRegularExpressionMatch channelDisconnectedMatch = channelDisconnected.match(line);
-
-        /* If the regex matches */
-        if (channelDisconnectedMatch.hasMatch())
-        {
-            /* Local channel name variable */
-            QString channelName;
-
-            /* The captured groups must be exactly 4 */
-            if ( channelDisconnectedMatch.lastCapturedIndex() == 4 )
-            {
-                /* Channel name equals group nr. 4 */
-                channelName = channelDisconnectedMatch.captured(4);
-
-                /* Iterate over all channel items */
-                for (int i=0; i<mChannelModel->rowCount(); i++)
-                {
-                    /* If channel name matches */
-                    if  ( 0 == mChannelModel->item(i)->text().compare(channelName) )
-                    {
-                        /* Set the channel icon to NOK */
-                        mChannelModel->item(i)->setIcon(QIcon(":/icons/images/NOK.png"));
-
-                        /* Keep track of the connected channels */
-                        mConnectedChannels.remove(channelName);
-                    }
-                }
-            }
-        }
-    }
-}
-
-/**
- * /brief pingTimer definition
- */
-void TwitchConnector::pingTimer()
-{
-    /* Check if the socket is available and the twitch service is connected */
-    if ( mState  == CONNECTED &&
-         mSocket != nullptr )
-    {
-        /* Create ping string */
-        QString ping = "PING\r\n";
-
-        /* write ping string to tcp socket */
-        mSocket->write(ping.toLocal8Bit());
-    }
-}
-
-/**
- * /brief channelModelItemChanged definition
- */
-void TwitchConnector::channelModelItemChanged(QStandardItem *item)
-{
-    /* Delegate to sub function */
-    updateChannels();
-}
-
-/**
- * /brief channelRowsChanged definition
- */
-void TwitchConnector::channelRowsChanged(const QModelIndex &parent, int start, int end)
-{
-    /* Delegate to sub function */
-    updateChannels();
-}
-
-/**
- * /brief updateChannels definition
- */
-void TwitchConnector::updateChannels()
-{
-    /* Check if socket is available and if twitch service is connected */
-    if (mSocket == nullptr || mState != CONNECTED)
-    {
-        return;
-    }
-
-    /* Iterate over all channels */
-    for (int i=0; i<mChannelModel->rowCount(); i++)
-    {
-        /* Get a single item from model */
-        QStandardItem* item = mChannelModel->item(i);
-
-        /* Get the channel name from item */
-        QString channel = item->text();
-
-        /* If the channel is connected and the check box is unchecked */
-        if ( mConnectedChannels.contains(channel) &&
-             item->checkState() == Qt::Unchecked )
-        {
-            /* Create disconnect string */
-            QString disconnectString = "PART #" + channel + "\r\n";
-
-            /* Write disconnect string to tcp socket */
-            mSocket->write(disconnectString.toLocal8Bit());
-        }
-        /* If the channel is disconnected and the check box is checked */
-        else if ( !mConnectedChannels.contains(channel) &&
-                  item->checkState() == Qt::Checked )
-        {
-            /* Create connect string */
-            QString connectString = "JOIN #" + channel + "\r\n";
-
-            /* Write connect string to tcp socket */
-            mSocket->write(connectString.toLocal8Bit());
-        }
-    }
-}
-
-/**
- * /brief connectingUI definition
- */
-void TwitchConnector::connectingUI()
-{
-    /* Set internal state to connecting */
-    mState = CONNECTING;
-
-    /* Set connection icon to connecting */
-    mConnectionIcon->setPixmap(QIcon(":/icons/images/refresh.png").pixmap(16,16));
-
-    /* Disable the connection button while connecting */
-    mConnectionButton->setEnabled(false);
-
-    /* Change the connect button text to connecting */
-    mConnectionButton->setText("Connecting");
-}
-
-/**
- * /brief disconnectUI definition
- */
-void TwitchConnector::disconnectUI()
-{
-    /* Set internal state to disconnected */
-    mState = DISCONNECTED;
-
-    /* Remove all channels */
-    mConnectedChannels.clear();
-
-    /* Stop the ping/pong cyclic timer */
-    mCyclicTimer->stop();
-
-    /* Set connection icon to disconnected */
-    mConnectionIcon->setPixmap(QIcon(":/icons/images/NOK.png").pixmap(32,32));
-
-    /* Enable the connection button */
-    mConnectionButton->setEnabled(true);
-
-    /* Change the connect button text to connect */
-    mConnectionButton->setText("Connect");
-
-    /* Iterate over all channel items */
-    for (int i=0; i<mChannelModel->rowCount(); i++)
-    {
-        /* Set all channel icons to disconnected */
-        mChannelModel->item(i)->setIcon(QIcon(":/icons/images/NOK.png"));
-    }
-}
-
-/**
- * /brief connectUI definition
- */
-void TwitchConnector::connectUI()
-{
-    /* Set internal state to connected */
-    mState = CONNECTED;
-
-    /* Remove all channels */
-    mConnectedChannels.clear();
-
-    /* Set connection icon to connected */
-    mConnectionIcon->setPixmap(QIcon(":/icons/images/OK.png").pixmap(32,32));
-
-    /* Enable the connection button */
-    mConnectionButton->setEnabled(true);
-
-    /* Change the connect button text to disconnect */
-    mConnectionButton->setText("Disconnect");
-}
-
-/**
- * /brief banUser definition
- */
-QSet<QString> TwitchConnector::banUser(QString userName)
-{
-    /* Check if the socket and twitch service is available */
-    if (mSocket == nullptr || mState != CONNECTED)
-    {
-        return QSet<QString>();
-    }
-
-    /* Local variable to gather all channels where the user is banned */
-    QSet<QString> bannedChannels;
-
-    /* Iterate over all connected channels */
-    foreach (const QString& channel, mConnectedChannels)
-    {
-        /* Create ban command */
-        QString banCommand = "PRIVMSG #"+ channel + " :.ban " + userName +"\r\n";
-
-        /* Write ban command to tcp socket */
-        mSocket->write(banCommand.toUtf8());
-
-        /* Add the channel to keep track in which channels the user is banned */
-        bannedChannels.insert(channel);
-    }
-
-    /* Return set of channels where the user actually has been banned */
-    return bannedChannels;
-}
-
-/**
- * /brief unbanUser definition
- */
-QSet<QString> TwitchConnector::unbanUser(QString userName)
-{
-    /* Check if the socket and twitch service is available */
-    if (mSocket == nullptr || mState != CONNECTED)
-    {
-        return QSet<QString>();
-    }
-
-    /* Local variable to gather all channels where the user is unbanned */
-    QSet<QString> unbannedChannels;
-
-    /* Iterate over all connected channels */
-    foreach (const QString& channel, mConnectedChannels)
-    {
-        /* Create unban command */
-        QString unbanCommand = "PRIVMSG #"+ channel + " :.unban " + userName + "\r\n";
-
-        /* Write unban command to tcp socket */
-        mSocket->write(unbanCommand.toUtf8());
-
-        /* Add the channel to keep track in which channels the user is unbanned */
-        unbannedChannels.insert(channel);
-    }
-
-    /* Return set of channels where the user actually has been unbanned */
-    return unbannedChannels;
-}
-
-/**
- * /brief Connect definition
- */
-void TwitchConnector::Connect()
-{
-    /* Set the ui elements to connecting */
-    connectingUI();
-
-    /* Connect to twitch service*/
-    mSocket->connectToHost( mConnectURL, mPort );
-}
-
-/**
- * /brief Disconnect definition
- */
-void TwitchConnector::Disconnect()
-{
-    /* Disconnect from twitch service */
-    mSocket->disconnectFromHost();
-}
-
-/**
- * /brief GetConnectionState definition
- */
-ConnectionState TwitchConnector::GetConnectionState()
-{
-    /* Return the internal twitch service connection state */
-    return mState;
-}
-
-/**
- * /brief SetLoginName definition
- */
-void TwitchConnector::SetLoginName(QString loginName)
-{
-    /* Save the new login name internally */
-    mLoginName = loginName;
-}
-
-/**
- * /brief SetOauth2 definition
- */
-void TwitchConnector::SetOauth2(QString oauth2)
-{
-    /* Save the new login pass internally */
-    mLoginPass = oauth2;
-}
-
-
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    twitchconnector.cpp
+ * /author  Hackspider
+ * /brief   Source file of the twitch connector
+ */
+
+/* Necessary dependencies to the standard library */
+#include <string.h>
+
+/* Necessary dependencies to Qt framework */
+#include <QFile>
+#include <QDateTime>
+
+/* Necessary internal dependencies */
+#include "twitchconnector.h"
+
+/* Number of auto banned users remembered to avoid repeated bans */
+#define AUTO_BAN_MEMORY 10000
+
+/* Time in milliseconds before a further account is connected again after it lost its connection */
+#define ACCOUNT_RECONNECT_DELAY 10000
+
+/**
+ * /brief TwitchConnector definition
+ */
+TwitchConnector::TwitchConnector(
+                                  QString connectURL,
+                                  quint16 port,
+                                  QString loginName,
+                                  QString loginPass,
+                                  QObject *parent)
+    : QObject(parent),
+    mSocket(nullptr),
+    mConnectURL(connectURL),
+    mPort(port),
+    mCyclicTimer(nullptr),
+    mSeenTimer(nullptr),
+    mCommandTimer(nullptr),
+    mRecorder(nullptr),
+    mTrafficLog(nullptr),
+    mState(DISCONNECTED),
+    mLoginName(loginName),
+    mLoginPass(loginPass),
+    mAutoBan(false),
+    mTargetedBan(false),
+    mStandby(nullptr),
+    mDisconnectRequested(false),
+    mBanList(nullptr),
+    mBanListLoader(nullptr),
+    mFileWatcher(nullptr),
+    mBanListRate(BANLIST_DEFAULT_FILTER_RATE),
+    mBanListBytes(BANLIST_DEFAULT_FILTER_BYTES),
+    mBanListReload(false)
+{
+    /* Register the types of the signals for queued connections across threads */
+    qRegisterMetaType<ConnectionState>("ConnectionState");
+    qRegisterMetaType< QSet<QString> >("QSet<QString>");
+    qRegisterMetaType< QList<ChatIndexHit> >("QList<ChatIndexHit>");
+    qRegisterMetaType<BanListMetrics>("BanListMetrics");
+
+    /* Make sure no channel is tracked */
+    mChannels.clear();
+    mConnectedChannels.clear();
+
+    /* Create a new tcp socket (as child, so it follows the connector to its thread) */
+    mSocket = new QTcpSocket(this);
+
+    /* Create a new cyclic timer (as child, so it follows the connector to its thread) */
+    mCyclicTimer = new QTimer(this);
+    mSeenTimer = new QTimer(this);
+    mCommandTimer = new QTimer(this);
+
+    /* Create a new session recorder (idle until a recording is started) */
+    mRecorder = new SessionRecorder(this);
+
+    /* Create a new traffic log (idle until the log is started) */
+    mTrafficLog = new TrafficLog(this);
+
+    /* Start the monotonic clock of the spam wave detection */
+    mClock.start();
+
+    /* Set intervall to 3 minutes for PING/PONG */
+    mCyclicTimer->setInterval(180000);
+
+    /* Connect the cyclic timer */
+    connect(mCyclicTimer, SIGNAL(timeout()), this, SLOT(pingTimer()));
+
+    /* Pass the seen users once per second */
+    mSeenTimer->setInterval(1000);
+    connect(mSeenTimer, SIGNAL(timeout()), this, SLOT(seenTimer()));
+
+    /* Pump the queued moderation commands while there are any */
+    mCommandTimer->setInterval(COMMAND_PUMP_INTERVAL);
+    connect(mCommandTimer, SIGNAL(timeout()), this, SLOT(commandTimer()));
+
+    /* Connect the tcp socket signals to corresponding methods */
+    connect(mSocket, SIGNAL(connected()),                         this, SLOT(connected()));
+    connect(mSocket, SIGNAL(disconnected()),                      this, SLOT(disconnected()));
+    connect(mSocket, SIGNAL(error(QAbstractSocket::SocketError)), this, SLOT(error(QAbstractSocket::SocketError)));
+    connect(mSocket, SIGNAL(readyRead()),                         this, SLOT(readyRead()));
+}
+
+/**
+ * /brief ~TwitchConnector definition
+ */
+TwitchConnector::~TwitchConnector()
+{
+    /* Delete the further accounts and the standby connection first, their last state changes must not reach this half destroyed connector */
+    foreach (AccountConnection* account, mAccounts)
+    {
+        account->disconnect(this);
+        delete account;
+    }
+    mAccounts.clear();
+    SetStandby(false);
+
+    /* Check for null pointer and delete elements */
+    if (mSocket != nullptr)
+    {
+        mSocket->disconnectFromHost();
+        delete mSocket;
+    }
+    if (mCyclicTimer != nullptr)
+    {
+        delete mCyclicTimer;
+    }
+    if (mSeenTimer != nullptr)
+    {
+        delete mSeenTimer;
+    }
+    if (mCommandTimer != nullptr)
+    {
+        delete mCommandTimer;
+    }
+    if (mRecorder != nullptr)
+    {
+        delete mRecorder;
+    }
+    if (mTrafficLog != nullptr)
+    {
+        delete mTrafficLog;
+    }
+    if (mBanListLoader != nullptr)
+    {
+        delete mBanListLoader;
+    }
+    if (mBanList != nullptr)
+    {
+        delete mBanList;
+    }
+}
+
+/**
+ * /brief connected definition
+ */
+void TwitchConnector::connected()
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("TwitchConnector::connected");
+
+    /* Create pass and nick strings */
+    QString pass = "PASS " + mLoginPass + "\r\n";
+    QString nick = "NICK " + mLoginName + "\r\n";
+
+    /* Write pass and nick to tcp socket (the pass is intentionally not recorded) */
+    mSocket->write(pass.toLocal8Bit());
+    sendData(nick.toLocal8Bit());
+
+    /* Request the JOIN and PART messages of the other users and the tagged answers to the moderation commands */
+    sendData("CAP REQ :twitch.tv/membership twitch.tv/tags twitch.tv/commands\r\n");
+}
+
+/**
+ * /brief disconnected definition
+ */
+void TwitchConnector::disconnected()
+{
+    /* An unexpected loss of the connection is taken over by the standby connection */
+    if ( mState == CONNECTED && !mDisconnectRequested && failOver() )
+    {
+        return;
+    }
+
+    /* Set the internal state to disconnected */
+    setState(DISCONNECTED);
+}
+
+/**
+ * /brief failOver definition
+ */
+bool TwitchConnector::failOver()
+{
+    if ( mStandby == nullptr || mStandby->GetState() != CONNECTED )
+    {
+        return false;
+    }
+
+    /* Take over the authenticated socket of the standby connection */
+    QTcpSocket* socket = mStandby->TakeSocket(&mReadBuffer);
+    socket->setParent(this);
+
+    /* The lost socket is deleted once its signal has been handled */
+    mSocket->disconnect(this);
+    mSocket->deleteLater();
+    mSocket = socket;
+
+    connect(mSocket, SIGNAL(connected()),                         this, SLOT(connected()));
+    connect(mSocket, SIGNAL(disconnected()),                      this, SLOT(disconnected()));
+    connect(mSocket, SIGNAL(error(QAbstractSocket::SocketError)), this, SLOT(error(QAbstractSocket::SocketError)));
+    connect(mSocket, SIGNAL(readyRead()),                         this, SLOT(readyRead()));
+
+    /* The channels are joined again, their moderation commands continue right away */
+    QSet<QString> lostChannels = mConnectedChannels;
+    foreach (const QString& channel, lostChannels)
+    {
+        emit channelParted(channel);
+    }
+
+    /* Still connected as the same account, so the state and the moderator status are kept, only the joins start from scratch */
+    mConnectedChannels.clear();
+    mPresenceIndex.Clear();
+    mFailoverChannels = lostChannels & mChannels;
+
+    /* The answers of the lost connection will never arrive */
+    mCommandQueue.Requeue();
+
+    /* The standby connection didn't request the JOIN and PART messages of the other users, so request them before the joins */
+    QByteArray joins = "CAP REQ :twitch.tv/membership twitch.tv/tags twitch.tv/commands\r\n";
+    foreach (const QString& channel, mChannels)
+    {
+        joins.append("JOIN #" + channel.toUtf8() + "\r\n");
+    }
+    sendData(joins);
+
+    pumpCommands();
+
+    /* Notify about the fail over */
+    emit failedOver(mFailoverChannels.count());
+
+    /* Build a new standby connection in the background */
+    mStandby->Connect();
+
+    /* Handle the data the standby connection hasn't read yet */
+    if ( mSocket->bytesAvailable() > 0 )
+    {
+        readyRead();
+    }
+
+    return true;
+}
+
+/**
+ * /brief error definition
+ */
+void TwitchConnector::error(QAbstractSocket::SocketError error)
+{
+    /* In case of error disconnect from host */
+    mSocket->disconnectFromHost();
+}
+
+/**
+ * /brief readyRead definition
+ */
+void TwitchConnector::readyRead()
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("TwitchConnector::readyRead");
+
+    /* Trace the socket read */
+    TRACE_SPAN("TwitchConnector::readyRead");
+
+    /* Read all available data */
+    QByteArray data = mSocket->readAll();
+
+    /* Tee the raw data into the session recording */
+    mRecorder->Record(RECORD_INBOUND, data);
+    mTrafficLog->Append(RECORD_INBOUND, data);
+
+    /* Delegate the data to the parser */
+    ProcessData(data);
+}
+
+/**
+ * /brief ProcessData definition
+ */
+void TwitchConnector::ProcessData(const QByteArray& data)
+{
+    /* Trace the line framing */
+    TRACE_SPAN("TwitchConnector::ProcessData");
+
+    /* Append the data to the incomplete line of the last read (shares the data if nothing is pending) */
+    mReadBuffer.append(data);
+
+    const char* buffer = mReadBuffer.constData();
+    int length = mReadBuffer.size();
+    int start = 0;
+
+    /* Iterate over all complete lines received */
+    const char* lineEnd = (const char*)memchr(buffer, '\n', length);
+    while (lineEnd != nullptr)
+    {
+        int end = (int)(lineEnd - buffer);
+
+        /* Tokenize the line without copying it and handle it */
+        IrcMessage message;
+        if ( message.Parse(buffer + start, end - start) )
+        {
+            processMessage(message);
+        }
+
+        start = end + 1;
+        lineEnd = (const char*)memchr(buffer + start, '\n', length - start);
+    }
+
+    /* Keep only the incomplete line for the next read */
+    if (start >= length)
+    {
+        mReadBuffer.clear();
+    }
+    else if (start > 0)
+    {
+        mReadBuffer = mReadBuffer.mid(start);
+    }
+}
+
+/**
+ * /brief processMessage definition
+ */
+void TwitchConnector::processMessage(const IrcMessage& message)
+{
+    /* Trace the dispatch of a message */
+    TRACE_SPAN("TwitchConnector::processMessage");
+
+    QLatin1String command = message.Command();
+
+    /* Chat messages are by far the most frequent ones, so check them first */
+    if ( command == QLatin1String("PRIVMSG") )
+    {
+        processChatMessage(message);
+    }
+    /* Successful connection message */
+    else if ( command == QLatin1String("001") )
+    {
+        /* Set the internal state to connected */
+        setState(CONNECTED);
+
+        /* Start the ping/pong timer and the timer of the seen users */
+        mCyclicTimer->start();
+        mSeenTimer->start();
+
+        /* Iterate over all channels that shall be connected */
+        foreach (const QString& channel, mChannels)
+        {
+            /* Create a join string */
+            QString join = "JOIN #" + channel + "\r\n";
+
+            /* Write join string to tcp socket */
+            sendData(join.toLocal8Bit());
+        }
+    }
+    /* Oauth failed or connect failed message */
+    else if ( command == QLatin1String("NOTICE") &&
+              message.Param(0) == QLatin1String("*") &&
+              ( message.Trailing() == QLatin1String("Improperly formatted auth") ||
+                message.Trailing() == QLatin1String("Login authentication failed") ) )
+    {
+        /* Notify about the rejected credentials, trying again with them won't help */
+        emit loginFailed(QString(message.Trailing()));
+
+        /* Set the internal state to disconnected and close the socket */
+        setState(DISCONNECTED);
+        mSocket->disconnectFromHost();
+    }
+    /* Notice of a channel, e.g. the answer to a moderation command */
+    else if ( command == QLatin1String("NOTICE") &&
+              message.Param(0).size() > 1 && message.Param(0).data()[0] == '#' )
+    {
+        QueuedCommand answered;
+        CommandResult result = mCommandQueue.Answer(message.Channel(0), message.Tag(QLatin1String("msg-id")), mClock.elapsed(), &answered);
+
+        /* Commands are not permitted in the channel, so don't send any more */
+        if ( message.Tag(QLatin1String("msg-id")) == QLatin1String("no_permission") )
+        {
+            setModerator(QString(message.Channel(0)), false);
+        }
+
+        /* Keep track of the confirmed bans */
+        if ( result == COMMAND_ACKNOWLEDGED )
+        {
+            trackBan(answered.command, answered.userName, answered.channel);
+            emit commandAcknowledged(answered.command, answered.userName, answered.channel);
+        }
+        /* Sending the command again won't help (unless another account is a moderator of the channel) */
+        else if ( result == COMMAND_REJECTED )
+        {
+            failCommand(answered, QString::fromUtf8(message.Trailing().data(), message.Trailing().size()));
+        }
+    }
+    /* Our badges in a channel, sent after the join and after every message we send */
+    else if ( command == QLatin1String("USERSTATE") )
+    {
+        QLatin1String badges = message.Tag(QLatin1String("badges"));
+        const QByteArray badgeList = QByteArray::fromRawData(badges.data(), badges.size());
+
+        /* The broadcaster is no moderator by the mod tag, but may ban as well */
+        bool moderator = ( message.Tag(QLatin1String("mod")) == QLatin1String("1") ||
+                           badgeList.contains("moderator/") ||
+                           badgeList.contains("broadcaster/") );
+
+        setModerator(QString(message.Channel(0)), moderator);
+    }
+    /* Ban of a user by any moderator (a timeout has a duration, clearing the whole chat has no user) */
+    else if ( command == QLatin1String("CLEARCHAT") )
+    {
+        if ( message.ParamCount() >= 2 && message.Tag(QLatin1String("ban-duration")).size() == 0 )
+        {
+            mBanState.Add(QString(message.Trailing()), QString(message.Channel(0)));
+        }
+    }
+    /* Join of a user */
+    else if ( command == QLatin1String("JOIN") )
+    {
+        QLatin1String nick = message.Nick();
+
+        /* Our own join is confirmed by the end of the user list */
+        if ( 0 != mLoginName.compare(nick, Qt::CaseInsensitive) )
+        {
+            mPresenceIndex.Join(message.Channel(0), nick);
+            checkUser(nick, message.Channel(0));
+
+            /* Run the join through the raid detection */
+            QStringList raidUsers;
+            int joins = 0;
+            double baseline = 0.0;
+            if ( mRaidDetector.Add(message.Channel(0), nick, mClock.elapsed(), &raidUsers, &joins, &baseline) )
+            {
+                emit raidDetected(QString(message.Channel(0)), raidUsers, joins, baseline);
+            }
+        }
+    }
+    /* List of names of a channel (large channels are split into several messages) */
+    else if ( command == QLatin1String("353") )
+    {
+        /* Stream all names into the index and check them without copying them */
+        QLatin1String channel = message.Channel(2);
+        QLatin1String names = message.Trailing();
+        const char* name = names.data();
+        const char* end = names.data() + names.size();
+        while (name < end)
+        {
+            const char* space = (const char*)memchr(name, ' ', end - name);
+            if (space == nullptr)
+            {
+                space = end;
+            }
+            if (space > name)
+            {
+                mPresenceIndex.Join(channel, QLatin1String(name, (int)(space - name)));
+                checkUser(QLatin1String(name, (int)(space - name)), channel);
+            }
+            name = space + 1;
+        }
+    }
+    /* Channel connected message (end of the list of names) */
+    else if ( command == QLatin1String("366") )
+    {
+        /* Channel name is the second parameter: <nick> #<channel> :End of /NAMES list */
+        QString channelName = message.Channel(1);
+
+        /* Targeted bans may rely on the members of the channel from now on */
+        mPresenceIndex.Complete(message.Channel(1));
+
+        /* If the channel shall be connected and hasn't been confirmed yet */
+        if ( mChannels.contains(channelName) && !mConnectedChannels.contains(channelName) )
+        {
+            /* Keep track of the connected channels */
+            mConnectedChannels.insert(channelName);
+            mFailoverChannels.remove(channelName);
+
+            /* Notify about the joined channel */
+            emit channelJoined(channelName);
+
+            /* Send the commands which waited for the channel (e.g. after a reconnect) */
+            pumpCommands();
+        }
+    }
+    /* Channel disconnect message */
+    else if ( command == QLatin1String("PART") )
+    {
+        /* Only our own part disconnects the channel (the others are membership messages) */
+        if ( 0 != mLoginName.compare(message.Nick(), Qt::CaseInsensitive) )
+        {
+            mPresenceIndex.Part(message.Channel(0), message.Nick());
+            return;
+        }
+
+        QString channelName = message.Channel(0);
+
+        /* The join statistics, the members and the moderator status start over with the next join */
+        mRaidDetector.Remove(channelName);
+        mPresenceIndex.RemoveChannel(channelName);
+        mModerator.remove(channelName);
+
+        /* If the channel has been connected */
+        if ( mConnectedChannels.remove(channelName) )
+        {
+            /* Notify about the parted channel */
+            emit channelParted(channelName);
+        }
+    }
+    /* Keepalive of the twitch service */
+    else if ( command == QLatin1String("PING") )
+    {
+        /* Answer with the same argument */
+        sendData("PONG :" + QByteArray(message.Trailing().data(), message.Trailing().size()) + "\r\n");
+    }
+}
+
+/**
+ * /brief processChatMessage definition
+ */
+void TwitchConnector::processChatMessage(const IrcMessage& message)
+{
+    QLatin1String text = message.Trailing();
+    QLatin1String nick = message.Nick();
+
+    /* Never act on our own messages */
+    if ( 0 == mLoginName.compare(nick, Qt::CaseInsensitive) )
+    {
+        return;
+    }
+
+    /* Check the chatter against the banlist */
+    checkUser(nick, message.Channel(0));
+
+    /* Keep the message as evidence for a later ban and index it for the search */
+    qint64 now = QDateTime::currentMSecsSinceEpoch();
+    mMessageHistory.Record(nick, message.Channel(0), text.data(), text.size(), now);
+    mChatIndex.Add(nick, message.Channel(0), text.data(), text.size(), now);
+
+    qint64 timestamp = mClock.elapsed();
+
+    /* Count the message of the user */
+    int shortCount = 0;
+    int longCount = 0;
+    if ( mRateTracker.Record(nick, timestamp, &shortCount, &longCount) )
+    {
+        emit rateExceeded(QString(nick), QString(message.Channel(0)), shortCount, longCount, QString::fromUtf8(text.data(), text.size()));
+    }
+
+    /* Run the message through the spam wave detection */
+    QStringList waveUsers;
+    QSet<QString> waveChannels;
+    if ( mSpamWaveDetector.Add(nick, message.Channel(0), text.data(), text.size(), timestamp, &waveUsers, &waveChannels) )
+    {
+        QString waveMessage = QString::fromUtf8(text.data(), text.size());
+        foreach (const QString& waveUser, waveUsers)
+        {
+            emit spamWaveDetected(waveUser, waveChannels, waveMessage);
+        }
+    }
+
+    /* Run the message through the keyword matcher */
+    int term = mKeywordMatcher.Match(text.data(), text.size());
+    if (term < 0)
+    {
+        return;
+    }
+
+    QString userName = QString(nick);
+
+    /* Notify about the hit */
+    emit keywordMatched(QString(message.Channel(0)), userName, mKeywordMatcher.Term(term), QString::fromUtf8(text.data(), text.size()));
+
+    /* Ban the user automatically */
+    if (mAutoBan)
+    {
+        autoBanUser(userName);
+    }
+}
+
+/**
+ * /brief seenTimer definition
+ */
+void TwitchConnector::seenTimer()
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("TwitchConnector::seenTimer");
+
+    if ( mSeenUsers.isEmpty() )
+    {
+        return;
+    }
+
+    /* Trace the completion index update */
+    TRACE_SPAN("TwitchConnector::seenTimer");
+
+    /* Add the users seen within the last second to the completion index */
+    foreach (const QByteArray& user, mSeenUsers)
+    {
+        mUsernameIndex.Add(QString::fromUtf8(user), false);
+    }
+    mSeenUsers.clear();
+}
+
+/**
+ * /brief CompleteUsername definition
+ */
+QStringList TwitchConnector::CompleteUsername(QString prefix, int count)
+{
+    QStringList names = mUsernameIndex.Complete(prefix, count);
+
+    /* Report the names to the ui thread as well */
+    emit usernameCompleted(prefix, names);
+
+    return names;
+}
+
+/**
+ * /brief checkUser definition
+ */
+void TwitchConnector::checkUser(QLatin1String userName, QLatin1String channel)
+{
+    /* Collect the user for the username completion (copied only the first time within a second) */
+    if ( !mSeenUsers.contains(QByteArray::fromRawData(userName.data(), userName.size())) )
+    {
+        mSeenUsers.insert(QByteArray(userName.data(), userName.size()));
+    }
+
+    /* Check the name against the banlist and the username patterns */
+    bool banListed = ( mBanList != nullptr && mBanList->Contains(userName) );
+    int pattern = banListed ? -1 : mUsernameMatcher.Match(userName.data(), userName.size());
+    if ( !banListed && pattern < 0 )
+    {
+        return;
+    }
+
+    /* Report every user only once (keep the memory bounded during long sessions) */
+    QString name = QString(userName);
+    if ( mReportedUsers.contains(name) )
+    {
+        return;
+    }
+    if (mReportedUsers.count() >= AUTO_BAN_MEMORY)
+    {
+        mReportedUsers.clear();
+    }
+    mReportedUsers.insert(name);
+
+    /* Notify about the hit */
+    if (banListed)
+    {
+        emit banListMatched(name, QString(channel));
+    }
+    else
+    {
+        emit usernamePatternMatched(name, QString(channel), mUsernameMatcher.Pattern(pattern));
+    }
+
+    /* Ban the user automatically */
+    if (mAutoBan)
+    {
+        autoBanUser(name);
+    }
+}
+
+/**
+ * /brief autoBanUser definition
+ */
+void TwitchConnector::autoBanUser(const QString& userName)
+{
+    /* Ban every user only once, but answer every match, so the ui drops the reason kept for it */
+    if ( mAutoBannedUsers.contains(userName) )
+    {
+        emit userBanned(userName, QSet<QString>(), QStringList(), 0);
+        return;
+    }
+
+    /* Keep the memory bounded during long sessions */
+    if (mAutoBannedUsers.count() >= AUTO_BAN_MEMORY)
+    {
+        mAutoBannedUsers.clear();
+    }
+    mAutoBannedUsers.insert(userName);
+
+    banUser(userName);
+}
+
+/**
+ * /brief SetKeywords definition
+ */
+void TwitchConnector::SetKeywords(QStringList terms)
+{
+    /* Compile all terms into a single automaton */
+    mKeywordMatcher.Compile(terms);
+}
+
+/**
+ * /brief SetAutoBan definition
+ */
+void TwitchConnector::SetAutoBan(bool autoBan)
+{
+    /* Save the setting internally */
+    mAutoBan = autoBan;
+}
+
+/**
+ * /brief SetSpamWaveThreshold definition
+ */
+void TwitchConnector::SetSpamWaveThreshold(int minChannels, int window)
+{
+    /* The detector works with milliseconds */
+    mSpamWaveDetector.SetThreshold(minChannels, (qint64)window * 1000);
+}
+
+/**
+ * /brief SetRateLimits definition
+ */
+void TwitchConnector::SetRateLimits(int shortLimit, int longLimit)
+{
+    /* Delegate to the rate tracker */
+    mRateTracker.SetLimits(shortLimit, longLimit);
+}
+
+/**
+ * /brief SetRaidThreshold definition
+ */
+void TwitchConnector::SetRaidThreshold(int factor, int minJoins)
+{
+    /* Delegate to the raid detector */
+    mRaidDetector.SetThreshold(factor, minJoins);
+}
+
+/**
+ * /brief SetTargetedBan definition
+ */
+void TwitchConnector::SetTargetedBan(bool targetedBan)
+{
+    mTargetedBan = targetedBan;
+}
+
+/**
+ * /brief GetUserChannels definition
+ */
+QSet<QString> TwitchConnector::GetUserChannels(QString userName)
+{
+    /* Only the connected channels are of interest */
+    return mPresenceIndex.Channels(userName) & mConnectedChannels;
+}
+
+/**
+ * /brief GetTopUsers definition
+ */
+QList<RateTrackerUser> TwitchConnector::GetTopUsers(int count)
+{
+    /* Delegate to the rate tracker */
+    return mRateTracker.TopUsers(count, mClock.elapsed());
+}
+
+/**
+ * /brief SearchChat definition
+ */
+QList<ChatIndexHit> TwitchConnector::SearchChat(QString userName, QString terms, int minutes)
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("TwitchConnector::SearchChat");
+
+    /* Search the indexed messages of the last minutes */
+    qint64 since = QDateTime::currentMSecsSinceEpoch() - (qint64)minutes * 60 * 1000;
+    QList<ChatIndexHit> hits = mChatIndex.Search(userName, terms, since);
+
+    /* Notify about the result */
+    emit chatSearched(userName, terms, hits);
+
+    return hits;
+}
+
+/**
+ * /brief SetBanList definition
+ */
+void TwitchConnector::SetBanList(QString fileName, double falsePositiveRate, qint64 maxBytes)
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("TwitchConnector::SetBanList");
+
+    /* Users are reported again for the new banlist */
+    mReportedUsers.clear();
+
+    /* Stop watching the old file */
+    if ( mFileWatcher != nullptr && !mBanListFile.isEmpty() )
+    {
+        mFileWatcher->removePath(mBanListFile);
+    }
+
+    mBanListFile = fileName;
+    mBanListRate = falsePositiveRate;
+    mBanListBytes = maxBytes;
+
+    if ( fileName.isEmpty() )
+    {
+        delete mBanList;
+        mBanList = nullptr;
+        return;
+    }
+
+    /* Create the loader on first use (as child, so it follows the connector to its thread) */
+    if (mBanListLoader == nullptr)
+    {
+        mBanListLoader = new BanListLoader(this);
+        connect(mBanListLoader, SIGNAL(finished()), this, SLOT(banListLoaderFinished()));
+    }
+
+    /* Reload the banlist whenever the file changes */
+    watchFile(fileName);
+
+    /* Load the banlist in the background */
+    loadBanList();
+}
+
+/**
+ * /brief SetUsernamePatterns definition
+ */
+void TwitchConnector::SetUsernamePatterns(QString fileName)
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("TwitchConnector::SetUsernamePatterns");
+
+    /* Users are reported again for the new patterns */
+    mReportedUsers.clear();
+
+    /* Stop watching the old file */
+    if ( mFileWatcher != nullptr && !mUsernamePatternFile.isEmpty() )
+    {
+        mFileWatcher->removePath(mUsernamePatternFile);
+    }
+
+    mUsernamePatternFile = fileName;
+
+    if ( fileName.isEmpty() )
+    {
+        mUsernameMatcher.Compile(QStringList(), nullptr);
+        return;
+    }
+
+    /* Recompile the patterns whenever the file changes */
+    watchFile(fileName);
+    loadUsernamePatterns();
+}
+
+/**
+ * /brief GetBanListMetrics definition
+ */
+BanListMetrics TwitchConnector::GetBanListMetrics()
+{
+    BanListMetrics metrics;
+    memset(&metrics, 0, sizeof(metrics));
+
+    if (mBanList != nullptr)
+    {
+        metrics = mBanList->Metrics();
+    }
+
+    /* Report the metrics to the ui thread as well */
+    emit banListMetricsReported(metrics);
+
+    return metrics;
+}
+
+/**
+ * /brief watchFile definition
+ */
+void TwitchConnector::watchFile(const QString& path)
+{
+    /* Create the watcher on first use (as child, so it follows the connector to its thread) */
+    if (mFileWatcher == nullptr)
+    {
+        mFileWatcher = new QFileSystemWatcher(this);
+        connect(mFileWatcher, SIGNAL(fileChanged(QString)), this, SLOT(watchedFileChanged(QString)));
+    }
+
+    /* A replaced file (e.g. written by the banlist builder) is dropped by the watcher */
+    if ( !mFileWatcher->files().contains(path) )
+    {
+        mFileWatcher->addPath(path);
+    }
+}
+
+/**
+ * /brief watchedFileChanged definition
+ */
+void TwitchConnector::watchedFileChanged(const QString& path)
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("TwitchConnector::watchedFileChanged");
+
+    /* Keep watching a replaced file */
+    watchFile(path);
+
+    if ( path == mBanListFile )
+    {
+        loadBanList();
+    }
+    if ( path == mUsernamePatternFile )
+    {
+        loadUsernamePatterns();
+    }
+}
+
+/**
+ * /brief loadBanList definition
+ */
+void TwitchConnector::loadBanList()
+{
+    /* Only one load at a time, a change during the load triggers another one */
+    if ( mBanListLoader->isRunning() )
+    {
+        mBanListReload = true;
+        return;
+    }
+
+    mBanListLoader->Load(mBanListFile, mBanListRate, mBanListBytes);
+}
+
+/**
+ * /brief loadUsernamePatterns definition
+ */
+void TwitchConnector::loadUsernamePatterns()
+{
+    QFile file(mUsernamePatternFile);
+    if ( !file.open(QIODevice::ReadOnly) )
+    {
+        emit usernamePatternsLoaded(mUsernamePatternFile, -1, "Failed to open file");
+        return;
+    }
+
+    /* One pattern per line, # starts a comment */
+    QStringList patterns;
+    while ( !file.atEnd() )
+    {
+        QString line = QString::fromUtf8(file.readLine()).trimmed();
+        if ( !line.isEmpty() && !line.startsWith('#') )
+        {
+            patterns << line;
+        }
+    }
+
+    /* Keep the patterns in use if the new ones are broken */
+    QString errorString;
+    if ( !mUsernameMatcher.Compile(patterns, &errorString) )
+    {
+        emit usernamePatternsLoaded(mUsernamePatternFile, -1, errorString);
+        return;
+    }
+
+    emit usernamePatternsLoaded(mUsernamePatternFile, patterns.count(), QString());
+}
+
+/**
+ * /brief banListLoaderFinished definition
+ */
+void TwitchConnector::banListLoaderFinished()
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("TwitchConnector::banListLoaderFinished");
+
+    BanList* banList = mBanListLoader->TakeBanList();
+
+    /* Load again if the file has changed in the meantime */
+    if (mBanListReload)
+    {
+        mBanListReload = false;
+        delete banList;
+        mBanListLoader->Load(mBanListFile, mBanListRate, mBanListBytes);
+        return;
+    }
+
+    /* The banlist has been disabled in the meantime */
+    if ( mBanListFile.isEmpty() )
+    {
+        delete banList;
+        return;
+    }
+
+    if (banList == nullptr)
+    {
+        /* Keep the banlist in use if the new file is broken */
+        emit banListLoaded(mBanListFile, -1, 0, 1.0);
+        return;
+    }
+
+    /* Swap in the new banlist, lookups only happen on this thread */
+    delete mBanList;
+    mBanList = banList;
+
+    BanListMetrics metrics = mBanList->Metrics();
+    emit banListLoaded(mBanListFile, (int)metrics.count, metrics.filterBytes, metrics.filterRate);
+}
+
+/**
+ * /brief pingTimer definition
+ */
+void TwitchConnector::pingTimer()
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("TwitchConnector::pingTimer");
+
+    /* Check if the socket is available and the twitch service is connected */
+    if ( mState  == CONNECTED &&
+         mSocket != nullptr )
+    {
+        /* Create ping string */
+        QString ping = "PING\r\n";
+
+        /* write ping string to tcp socket */
+        sendData(ping.toLocal8Bit());
+    }
+}
+
+/**
+ * /brief SetChannels definition
+ */
+void TwitchConnector::SetChannels(QSet<QString> channels)
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("TwitchConnector::SetChannels");
+
+    /* Keep the old channels to calculate the difference */
+    QSet<QString> oldChannels = mChannels;
+
+    /* Save the new channels internally */
+    mChannels = channels;
+
+    /* Give up the queued commands of the removed channels */
+    mFailoverChannels &= channels;
+    foreach (const QString& channel, oldChannels - channels)
+    {
+        foreach (const QueuedCommand& removed, mCommandQueue.RemoveChannel(channel))
+        {
+            giveUpCommand(removed.command, removed.userName, removed.channel, "channel removed");
+        }
+    }
+
+    /* The further accounts send commands to the same channels */
+    foreach (AccountConnection* account, mAccounts)
+    {
+        account->SetChannels(channels);
+    }
+
+    /* Check if socket is available and if twitch service is connected */
+    if (mSocket == nullptr || mState != CONNECTED)
+    {
+        return;
+    }
+
+    /* Part all channels that shall not be connected anymore */
+    foreach (const QString& channel, oldChannels - channels)
+    {
+        /* Create disconnect string */
+        QString disconnectString = "PART #" + channel + "\r\n";
+
+        /* Write disconnect string to tcp socket */
+        sendData(disconnectString.toLocal8Bit());
+    }
+
+    /* Join all channels that shall be connected additionally */
+    foreach (const QString& channel, channels - oldChannels)
+    {
+        /* Create connect string */
+        QString connectString = "JOIN #" + channel + "\r\n";
+
+        /* Write connect string to tcp socket */
+        sendData(connectString.toLocal8Bit());
+    }
+}
+
+/**
+ * /brief GetConnectedChannels definition
+ */
+QSet<QString> TwitchConnector::GetConnectedChannels()
+{
+    /* Return the channels confirmed by the twitch service */
+    return mConnectedChannels;
+}
+
+/**
+ * /brief GetUnmoderatedChannels definition
+ */
+QSet<QString> TwitchConnector::GetUnmoderatedChannels()
+{
+    /* Return the connected channels where twitch reported no moderator badge */
+    return mConnectedChannels - moderationChannels();
+}
+
+/**
+ * /brief setModerator definition
+ */
+void TwitchConnector::setModerator(const QString& channel, bool moderator)
+{
+    /* Only changes are of interest (USERSTATE is repeated after every message) */
+    QHash<QString, bool>::const_iterator entry = mModerator.constFind(channel);
+    if ( entry != mModerator.constEnd() && entry.value() == moderator )
+    {
+        return;
+    }
+    mModerator.insert(channel, moderator);
+
+    /* The queued commands of the channel would only burn rate limit budget */
+    if ( !moderator )
+    {
+        foreach (const QueuedCommand& removed, mCommandQueue.RemoveChannel(channel))
+        {
+            failCommand(removed, "not a moderator");
+        }
+    }
+
+    /* Notify about the moderator status */
+    emit moderatorChanged(channel, moderator);
+}
+
+/**
+ * /brief moderationChannels definition
+ */
+QSet<QString> TwitchConnector::moderationChannels() const
+{
+    QSet<QString> channels = mConnectedChannels;
+
+    /* Channels without a reported status are kept (e.g. a service without USERSTATE) */
+    for (QHash<QString, bool>::const_iterator entry = mModerator.constBegin(); entry != mModerator.constEnd(); ++entry)
+    {
+        if ( !entry.value() )
+        {
+            channels.remove(entry.key());
+        }
+    }
+
+    return channels;
+}
+
+/**
+ * /brief mayModerate definition
+ */
+bool TwitchConnector::mayModerate(const QString& channel) const
+{
+    /* A channel without a reported status counts as moderated */
+    QHash<QString, bool>::const_iterator entry = mModerator.constFind(channel);
+    return ( entry == mModerator.constEnd() || entry.value() );
+}
+
+/**
+ * /brief routeCommands definition
+ */
+QSet<QString> TwitchConnector::routeCommands(const QSet<QString>& channels, const QString& command, const QString& userName)
+{
+    /* This connection (nullptr) keeps its commands while it reconnects, the further accounts only count while they are connected */
+    QList<AccountConnection*> accounts;
+    accounts.append(nullptr);
+    foreach (AccountConnection* account, mAccounts)
+    {
+        if (account->GetState() == CONNECTED)
+        {
+            accounts.append(account);
+        }
+    }
+
+    /* Number of queued commands and learned rate of every account */
+    QHash<AccountConnection*, double> backlog;
+    QHash<AccountConnection*, double> rate;
+    foreach (AccountConnection* account, accounts)
+    {
+        CommandQueueMetrics metrics = (account == nullptr) ? mCommandQueue.Metrics() : account->GetCommandQueueMetrics();
+        backlog.insert(account, metrics.pending + metrics.inFlight);
+        rate.insert(account, metrics.rate);
+    }
+
+    /* Every channel goes to the account which would have sent the command first, a confirmed moderator before an account whose status is unknown */
+    QHash<AccountConnection*, QSet<QString> > routed;
+    QSet<QString> unrouted;
+    foreach (const QString& channel, channels)
+    {
+        int best = -1;
+        bool bestKnown = false;
+        double bestDelay = 0.0;
+        for (int i=0; i<accounts.count(); i++)
+        {
+            AccountConnection* account = accounts.at(i);
+            if ( (account == nullptr) ? !mayModerate(channel) : !account->MayModerate(channel) )
+            {
+                continue;
+            }
+
+            bool known = (account == nullptr) ? mModerator.contains(channel) : account->IsModeratorKnown(channel);
+            double delay = ( backlog.value(account) + 1.0 ) / rate.value(account);
+            if ( best < 0 || ( known && !bestKnown ) || ( known == bestKnown && delay < bestDelay ) )
+            {
+                best = i;
+                bestKnown = known;
+                bestDelay = delay;
+            }
+        }
+
+        if (best < 0)
+        {
+            unrouted.insert(channel);
+            continue;
+        }
+
+        routed[accounts.at(best)].insert(channel);
+        backlog[accounts.at(best)] += 1.0;
+    }
+
+    /* Queue the commands, they are sent as fast as the learned rate of the account allows */
+    for (QHash<AccountConnection*, QSet<QString> >::const_iterator entry = routed.constBegin(); entry != routed.constEnd(); ++entry)
+    {
+        if (entry.key() == nullptr)
+        {
+            mCommandQueue.Add(entry.value(), command, userName);
+            pumpCommands();
+        }
+        else
+        {
+            entry.key()->AddCommands(entry.value(), command, userName);
+        }
+    }
+
+    return unrouted;
+}
+
+/**
+ * /brief rerouteCommand definition
+ */
+bool TwitchConnector::rerouteCommand(const QString& command, const QString& userName, const QString& channel)
+{
+    /* The commands of a removed channel are not sent anymore */
+    if ( !mChannels.contains(channel) )
+    {
+        return false;
+    }
+
+    QSet<QString> channels;
+    channels.insert(channel);
+
+    return routeCommands(channels, command, userName).isEmpty();
+}
+
+/**
+ * /brief failCommand definition
+ */
+void TwitchConnector::failCommand(const QueuedCommand& command, const QString& reason)
+{
+    /* Another account may be a moderator of the channel */
+    if ( !mayModerate(command.channel) && rerouteCommand(command.command, command.userName, command.channel) )
+    {
+        return;
+    }
+
+    giveUpCommand(command.command, command.userName, command.channel, reason);
+}
+
+/**
+ * /brief trackBan definition
+ */
+void TwitchConnector::trackBan(const QString& command, const QString& userName, const QString& channel)
+{
+    if ( command == ".ban" )
+    {
+        mBanState.Add(userName, channel);
+    }
+    else if ( command == ".unban" )
+    {
+        mBanState.Remove(userName, channel);
+    }
+}
+
+/**
+ * /brief giveUpCommand definition
+ */
+void TwitchConnector::giveUpCommand(const QString& command, const QString& userName, const QString& channel, const QString& reason)
+{
+    /* The ban has been forgotten when the unban was queued, but it is still in place */
+    if ( command == ".unban" )
+    {
+        mBanState.Add(userName, channel);
+    }
+
+    emit commandFailed(command, userName, channel, reason);
+}
+
+/**
+ * /brief AddAccount definition
+ */
+AccountConnection* TwitchConnector::AddAccount(QString loginName, QString oauth2)
+{
+    /* The account is a child, so it follows the connector to its thread */
+    AccountConnection* account = new AccountConnection(mConnectURL, mPort, loginName, oauth2, this);
+    account->SetChannels(mChannels);
+
+    /* The commands of the account are answered and given up by the account itself */
+    connect(account, SIGNAL(stateChanged(ConnectionState)), this, SLOT(accountStateChanged(ConnectionState)));
+    connect(account, SIGNAL(commandFailed(QString,QString,QString,QString)), this, SLOT(accountCommandFailed(QString,QString,QString,QString)));
+    connect(account, SIGNAL(commandAcknowledged(QString,QString,QString)), this, SLOT(accountCommandAcknowledged(QString,QString,QString)));
+
+    mAccounts.append(account);
+
+    /* Follow the connection of this connector */
+    if (mState != DISCONNECTED)
+    {
+        account->Connect();
+    }
+
+    return account;
+}
+
+/**
+ * /brief GetAccountMetrics definition
+ */
+QList<AccountMetrics> TwitchConnector::GetAccountMetrics()
+{
+    QList<AccountMetrics> metrics;
+
+    /* This connection first */
+    AccountMetrics ownMetrics;
+    ownMetrics.loginName = mLoginName;
+    ownMetrics.state = mState;
+    ownMetrics.queue = mCommandQueue.Metrics();
+    ownMetrics.unmoderated = 0;
+    foreach (bool moderator, mModerator)
+    {
+        if ( !moderator )
+        {
+            ownMetrics.unmoderated++;
+        }
+    }
+    metrics.append(ownMetrics);
+
+    foreach (AccountConnection* account, mAccounts)
+    {
+        AccountMetrics accountMetrics;
+        accountMetrics.loginName = account->GetLoginName();
+        accountMetrics.state = account->GetState();
+        accountMetrics.queue = account->GetCommandQueueMetrics();
+        accountMetrics.unmoderated = account->GetUnmoderatedCount();
+
+        metrics.append(accountMetrics);
+    }
+
+    return metrics;
+}
+
+/**
+ * /brief SetStandby definition
+ */
+void TwitchConnector::SetStandby(bool enabled)
+{
+    if ( enabled && mStandby == nullptr )
+    {
+        createStandby();
+
+        /* Follow the connection of this connector */
+        if (mState != DISCONNECTED)
+        {
+            mStandby->Connect();
+        }
+    }
+    else if ( !enabled && mStandby != nullptr )
+    {
+        mStandby->disconnect(this);
+        delete mStandby;
+        mStandby = nullptr;
+    }
+}
+
+/**
+ * /brief GetStandbyState definition
+ */
+ConnectionState TwitchConnector::GetStandbyState()
+{
+    return ( mStandby != nullptr ) ? mStandby->GetState() : DISCONNECTED;
+}
+
+/**
+ * /brief createStandby definition
+ */
+void TwitchConnector::createStandby()
+{
+    /* Same account as this connection, it joins no channel and is never routed a command */
+    mStandby = new AccountConnection(mConnectURL, mPort, mLoginName, mLoginPass, this);
+
+    /* A lost standby connection is connected again in the background */
+    connect(mStandby, SIGNAL(stateChanged(ConnectionState)), this, SLOT(accountStateChanged(ConnectionState)));
+}
+
+/**
+ * /brief accountStateChanged definition
+ */
+void TwitchConnector::accountStateChanged(ConnectionState state)
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("TwitchConnector::accountStateChanged");
+
+    AccountConnection* account = qobject_cast<AccountConnection*>(sender());
+    if ( account == nullptr || state != DISCONNECTED )
+    {
+        return;
+    }
+
+    /* Pass the commands of a lost account to the other accounts instead of waiting for its reconnect */
+    QList<QueuedCommand> commands = account->TakeCommands();
+    foreach (const QueuedCommand& command, commands)
+    {
+        if ( !rerouteCommand(command.command, command.userName, command.channel) )
+        {
+            giveUpCommand(command.command, command.userName, command.channel, "account disconnected");
+        }
+    }
+
+    /* Connect the account (or the standby connection) again in the background, rejected credentials won't get better */
+    if ( !account->IsLoginRejected() )
+    {
+        QTimer::singleShot(ACCOUNT_RECONNECT_DELAY, this, SLOT(reconnectAccounts()));
+    }
+}
+
+/**
+ * /brief accountCommandFailed definition
+ */
+void TwitchConnector::accountCommandFailed(QString command, QString userName, QString channel, QString reason)
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("TwitchConnector::accountCommandFailed");
+
+    /* An account which isn't a moderator of the channel passes the command to the other accounts */
+    AccountConnection* account = qobject_cast<AccountConnection*>(sender());
+    if ( account != nullptr && !account->MayModerate(channel) && rerouteCommand(command, userName, channel) )
+    {
+        return;
+    }
+
+    giveUpCommand(command, userName, channel, reason);
+}
+
+/**
+ * /brief accountCommandAcknowledged definition
+ */
+void TwitchConnector::accountCommandAcknowledged(QString command, QString userName, QString channel)
+{
+    /* The bans of all accounts are skipped by the next fan-out */
+    trackBan(command, userName, channel);
+
+    emit commandAcknowledged(command, userName, channel);
+}
+
+/**
+ * /brief reconnectAccounts definition
+ */
+void TwitchConnector::reconnectAccounts()
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("TwitchConnector::reconnectAccounts");
+
+    /* The accounts stay disconnected while this connector is disconnected */
+    if (mState == DISCONNECTED)
+    {
+        return;
+    }
+
+    foreach (AccountConnection* account, mAccounts)
+    {
+        if ( account->GetState() == DISCONNECTED && !account->IsLoginRejected() )
+        {
+            account->Connect();
+        }
+    }
+
+    if ( mStandby != nullptr && mStandby->GetState() == DISCONNECTED && !mStandby->IsLoginRejected() )
+    {
+        mStandby->Connect();
+    }
+}
+
+/**
+ * /brief setState definition
+ */
+void TwitchConnector::setState(ConnectionState state)
+{
+    /* Only changes are of interest (e.g. the socket closed after a failed login) */
+    if (mState == state)
+    {
+        return;
+    }
+
+    /* Set internal state */
+    mState = state;
+
+    /* Connected channels, their members and the moderator status are tracked from scratch for every connection */
+    mConnectedChannels.clear();
+    mPresenceIndex.Clear();
+    mModerator.clear();
+
+    /* The commands waiting for an answer are sent again by the next connection */
+    if (state != CONNECTED)
+    {
+        mFailoverChannels.clear();
+        mCommandQueue.Requeue();
+        mCommandTimer->stop();
+    }
+
+    /* Stop the ping/pong cyclic timer and the timer of the seen users if the connection is lost */
+    if (state == DISCONNECTED)
+    {
+        mCyclicTimer->stop();
+        mSeenTimer->stop();
+        mSeenUsers.clear();
+    }
+
+    /* Notify about the new state */
+    emit stateChanged(state);
+}
+
+/**
+ * /brief banUser definition
+ */
+QSet<QString> TwitchConnector::banUser(QString userName, int* skipped)
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("TwitchConnector::banUser");
+
+    /* Trace the ban fan-out */
+    TRACE_SPAN("TwitchConnector::banUser");
+
+    /* Check if the socket and twitch service is available (the request is answered anyway, so the ui drops the reason kept for it) */
+    if (mSocket == nullptr || mState != CONNECTED)
+    {
+        if (skipped != nullptr)
+        {
+            *skipped = 0;
+        }
+        emit userBanned(userName, QSet<QString>(), QStringList(), 0);
+        return QSet<QString>();
+    }
+
+    /* Banned users are always completed */
+    mUsernameIndex.Add(userName, true);
+
+    /* In targeted mode only the channels the user is present in (and the channels without a complete index) are banned */
+    QSet<QString> channels = mConnectedChannels + mFailoverChannels;
+    if (mTargetedBan)
+    {
+        QSet<QString> present = mPresenceIndex.Channels(userName);
+        if ( !present.isEmpty() )
+        {
+            foreach (const QString& channel, mConnectedChannels)
+            {
+                if ( !present.contains(channel) && mPresenceIndex.IsIndexed(channel) )
+                {
+                    channels.remove(channel);
+                }
+            }
+        }
+    }
+
+    /* Skip the channels where the ban is already in place (saves rate limit budget during repeated raids) */
+    int skippedChannels = 0;
+    QSet<QString> banned = mBanState.Channels(userName);
+    if ( !banned.isEmpty() )
+    {
+        int count = channels.count();
+        channels -= banned;
+        skippedChannels = count - channels.count();
+    }
+    if (skipped != nullptr)
+    {
+        *skipped = skippedChannels;
+    }
+
+    /* Spread the ban commands across the accounts, the channels no account may moderate are left out */
+    channels -= routeCommands(channels, ".ban", userName);
+
+    /* Notify about the queued ban together with the recent messages of the user */
+    emit userBanned(userName, channels, mMessageHistory.Snapshot(userName), skippedChannels);
+
+    /* Return set of channels where the ban has been queued */
+    return channels;
+}
+
+/**
+ * /brief unbanUser definition
+ */
+QSet<QString> TwitchConnector::unbanUser(QString userName, int* skipped)
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("TwitchConnector::unbanUser");
+
+    /* Check if the socket and twitch service is available */
+    if (mSocket == nullptr || mState != CONNECTED)
+    {
+        return QSet<QString>();
+    }
+
+    /* Only the channels where a ban is known need an unban */
+    QSet<QString> connectedChannels = mConnectedChannels + mFailoverChannels;
+    QSet<QString> channels = connectedChannels & mBanState.Channels(userName);
+    int skippedChannels = connectedChannels.count() - channels.count();
+    if (skipped != nullptr)
+    {
+        *skipped = skippedChannels;
+    }
+
+    /* Spread the unban commands across the accounts, the channels no account may moderate are left out */
+    channels -= routeCommands(channels, ".unban", userName);
+
+    /* Forget the bans right away, so a ban right after the unban isn't skipped */
+    foreach (const QString& channel, channels)
+    {
+        mBanState.Remove(userName, channel);
+    }
+
+    /* Notify about the queued unban */
+    emit userUnbanned(userName, channels, skippedChannels);
+
+    /* Return set of channels where the unban has been queued */
+    return channels;
+}
+
+/**
+ * /brief AddKnownBans definition
+ */
+void TwitchConnector::AddKnownBans(QString userName, QSet<QString> channels)
+{
+    /* Delegate to the ban state */
+    mBanState.Add(userName, channels);
+
+    /* Banned users are always completed */
+    mUsernameIndex.Add(userName, true);
+}
+
+/**
+ * /brief sendData definition
+ */
+void TwitchConnector::sendData(const QByteArray& data)
+{
+    /* Nothing can be sent without a connection (e.g. while replaying a session) */
+    if (mSocket->state() != QAbstractSocket::ConnectedState)
+    {
+        return;
+    }
+
+    /* Write the data to tcp socket */
+    mSocket->write(data);
+
+    /* Tee the raw data into the session recording */
+    mRecorder->Record(RECORD_OUTBOUND, data);
+    mTrafficLog->Append(RECORD_OUTBOUND, data);
+}
+
+/**
+ * /brief pumpCommands definition
+ */
+void TwitchConnector::pumpCommands()
+{
+    /* The queue is kept until the next connection */
+    if (mState != CONNECTED)
+    {
+        mCommandTimer->stop();
+        return;
+    }
+
+    /* Write the commands the rate allows with a single write to tcp socket */
+    QList<QueuedCommand> failed;
+    QSet<QString> channels = mConnectedChannels;
+
+    /* After a fail over the channels of the lost connection are served before their join is confirmed */
+    if ( !mFailoverChannels.isEmpty() )
+    {
+        channels += mFailoverChannels;
+    }
+
+    QByteArray commands = mCommandQueue.Take(mClock.elapsed(), channels, &failed);
+    if ( !commands.isEmpty() )
+    {
+        sendData(commands);
+    }
+
+    foreach (const QueuedCommand& command, failed)
+    {
+        failCommand(command, "no answer");
+    }
+
+    /* Keep pumping only while there are pending or unanswered commands */
+    if ( mCommandQueue.IsEmpty() )
+    {
+        mCommandTimer->stop();
+    }
+    else if ( !mCommandTimer->isActive() )
+    {
+        mCommandTimer->start();
+    }
+}
+
+/**
+ * /brief commandTimer definition
+ */
+void TwitchConnector::commandTimer()
+{
+    /* Mark the handler for the stall attribution */
+    STALL_SCOPE("TwitchConnector::commandTimer");
+
+    pumpCommands();
+}
+
+/**
+ * /brief GetCommandQueueMetrics definition
+ */
+CommandQueueMetrics TwitchConnector::GetCommandQueueMetrics()
+{
+    /* Delegate to the command queue */
+    return mCommandQueue.Metrics();
+}
+
+/**
+ * /brief StartRecording definition
+ */
+bool TwitchConnector::StartRecording(const QString& fileName)
+{
+    /* Delegate to the session recorder */
+    return mRecorder->Start(fileName);
+}
+
+/**
+ * /brief StopRecording definition
+ */
+void TwitchConnector::StopRecording()
+{
+    /* Delegate to the session recorder */
+    mRecorder->Stop();
+}
+
+/**
+ * /brief StartTrafficLog definition
+ */
+bool TwitchConnector::StartTrafficLog(const QString& baseName, qint64 maxBytes, int interval, bool compress)
+{
+    /* Delegate to the traffic log */
+    return mTrafficLog->Start(baseName, maxBytes, interval, compress);
+}
+
+/**
+ * /brief StopTrafficLog definition
+ */
+void TwitchConnector::StopTrafficLog()
+{
+    /* Delegate to the traffic log */
+    mTrafficLog->Stop();
+}
+
+/**
+ * /brief GetTrafficLogMetrics definition
+ */
+TrafficLogMetrics TwitchConnector::GetTrafficLogMetrics()
+{
+    /* Delegate to the traffic log */
+    return mTrafficLog->Metrics();
+}
+
+/**
+ * /brief Connect definition
+ */
+void TwitchConnector::Connect()
+{
+    /* Set the internal state to connecting */
+    mDisconnectRequested = false;
+    setState(CONNECTING);
+
+    /* Connect to twitch service*/
+    mSocket->connectToHost( mConnectURL, mPort );
+
+    /* Connect the further accounts as well */
+    foreach (AccountConnection* account, mAccounts)
+    {
+        if (account->GetState() == DISCONNECTED)
+        {
+            account->Connect();
+        }
+    }
+
+    /* Connect the standby connection with the current credentials */
+    if ( mStandby != nullptr && mStandby->GetState() == DISCONNECTED )
+    {
+        mStandby->SetCredentials(mLoginName, mLoginPass);
+        mStandby->Connect();
+    }
+}
+
+/**
+ * /brief Disconnect definition
+ */
+void TwitchConnector::Disconnect()
+{
+    /* Disconnect from twitch service (without fail over) */
+    mDisconnectRequested = true;
+    mSocket->disconnectFromHost();
+
+    /* Disconnect the standby connection and the further accounts as well */
+    if (mStandby != nullptr)
+    {
+        mStandby->Disconnect();
+    }
+    foreach (AccountConnection* account, mAccounts)
+    {
+        account->Disconnect();
+    }
+}
+
+/**
+ * /brief GetConnectionState definition
+ */
+ConnectionState TwitchConnector::GetConnectionState()
+{
+    /* Return the internal twitch service connection state */
+    return mState;
+}
+
+/**
+ * /brief SetLoginName definition
+ */
+void TwitchConnector::SetLoginName(QString loginName)
+{
+    /* Save the new login name internally */
+    mLoginName = loginName;
+}
+
+/**
+ * /brief SetOauth2 definition
+ */
+void TwitchConnector::SetOauth2(QString oauth2)
+{
+    /* Save the new login pass internally */
+    mLoginPass = oauth2;
+}
+
+
@@ -1,202 +1,766 @@
-/****************************************************************************
- * Copyright (C) 2018 by Sebastian Ziganki                                  *
- *                                                                          *
- * This file is part of Lpz3ncLittleHelper.                                 *
- *                                                                          *
- *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
- *   modify it under the terms of the GNU Lesser General Public License as  *
- *   published by the Free Software Foundation, either version 3 of the     *
- *   License.                                                               *
- *                                                                          *
- *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
- *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
- *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
- *   GNU Lesser General Public License for more details.                    *
- *                                                                          *
- *   You should have received a copy of the GNU Lesser General Public       *
- *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
- ****************************************************************************/
-
-/**
- * /file    twitchconnector.h
- * /author  Hackspider
- * /brief   Header file of the twitch connector
- */
-
-/* Include Guard */
-#ifndef TWITCHCONNECTOR_H
-#define TWITCHCONNECTOR_H
-
-/* Necessary dependencies to Qt framework */
-#include <QObject>
-#include <QTcpSocket>
-#include <QTimer>
-#include <QStandardItemModel>
-#include <QSet>
-#include <QLabel>
-#include <QPushButton>
-
-/* Type to distinguish the twitch connection state */
-typedef enum
-{
-    DISCONNECTED = 0,
-    CONNECTING,
-    CONNECTED,
-} ConnectionState;
-
-
-/**
- * /brief  The TwitchConnector class declaraation. Derived from QObject class.
- */
-class TwitchConnector : public QObject
-{
-    Q_OBJECT
-public:
-    /**
-     * /brief  Constructor of the TwitchConnector class
-     * /param  connectURL      Url to twitch service to connect to
-     * /param  port            Port of the twitch service to connect to
-     * /param  loginName       Username to connect to twitch
-     * /param  loginPass       OAuth2 token for authentication
-     * /param  channelModel    Pointer to the channel model
-     * /param  connectionIcon  Pointer to the icon label
-     * /param  connectButton   Pointer to the connect button
-     * /param  parent          Parent of the TwitchConnector object according to Qt's object tree
-     */
-    explicit TwitchConnector( QString connectURL,
-                              quint16 port,
-                              QString loginName,
-                              QString loginPass,
-                              QStandardItemModel* channelModel,
-                              QLabel* connectionIcon,
-                              QPushButton* connectButton,
-                              QObject *parent = nullptr);
-
-    /**
-     * /brief  Destructor of the TwitchConnector class
-     */
-    virtual ~TwitchConnector(void);
-
-public slots:
-    /**
-     * /brief   Method to ban a user in all connected channels
-     * /param   userName  Name of the user that shall be banned on connected channels
-     * /return  Returns a set of channels which the user has been banned
-     */
-    QSet<QString> banUser(QString userName);
-
-    /**
-     * /brief   Method to unban a user in all connected channels
-     * /param   userName  Name of the user that shall be unbanned on connected channels
-     * /return  Returns a set of channels which the user has unbeen banned
-     */
-    QSet<QString> unbanUser(QString userName);
-
-    /**
-     * /brief  Method to connect to the twitch service
-     */
-    void Connect(void);
-
-    /**
-     * /brief  Method to disconnect from twitch service
-     */
-    void Disconnect(void);
-
-    /**
-     * /brief   Method to get the internal connection state to twitch service
-     * /return  Return the internal connection state to twitch service
-     */
-    ConnectionState GetConnectionState(void);
-
-    /**
-     * /brief  Method to change the login name
-     * /param  loginName  New login name
-     */
-    void SetLoginName(QString loginName);
-
-    /**
-     * /brief  Method to change the oauth2
-     * /param  oauth2  New oauth2
-     */
-    void SetOauth2(QString oauth2);
-
-private slots:
-    /**
-     * /brief  Method will be called if the tcp socket established a connection to twitch service
-     */
-    void connected(void);
-
-    /**
-     * /brief  Method will be called if the tcp socket is disconnected ffrom twitch service
-     */
-    void disconnected(void);
-
-    /**
-     * /brief  Method will be called if the tcp socket raises an error
-     * /param  error  Contains information which kind of an error occured
-     */
-    void error(QAbstractSocket::SocketError error);
-
-    /**
-     * /brief  Method will be called if the tcp socket receives data
-     */
-    void readyRead(void);
-
-    /**
-     * /brief  Mthod will be called cyclic if the twitch service is connected to prevent disconnect by PING?PONG
-     */
-    void pingTimer(void);
-
-    /**
-     * /brief  Method will be called if an channel item chanes (e.g. by chaning the check box)
-     * /param  item  Pointer to the item that changes
-     */
-    void channelModelItemChanged(QStandardItem* item);
-
-    /**
-     * /brief  Method will be called if a row of the channel model changes (e.g. add/remove a channel)
-     * /param  parent  Reference to the model index
-     * /param  start   Start row number of the changed rows
-     * /param  end     End row number of the changed rows
-     */
-    void channelRowsChanged(const QModelIndex & parent, int start, int end);
-
-    /**
-     * /brief  Internally used method to iterate over all channels and update the connection to the changed channels
-     */
-    void updateChannels(void);
-
-    /**
-     * /brief  Internally used method to set internal connection state and lock/unlock ui elements
-     */
-    void connectingUI(void);
-
-    /**
-     * /brief  Internally used method to set internal connection state and lock/unlock ui elements
-     */
-    void connectUI(void);
-
-    /**
-     * /brief  Internally used method to set internal connection state and lock/unlock ui elements
-     */
-    void disconnectUI(void);
-
-
-private:
-    /**
-     * /brief Internal used variables
-     */
-    QTcpSocket* mSocket;
-    QString mConnectURL;
-    quint16 mPort;
-    QTimer* mCyclicTimer;
-    ConnectionState mState;
-    QString mLoginName;
-    QString mLoginPass;
-    QStandardItemModel* mChannelModel;
-    QSet<QString> mConnectedChannels;
-    QLabel* mConnectionIcon;
-    QPushButton* mConnectionButton;
-};
-
-#endif // TWITCHCONNECTOR_H
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    twitchconnector.h
+ * /author  Hackspider
+ * /brief   Header file of the twitch connector
+ */
+
+/* Include Guard */
+#ifndef TWITCHCONNECTOR_H
+#define TWITCHCONNECTOR_H
+
+/* Necessary dependencies to Qt framework */
+#include <QObject>
+#include <QTcpSocket>
+#include <QTimer>
+#include <QSet>
+#include <QMetaType>
+#include <QStringList>
+#include <QElapsedTimer>
+#include <QFileSystemWatcher>
+
+/* Necessary internal dependencies */
+#include "sessionrecorder.h"
+#include "trafficlog.h"
+#include "tracer.h"
+#include "stallwatchdog.h"
+#include "commandqueue.h"
+#include "banstate.h"
+#include "ircmessage.h"
+#include "keywordmatcher.h"
+#include "spamwavedetector.h"
+#include "ratetracker.h"
+#include "raiddetector.h"
+#include "presenceindex.h"
+#include "messagehistory.h"
+#include "chatindex.h"
+#include "banlist.h"
+#include "usernamematcher.h"
+#include "usernameindex.h"
+#include "accountconnection.h"
+
+/* Type of the state of an account moderation commands are routed to */
+typedef struct
+{
+    QString loginName;
+    ConnectionState state;
+    CommandQueueMetrics queue;
+    int unmoderated;
+} AccountMetrics;
+
+
+/**
+ * /brief  The TwitchConnector class declaraation. Derived from QObject class.
+ *
+ * The connector only depends on QtCore and QtNetwork. It reports its state
+ * and the joined channels by signals, so it can be used by the ui as well as
+ * by the headless daemon. The socket, the timer and the recorder are children
+ * of the connector, so the whole connector can be moved to its own thread and
+ * be driven by queued signals.
+ */
+class TwitchConnector : public QObject
+{
+    Q_OBJECT
+public:
+    /**
+     * /brief  Constructor of the TwitchConnector class
+     * /param  connectURL      Url to twitch service to connect to
+     * /param  port            Port of the twitch service to connect to
+     * /param  loginName       Username to connect to twitch
+     * /param  loginPass       OAuth2 token for authentication
+     * /param  parent          Parent of the TwitchConnector object according to Qt's object tree
+     */
+    explicit TwitchConnector( QString connectURL,
+                              quint16 port,
+                              QString loginName,
+                              QString loginPass,
+                              QObject *parent = nullptr);
+
+    /**
+     * /brief  Destructor of the TwitchConnector class
+     */
+    virtual ~TwitchConnector(void);
+
+public slots:
+    /**
+     * /brief   Method to ban a user in all connected channels (or the channels the user is present in if the targeted ban is enabled) where the user isn't known to be banned
+     * /param   userName  Name of the user that shall be banned on connected channels
+     * /param   skipped   Returns the number of channels skipped because the user is already banned there (may be nullptr)
+     * /return  Returns a set of channels the ban has been queued for (sent again until acknowledged)
+     */
+    QSet<QString> banUser(QString userName, int* skipped = nullptr);
+
+    /**
+     * /brief   Method to unban a user in all connected channels where the user is known to be banned
+     * /param   userName  Name of the user that shall be unbanned on connected channels
+     * /param   skipped   Returns the number of connected channels skipped because no ban is known there (may be nullptr)
+     * /return  Returns a set of channels the unban has been queued for (sent again until acknowledged)
+     */
+    QSet<QString> unbanUser(QString userName, int* skipped = nullptr);
+
+    /**
+     * /brief  Method to add known bans of a user (e.g. from the ban history), the ban fan-out skips these channels
+     * /param  userName  Name of the user
+     * /param  channels  Set of channels the user is banned in
+     */
+    void AddKnownBans(QString userName, QSet<QString> channels);
+
+    /**
+     * /brief   Method to add a further account with its own connection and rate limit budget. The account joins no channel,
+     *          it only sends the moderation commands routed to it. It follows Connect/Disconnect and SetChannels of this connector.
+     * /param   loginName  Username of the account
+     * /param   oauth2     OAuth2 token of the account
+     * /return  Returns the connection of the account, it is owned by this connector
+     */
+    AccountConnection* AddAccount(QString loginName, QString oauth2);
+
+    /**
+     * /brief   Method to get the state of all accounts moderation commands are routed to
+     * /return  Returns the state of this connection first and of the further accounts in the order they have been added
+     */
+    QList<AccountMetrics> GetAccountMetrics(void);
+
+    /**
+     * /brief  Method to enable the warm standby connection: a second connection of the same account which joins no channel and
+     *         only answers the keepalive. If the connection is lost unexpectedly, its socket takes over at once and a new standby
+     *         connection is built in the background.
+     * /param  enabled  True to keep a standby connection
+     */
+    void SetStandby(bool enabled);
+
+    /**
+     * /brief   Method to get the state of the standby connection
+     * /return  Returns the connection state, DISCONNECTED if the standby connection is disabled
+     */
+    ConnectionState GetStandbyState(void);
+
+    /**
+     * /brief  Method to parse raw data as received from the twitch service (used by readyRead and benchmarks)
+     * /param  data  Raw data containing one or more lines of the twitch service
+     */
+    void ProcessData(const QByteArray& data);
+
+    /**
+     * /brief   Method to start the recording of the raw traffic into a session file
+     * /param   fileName  Name of the session file
+     * /return  Returns true if the recording has been started
+     */
+    bool StartRecording(const QString& fileName);
+
+    /**
+     * /brief  Method to stop the recording of the raw traffic
+     */
+    void StopRecording(void);
+
+    /**
+     * /brief   Method to get the counters of the queue of moderation commands
+     * /return  Returns the counters
+     */
+    CommandQueueMetrics GetCommandQueueMetrics(void);
+
+    /**
+     * /brief   Method to start the audit log of the raw traffic into rotating files (written by a background thread)
+     * /param   baseName  Path and base name of the log files
+     * /param   maxBytes  Size of a log file in bytes before the next file is started (0 for no limit)
+     * /param   interval  Age of a log file in seconds before the next file is started (0 for no limit)
+     * /param   compress  True to compress the log files with qCompress
+     * /return  Returns true if the log has been started
+     */
+    bool StartTrafficLog(const QString& baseName, qint64 maxBytes = TRAFFIC_LOG_DEFAULT_MAX_BYTES, int interval = TRAFFIC_LOG_DEFAULT_INTERVAL, bool compress = false);
+
+    /**
+     * /brief  Method to stop the audit log of the raw traffic
+     */
+    void StopTrafficLog(void);
+
+    /**
+     * /brief   Method to get the counters of the audit log of the raw traffic
+     * /return  Returns the number of written and dropped records and bytes and the number of files
+     */
+    TrafficLogMetrics GetTrafficLogMetrics(void);
+
+    /**
+     * /brief  Method to connect to the twitch service
+     */
+    void Connect(void);
+
+    /**
+     * /brief  Method to disconnect from twitch service
+     */
+    void Disconnect(void);
+
+    /**
+     * /brief   Method to get the internal connection state to twitch service
+     * /return  Return the internal connection state to twitch service
+     */
+    ConnectionState GetConnectionState(void);
+
+    /**
+     * /brief  Method to change the login name
+     * /param  loginName  New login name
+     */
+    void SetLoginName(QString loginName);
+
+    /**
+     * /brief  Method to change the oauth2
+     * /param  oauth2  New oauth2
+     */
+    void SetOauth2(QString oauth2);
+
+    /**
+     * /brief  Method to set the channels that shall be joined, the difference to the current channels is joined/parted immediately
+     * /param  channels  Set of channel names
+     */
+    void SetChannels(QSet<QString> channels);
+
+    /**
+     * /brief   Method to get the channels where the join has been confirmed by the twitch service
+     * /return  Returns the set of connected channels
+     */
+    QSet<QString> GetConnectedChannels(void);
+
+    /**
+     * /brief   Method to get the connected channels where we aren't a moderator (moderation commands are not sent there)
+     * /return  Returns the set of channels
+     */
+    QSet<QString> GetUnmoderatedChannels(void);
+
+    /**
+     * /brief  Method to set the terms every chat message is checked against
+     * /param  terms  List of terms, an empty list disables the check
+     */
+    void SetKeywords(QStringList terms);
+
+    /**
+     * /brief  Method to enable the automatic ban of users whose messages match a term
+     * /param  autoBan  True to ban automatically, false to only report the hits
+     */
+    void SetAutoBan(bool autoBan);
+
+    /**
+     * /brief  Method to enable the targeted ban: a user is only banned in the channels it is present in
+     * /param  targetedBan  True to ban in the channels of the user, false to ban in all connected channels
+     */
+    void SetTargetedBan(bool targetedBan);
+
+    /**
+     * /brief   Method to get the connected channels a user is currently present in
+     * /param   userName  Name of the user
+     * /return  Returns the channels of the user (empty if the user hasn't been seen)
+     */
+    QSet<QString> GetUserChannels(QString userName);
+
+    /**
+     * /brief  Method to set the threshold of the spam wave detection
+     * /param  minChannels  Number of channels a message must be seen in (less than 2 disables the detection)
+     * /param  window       Time window in seconds
+     */
+    void SetSpamWaveThreshold(int minChannels, int window);
+
+    /**
+     * /brief  Method to set the message rate limits of a single user across all channels
+     * /param  shortLimit  Maximum number of messages within 5 seconds (0 disables the limit)
+     * /param  longLimit   Maximum number of messages within 60 seconds (0 disables the limit)
+     */
+    void SetRateLimits(int shortLimit, int longLimit);
+
+    /**
+     * /brief  Method to set the threshold of the raid detection
+     * /param  factor    Factor of the usual number of joins per 30 seconds a raid must exceed (0 disables the detection)
+     * /param  minJoins  Minimum number of joins per 30 seconds of a raid
+     */
+    void SetRaidThreshold(int factor, int minJoins);
+
+    /**
+     * /brief   Method to get the users with the most messages across all channels within the last minute
+     * /param   count  Maximum number of users
+     * /return  Returns the users sorted by the number of messages (most first)
+     */
+    QList<RateTrackerUser> GetTopUsers(int count);
+
+    /**
+     * /brief   Method to search the chat messages of the connected channels
+     * /param   userName  Author of the messages, empty for all authors
+     * /param   terms     Words which all have to occur in a message, empty for all messages
+     * /param   minutes   Number of minutes to search back (up to 30 minutes are indexed)
+     * /return  Returns the found messages, the newest first
+     */
+    QList<ChatIndexHit> SearchChat(QString userName, QString terms, int minutes = CHAT_INDEX_PARTITIONS - 1);
+
+    /**
+     * /brief   Method to complete a username from the users seen in the joined channels (chatting, joining or in a user list) and the banned users
+     * /param   prefix  Prefix of the names (case insensitive)
+     * /param   count   Maximum number of names
+     * /return  Returns the matching names in alphabetical order, they are reported by usernameCompleted as well
+     */
+    QStringList CompleteUsername(QString prefix, int count);
+
+    /**
+     * /brief  Method to set the banlist file every chatter and joining user is checked against.
+     *         The file is mapped and filtered in the background and reloaded whenever it changes.
+     * /param  fileName           Name of the banlist file, an empty name disables the check
+     * /param  falsePositiveRate  Target false positive rate of the bloom filter in front of the banlist
+     * /param  maxBytes           Memory budget of the bloom filter in bytes
+     */
+    void SetBanList(QString fileName, double falsePositiveRate = BANLIST_DEFAULT_FILTER_RATE, qint64 maxBytes = BANLIST_DEFAULT_FILTER_BYTES);
+
+    /**
+     * /brief   Method to get the size of the banlist, of its filter and the lookup counters, they are reported by banListMetricsReported as well
+     * /return  Returns the metrics of the banlist in use
+     */
+    BanListMetrics GetBanListMetrics(void);
+
+    /**
+     * /brief  Method to set the file of username patterns every chatter and joining user is checked against.
+     *         The patterns are compiled into a single automaton and recompiled whenever the file changes.
+     * /param  fileName  Name of the pattern file (one pattern per line), an empty name disables the check
+     */
+    void SetUsernamePatterns(QString fileName);
+
+signals:
+    /**
+     * /brief  Signal emitted if the connection state to the twitch service changes
+     * /param  state  New connection state
+     */
+    void stateChanged(ConnectionState state);
+
+    /**
+     * /brief  Signal emitted if the twitch service rejected the login (followed by the state DISCONNECTED)
+     * /param  reason  Notice of the twitch service
+     */
+    void loginFailed(QString reason);
+
+    /**
+     * /brief  Signal emitted for every ban request (manual or automatic), every channel is confirmed by commandAcknowledged or commandFailed later
+     * /param  userName  Name of the banned user
+     * /param  channels  Set of channels where the ban has been queued (empty if nothing has been queued, e.g. while disconnected)
+     * /param  messages  Recent messages of the user as evidence (the oldest first)
+     * /param  skipped   Number of channels skipped because the user is already banned there
+     */
+    void userBanned(QString userName, QSet<QString> channels, QStringList messages, int skipped);
+
+    /**
+     * /brief  Signal emitted after an unban has been queued, every channel is confirmed by commandAcknowledged or commandFailed later
+     * /param  userName  Name of the unbanned user
+     * /param  channels  Set of channels where the unban has been queued
+     * /param  skipped   Number of connected channels skipped because no ban is known there
+     */
+    void userUnbanned(QString userName, QSet<QString> channels, int skipped);
+
+    /**
+     * /brief  Signal emitted if a queued moderation command has been given up
+     * /param  command   Moderation command (e.g. ".ban")
+     * /param  userName  Name of the user the command applies to
+     * /param  channel   Channel of the command
+     * /param  reason    Answer of the twitch service or the reason the command has been given up
+     */
+    void commandFailed(QString command, QString userName, QString channel, QString reason);
+
+    /**
+     * /brief  Signal emitted if the twitch service acknowledged a moderation command of this connection or of a further account
+     * /param  command   Moderation command (e.g. ".ban")
+     * /param  userName  Name of the user the command applies to
+     * /param  channel   Channel of the command
+     */
+    void commandAcknowledged(QString command, QString userName, QString channel);
+
+    /**
+     * /brief  Signal emitted if a chat message matches a term
+     * /param  channel   Channel of the message
+     * /param  userName  Author of the message
+     * /param  term      Matching term
+     * /param  message   Text of the message
+     */
+    void keywordMatched(QString channel, QString userName, QString term, QString message);
+
+    /**
+     * /brief  Signal emitted once per author if the same message is posted in several channels within a short time
+     * /param  userName  Author of the message
+     * /param  channels  Set of channels where the message has been posted
+     * /param  message   Text of the message
+     */
+    void spamWaveDetected(QString userName, QSet<QString> channels, QString message);
+
+    /**
+     * /brief  Signal emitted once if a user exceeds a message rate limit
+     * /param  userName    Name of the user
+     * /param  channel     Channel of the message that exceeded the limit
+     * /param  shortCount  Number of messages within 5 seconds
+     * /param  longCount   Number of messages within 60 seconds
+     * /param  message     Text of the message that exceeded the limit
+     */
+    void rateExceeded(QString userName, QString channel, int shortCount, int longCount, QString message);
+
+    /**
+     * /brief  Signal emitted if a burst of joins has been detected in a channel (at most once per second while the raid lasts)
+     * /param  channel   Channel of the raid
+     * /param  users     Joining users which haven't been reported yet
+     * /param  joins     Number of joins within the last 30 seconds
+     * /param  baseline  Usual number of joins within 30 seconds
+     */
+    void raidDetected(QString channel, QStringList users, int joins, double baseline);
+
+    /**
+     * /brief  Signal emitted with the result of a username completion
+     * /param  prefix  Completed prefix
+     * /param  names   Matching names in alphabetical order
+     */
+    void usernameCompleted(QString prefix, QStringList names);
+
+    /**
+     * /brief  Signal emitted with the result of a chat search
+     * /param  userName  Searched author
+     * /param  terms     Searched words
+     * /param  hits      Found messages, the newest first
+     */
+    void chatSearched(QString userName, QString terms, QList<ChatIndexHit> hits);
+
+    /**
+     * /brief  Signal emitted once per user if a chatter or a joining user is on the banlist
+     * /param  userName  Name of the user
+     * /param  channel   Channel where the user has been seen
+     */
+    void banListMatched(QString userName, QString channel);
+
+    /**
+     * /brief  Signal emitted if a banlist has been loaded and is in use
+     * /param  fileName           Name of the banlist file
+     * /param  count              Number of names of the banlist or -1 if the file couldn't be mapped
+     * /param  filterBytes        Memory used by the bloom filter in bytes
+     * /param  falsePositiveRate  Estimated false positive rate of the bloom filter
+     */
+    void banListLoaded(QString fileName, int count, qint64 filterBytes, double falsePositiveRate);
+
+    /**
+     * /brief  Signal emitted with the metrics of the banlist in use on request
+     * /param  metrics  Size of the banlist, of its filter and the lookup counters
+     */
+    void banListMetricsReported(BanListMetrics metrics);
+
+    /**
+     * /brief  Signal emitted once per user if a chatter or a joining user matches a username pattern
+     * /param  userName  Name of the user
+     * /param  channel   Channel where the user has been seen
+     * /param  pattern   Matching pattern
+     */
+    void usernamePatternMatched(QString userName, QString channel, QString pattern);
+
+    /**
+     * /brief  Signal emitted if the username patterns have been compiled
+     * /param  fileName     Name of the pattern file
+     * /param  count        Number of patterns or -1 if the patterns couldn't be compiled
+     * /param  errorString  Reason if the patterns couldn't be compiled
+     */
+    void usernamePatternsLoaded(QString fileName, int count, QString errorString);
+
+    /**
+     * /brief  Signal emitted if the twitch service confirmed the join of a channel
+     * /param  channel  Name of the channel
+     */
+    void channelJoined(QString channel);
+
+    /**
+     * /brief  Signal emitted if the twitch service confirmed the part of a channel
+     * /param  channel  Name of the channel
+     */
+    void channelParted(QString channel);
+
+    /**
+     * /brief  Signal emitted if our moderator status in a connected channel has been reported or has changed
+     * /param  channel    Name of the channel
+     * /param  moderator  True if moderation commands are permitted in the channel
+     */
+    void moderatorChanged(QString channel, bool moderator);
+
+    /**
+     * /brief  Signal emitted if the connection has been lost and the standby connection has taken over
+     * /param  channels  Number of channels whose moderation commands continue while they are joined again
+     */
+    void failedOver(int channels);
+
+private slots:
+    /**
+     * /brief  Method will be called if the tcp socket established a connection to twitch service
+     */
+    void connected(void);
+
+    /**
+     * /brief  Method will be called if the tcp socket is disconnected ffrom twitch service
+     */
+    void disconnected(void);
+
+    /**
+     * /brief  Method will be called if the tcp socket raises an error
+     * /param  error  Contains information which kind of an error occured
+     */
+    void error(QAbstractSocket::SocketError error);
+
+    /**
+     * /brief  Method will be called if the tcp socket receives data
+     */
+    void readyRead(void);
+
+    /**
+     * /brief  Mthod will be called cyclic if the twitch service is connected to prevent disconnect by PING?PONG
+     */
+    void pingTimer(void);
+
+    /**
+     * /brief  Method will be called cyclic to pass the recently seen users to the ui
+     */
+    void seenTimer(void);
+
+    /**
+     * /brief  Method will be called cyclic while moderation commands are queued
+     */
+    void commandTimer(void);
+
+    /**
+     * /brief  Method will be called if the banlist file or the pattern file has been changed
+     * /param  path  Path of the changed file
+     */
+    void watchedFileChanged(const QString& path);
+
+    /**
+     * /brief  Method will be called if the background load of the banlist has finished
+     */
+    void banListLoaderFinished(void);
+
+    /**
+     * /brief  Method will be called if the connection state of a further account changes
+     * /param  state  New connection state of the account
+     */
+    void accountStateChanged(ConnectionState state);
+
+    /**
+     * /brief  Method will be called if a further account gave up a moderation command
+     * /param  command   Moderation command (e.g. ".ban")
+     * /param  userName  Name of the user the command applies to
+     * /param  channel   Channel of the command
+     * /param  reason    Reason the command has been given up
+     */
+    void accountCommandFailed(QString command, QString userName, QString channel, QString reason);
+
+    /**
+     * /brief  Method will be called if the twitch service acknowledged a moderation command of a further account
+     * /param  command   Moderation command (e.g. ".ban")
+     * /param  userName  Name of the user the command applies to
+     * /param  channel   Channel of the command
+     */
+    void accountCommandAcknowledged(QString command, QString userName, QString channel);
+
+    /**
+     * /brief  Method will be called some time after a further account or the standby connection lost its connection
+     */
+    void reconnectAccounts(void);
+
+private:
+    /**
+     * /brief  Internally used method to set the internal connection state and to notify about the change
+     * /param  state  New connection state
+     */
+    void setState(ConnectionState state);
+
+    /**
+     * /brief  Internally used method to handle a single tokenized line of the twitch service
+     * /param  message  Tokenized line
+     */
+    void processMessage(const IrcMessage& message);
+
+    /**
+     * /brief  Internally used method to handle a chat message (PRIVMSG)
+     * /param  message  Tokenized chat message
+     */
+    void processChatMessage(const IrcMessage& message);
+
+    /**
+     * /brief  Internally used method to write data to the tcp socket and the session recording
+     * /param  data  Raw data to be sent
+     */
+    void sendData(const QByteArray& data);
+
+    /**
+     * /brief  Internally used method to send the queued moderation commands the rate allows
+     */
+    void pumpCommands(void);
+
+    /**
+     * /brief  Internally used method to set our moderator status in a channel
+     * /param  channel    Name of the channel
+     * /param  moderator  True if moderation commands are permitted in the channel
+     */
+    void setModerator(const QString& channel, bool moderator);
+
+    /**
+     * /brief   Internally used method to get the connected channels moderation commands are sent to
+     * /return  Returns the connected channels without the channels where we aren't a moderator (an unknown status counts as moderator)
+     */
+    QSet<QString> moderationChannels(void) const;
+
+    /**
+     * /brief   Internally used method to check if moderation commands may be sent to a channel
+     * /param   channel  Name of the channel
+     * /return  Returns false if twitch reported that we aren't a moderator of the channel
+     */
+    bool mayModerate(const QString& channel) const;
+
+    /**
+     * /brief   Internally used method to queue a moderation command at the accounts: every channel is routed to the
+     *          connected account which may moderate it and will have sent its queued commands first
+     * /param   channels  Set of channels the command shall be sent to
+     * /param   command   Moderation command (e.g. ".ban")
+     * /param   userName  Name of the user the command applies to
+     * /return  Returns the channels no account may moderate (the command is not queued there)
+     */
+    QSet<QString> routeCommands(const QSet<QString>& channels, const QString& command, const QString& userName);
+
+    /**
+     * /brief   Internally used method to route a command of a channel again (e.g. after an account turned out to be no moderator)
+     * /param   command   Moderation command (e.g. ".ban")
+     * /param   userName  Name of the user the command applies to
+     * /param   channel   Channel of the command
+     * /return  Returns true if another account has taken the command
+     */
+    bool rerouteCommand(const QString& command, const QString& userName, const QString& channel);
+
+    /**
+     * /brief  Internally used method to give up a queued command of this connection (unless another account may send it)
+     * /param  command  Queued command
+     * /param  reason   Reason the command has been given up
+     */
+    void failCommand(const QueuedCommand& command, const QString& reason);
+
+    /**
+     * /brief  Internally used method to keep track of the confirmed bans and unbans
+     * /param  command   Acknowledged moderation command (e.g. ".ban")
+     * /param  userName  Name of the user the command applies to
+     * /param  channel   Channel of the command
+     */
+    void trackBan(const QString& command, const QString& userName, const QString& channel);
+
+    /**
+     * /brief  Internally used method to report a moderation command which won't be sent anymore, the ban of a failed unban is known again
+     * /param  command   Moderation command (e.g. ".ban")
+     * /param  userName  Name of the user the command applies to
+     * /param  channel   Channel of the command
+     * /param  reason    Answer of the twitch service or the reason the command has been given up
+     */
+    void giveUpCommand(const QString& command, const QString& userName, const QString& channel, const QString& reason);
+
+    /**
+     * /brief   Internally used method to continue on the socket of the standby connection after the connection has been lost
+     * /return  Returns false if there is no connected standby connection
+     */
+    bool failOver(void);
+
+    /**
+     * /brief  Internally used method to create the standby connection with the current credentials
+     */
+    void createStandby(void);
+
+    /**
+     * /brief  Internally used method to check a user against the banlist and the username patterns and to collect it as seen
+     * /param  userName  Name of the user
+     * /param  channel   Channel where the user has been seen
+     */
+    void checkUser(QLatin1String userName, QLatin1String channel);
+
+    /**
+     * /brief  Internally used method to watch a file for changes
+     * /param  path  Path of the file
+     */
+    void watchFile(const QString& path);
+
+    /**
+     * /brief  Internally used method to start loading the banlist in the background
+     */
+    void loadBanList(void);
+
+    /**
+     * /brief  Internally used method to read and compile the username patterns
+     */
+    void loadUsernamePatterns(void);
+
+    /**
+     * /brief  Internally used method to ban a user automatically (only once per user)
+     * /param  userName  Name of the user
+     */
+    void autoBanUser(const QString& userName);
+
+    /**
+     * /brief Internal used variables
+     */
+    QTcpSocket* mSocket;
+    QString mConnectURL;
+    quint16 mPort;
+    QTimer* mCyclicTimer;
+    QTimer* mSeenTimer;
+    QTimer* mCommandTimer;
+    SessionRecorder* mRecorder;
+    TrafficLog* mTrafficLog;
+    ConnectionState mState;
+    QString mLoginName;
+    QString mLoginPass;
+    QSet<QString> mChannels;
+    QSet<QString> mConnectedChannels;
+    QHash<QString, bool> mModerator;
+    QByteArray mReadBuffer;
+    KeywordMatcher mKeywordMatcher;
+    bool mAutoBan;
+    bool mTargetedBan;
+    QSet<QString> mAutoBannedUsers;
+    SpamWaveDetector mSpamWaveDetector;
+    RateTracker mRateTracker;
+    RaidDetector mRaidDetector;
+    PresenceIndex mPresenceIndex;
+    MessageHistory mMessageHistory;
+    ChatIndex mChatIndex;
+    CommandQueue mCommandQueue;
+    BanState mBanState;
+    QList<AccountConnection*> mAccounts;
+    AccountConnection* mStandby;
+    bool mDisconnectRequested;
+    QSet<QString> mFailoverChannels;
+    BanList* mBanList;
+    BanListLoader* mBanListLoader;
+    QFileSystemWatcher* mFileWatcher;
+    QString mBanListFile;
+    double mBanListRate;
+    qint64 mBanListBytes;
+    bool mBanListReload;
+    QSet<QString> mReportedUsers;
+    QSet<QByteArray> mSeenUsers;
+    UsernameIndex mUsernameIndex;
+    UsernameMatcher mUsernameMatcher;
+    QString mUsernamePatternFile;
+    QElapsedTimer mClock;
+};
+
+/* Make the connection state usable by queued connections */
+Q_DECLARE_METATYPE(ConnectionState)
+
+/* Make the chat search result usable by queued connections */
+Q_DECLARE_METATYPE(ChatIndexHit)
+
+/* Make the banlist metrics usable by queued connections */
+Q_DECLARE_METATYPE(BanListMetrics)
+
+#endif // TWITCHCONNECTOR_H
@@ -0,0 +1,59 @@
+#-------------------------------------------------
+#
+# GUI-free core of the twitch connection (QtCore and QtNetwork only)
+#
+# Included by the GUI application, the headless daemon, the tools and the
+# benchmarks.
+#
+#-------------------------------------------------
+
+QT       += core network
+
+# Compile the trace spans in (they cost a single atomic load while tracing is disabled)
+DEFINES += LPZ_TRACE
+
+INCLUDEPATH += $$PWD
+
+SOURCES += \
+    $$PWD/twitchconnector.cpp \
+    $$PWD/accountconnection.cpp \
+    $$PWD/sessionrecorder.cpp \
+    $$PWD/trafficlog.cpp \
+    $$PWD/tracer.cpp \
+    $$PWD/stallwatchdog.cpp \
+    $$PWD/ircmessage.cpp \
+    $$PWD/keywordmatcher.cpp \
+    $$PWD/spamwavedetector.cpp \
+    $$PWD/ratetracker.cpp \
+    $$PWD/raiddetector.cpp \
+    $$PWD/presenceindex.cpp \
+    $$PWD/usernameindex.cpp \
+    $$PWD/messagehistory.cpp \
+    $$PWD/chatindex.cpp \
+    $$PWD/commandqueue.cpp \
+    $$PWD/banstate.cpp \
+    $$PWD/banlist.cpp \
+    $$PWD/bloomfilter.cpp \
+    $$PWD/usernamematcher.cpp
+
+HEADERS += \
+    $$PWD/twitchconnector.h \
+    $$PWD/accountconnection.h \
+    $$PWD/sessionrecorder.h \
+    $$PWD/trafficlog.h \
+    $$PWD/tracer.h \
+    $$PWD/stallwatchdog.h \
+    $$PWD/ircmessage.h \
+    $$PWD/keywordmatcher.h \
+    $$PWD/spamwavedetector.h \
+    $$PWD/ratetracker.h \
+    $$PWD/raiddetector.h \
+    $$PWD/presenceindex.h \
+    $$PWD/usernameindex.h \
+    $$PWD/messagehistory.h \
+    $$PWD/chatindex.h \
+    $$PWD/commandqueue.h \
+    $$PWD/banstate.h \
+    $$PWD/banlist.h \
+    $$PWD/bloomfilter.h \
+    $$PWD/usernamematcher.h
@@ -0,0 +1,248 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    usernameindex.cpp
+ * /author  Hackspider
+ * /brief   Source file of the prefix index of recently seen usernames
+ */
+
+/* Necessary dependencies to the standard library */
+#include <string.h>
+#include <algorithm>
+
+/* Necessary internal dependencies */
+#include "usernameindex.h"
+
+/**
+ * /brief UsernameIndex definition
+ */
+UsernameIndex::UsernameIndex()
+    : mGeneration(0)
+{
+}
+
+/**
+ * /brief Add definition
+ */
+void UsernameIndex::Add(const QString& userName, bool pinned)
+{
+    QByteArray key = userName.toLower().toUtf8();
+    if ( key.isEmpty() || key.size() > 255 )
+    {
+        return;
+    }
+
+    mGeneration++;
+
+    /* Known name: only mark it as recently seen */
+    int index = lowerBound(key);
+    if ( index < mEntries.count() && mEntries.at(index).length == key.size() && 0 == compare(mEntries.at(index), key, key.size()) )
+    {
+        UsernameIndexEntry& entry = mEntries[index];
+        entry.lastSeen = mGeneration;
+        entry.pinned = ( entry.pinned || pinned );
+        return;
+    }
+
+    /* New name: collect it until the next merge */
+    QMap<QByteArray, UsernameIndexEntry>::iterator it = mPending.find(key);
+    if ( it == mPending.end() )
+    {
+        UsernameIndexEntry entry;
+        entry.offset = 0;
+        entry.length = (quint8)key.size();
+        entry.lastSeen = mGeneration;
+        entry.pinned = pinned;
+        mPending.insert(key, entry);
+    }
+    else
+    {
+        it.value().lastSeen = mGeneration;
+        it.value().pinned = ( it.value().pinned || pinned );
+    }
+
+    if ( mPending.count() >= qMax(USERNAME_INDEX_MERGE_SIZE, mEntries.count() / 16) )
+    {
+        merge();
+    }
+}
+
+/**
+ * /brief Complete definition
+ */
+QStringList UsernameIndex::Complete(const QString& prefix, int count) const
+{
+    QStringList names;
+    QByteArray key = prefix.toLower().toUtf8();
+
+    /* Both the arena and the new names are sorted, so merge the two ranges of matches */
+    int index = lowerBound(key);
+    QMap<QByteArray, UsernameIndexEntry>::const_iterator it = mPending.lowerBound(key);
+
+    while ( names.count() < count )
+    {
+        bool arenaMatch = ( index < mEntries.count() && 0 == compare(mEntries.at(index), key, key.size()) );
+        bool pendingMatch = ( it != mPending.constEnd() && it.key().startsWith(key) );
+
+        if ( !arenaMatch && !pendingMatch )
+        {
+            break;
+        }
+
+        /* Take the smaller name of both ranges */
+        if ( arenaMatch && ( !pendingMatch || compare(mEntries.at(index), it.key(), it.key().size()) < 0 ) )
+        {
+            const UsernameIndexEntry& entry = mEntries.at(index);
+            names << QString::fromUtf8(mArena.constData() + entry.offset, entry.length);
+            index++;
+        }
+        else
+        {
+            names << QString::fromUtf8(it.key());
+            ++it;
+        }
+    }
+
+    return names;
+}
+
+/**
+ * /brief Count definition
+ */
+int UsernameIndex::Count() const
+{
+    return mEntries.count() + mPending.count();
+}
+
+/**
+ * /brief compare definition
+ */
+int UsernameIndex::compare(const UsernameIndexEntry& entry, const QByteArray& key, int size) const
+{
+    /* Compare the common characters in place, a name shorter than the compared size is less */
+    int common = qMin((int)entry.length, size);
+    int result = memcmp(mArena.constData() + entry.offset, key.constData(), common);
+    if ( result != 0 )
+    {
+        return result;
+    }
+
+    return common - size;
+}
+
+/**
+ * /brief lowerBound definition
+ */
+int UsernameIndex::lowerBound(const QByteArray& key) const
+{
+    int first = 0;
+    int last = mEntries.count();
+
+    while (first < last)
+    {
+        int middle = first + (last - first) / 2;
+        if ( compare(mEntries.at(middle), key, key.size()) < 0 )
+        {
+            first = middle + 1;
+        }
+        else
+        {
+            last = middle;
+        }
+    }
+
+    return first;
+}
+
+/**
+ * /brief merge definition
+ */
+void UsernameIndex::merge()
+{
+    /* Find the oldest generation which is kept if there are too many names */
+    quint32 oldest = 0;
+    int excess = mEntries.count() + mPending.count() - USERNAME_INDEX_MAX_NAMES;
+    if (excess > 0)
+    {
+        QVector<quint32> generations;
+        generations.reserve( mEntries.count() + mPending.count() );
+        foreach (const UsernameIndexEntry& entry, mEntries)
+        {
+            if ( !entry.pinned )
+            {
+                generations.append(entry.lastSeen);
+            }
+        }
+        foreach (const UsernameIndexEntry& entry, mPending)
+        {
+            if ( !entry.pinned )
+            {
+                generations.append(entry.lastSeen);
+            }
+        }
+
+        excess = qMin(excess, generations.count());
+        if (excess > 0)
+        {
+            std::nth_element(generations.begin(), generations.begin() + excess - 1, generations.end());
+            oldest = generations.at(excess - 1) + 1;
+        }
+    }
+
+    /* Merge both sorted ranges into a new arena and drop the least recently seen names */
+    QByteArray arena;
+    QVector<UsernameIndexEntry> entries;
+    arena.reserve( mArena.size() + mPending.count() * 16 );
+    entries.reserve( mEntries.count() + mPending.count() );
+
+    int index = 0;
+    QMap<QByteArray, UsernameIndexEntry>::const_iterator it = mPending.constBegin();
+    while ( index < mEntries.count() || it != mPending.constEnd() )
+    {
+        /* Take the smaller name of both ranges */
+        if ( it == mPending.constEnd() ||
+             ( index < mEntries.count() && compare(mEntries.at(index), it.key(), it.key().size()) < 0 ) )
+        {
+            UsernameIndexEntry entry = mEntries.at(index++);
+            if ( entry.pinned || entry.lastSeen >= oldest )
+            {
+                const char* name = mArena.constData() + entry.offset;
+                entry.offset = (quint32)arena.size();
+                arena.append(name, entry.length);
+                entries.append(entry);
+            }
+        }
+        else
+        {
+            UsernameIndexEntry entry = it.value();
+            if ( entry.pinned || entry.lastSeen >= oldest )
+            {
+                entry.offset = (quint32)arena.size();
+                arena.append(it.key());
+                entries.append(entry);
+            }
+            ++it;
+        }
+    }
+
+    mArena = arena;
+    mEntries = entries;
+    mPending.clear();
+}
@@ -0,0 +1,122 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    usernameindex.h
+ * /author  Hackspider
+ * /brief   Header file of the prefix index of recently seen usernames
+ */
+
+/* Include Guard */
+#ifndef USERNAMEINDEX_H
+#define USERNAMEINDEX_H
+
+/* Necessary dependencies to Qt framework */
+#include <QByteArray>
+#include <QMap>
+#include <QStringList>
+#include <QVector>
+
+/* Maximum number of indexed names, the least recently seen names are dropped beyond it */
+#define USERNAME_INDEX_MAX_NAMES 2000000
+
+/* Minimum number of new names collected before they are merged into the sorted index */
+#define USERNAME_INDEX_MERGE_SIZE 4096
+
+/* Type of an indexed name */
+typedef struct
+{
+    quint32 offset;
+    quint32 lastSeen;
+    quint8 length;
+    bool pinned;
+} UsernameIndexEntry;
+
+/**
+ * /brief  The UsernameIndex class declaration.
+ *
+ * Keeps the names in one sorted arena (all characters back to back plus a
+ * sorted array of offsets), so a prefix is found by a binary search and the
+ * matches are the following entries. New names are collected in a small
+ * sorted map first and merged into the arena once the map has grown to a
+ * sixteenth of the arena, which keeps the cost per name constant on average.
+ * Beyond USERNAME_INDEX_MAX_NAMES the least recently seen names are dropped on
+ * the next merge, pinned names (e.g. banned users) are always kept.
+ */
+class UsernameIndex
+{
+public:
+    /**
+     * /brief  Constructor of the UsernameIndex class
+     */
+    UsernameIndex(void);
+
+    /**
+     * /brief  Method to add a name or to mark it as recently seen
+     * /param  userName  Name of the user (case insensitive)
+     * /param  pinned    True if the name shall never be dropped
+     */
+    void Add(const QString& userName, bool pinned);
+
+    /**
+     * /brief   Method to search the names starting with a prefix
+     * /param   prefix  Prefix of the names (case insensitive)
+     * /param   count   Maximum number of names
+     * /return  Returns the matching names in alphabetical order
+     */
+    QStringList Complete(const QString& prefix, int count) const;
+
+    /**
+     * /brief   Method to get the number of indexed names
+     * /return  Returns the number of names
+     */
+    int Count(void) const;
+
+private:
+    /**
+     * /brief   Internally used method to compare a name of the arena with a key
+     * /param   entry  Entry of the name
+     * /param   key    Compared key
+     * /param   size   Number of characters to compare (the key is a prefix of the name if the result is 0)
+     * /return  Returns a value less than, equal to or greater than 0 like memcmp
+     */
+    int compare(const UsernameIndexEntry& entry, const QByteArray& key, int size) const;
+
+    /**
+     * /brief   Internally used method to search the first entry not less than a key
+     * /param   key  Searched key
+     * /return  Returns the index of the entry
+     */
+    int lowerBound(const QByteArray& key) const;
+
+    /**
+     * /brief  Internally used method to merge the new names into the arena
+     */
+    void merge(void);
+
+    /**
+     * /brief Internal used variables
+     */
+    QByteArray mArena;
+    QVector<UsernameIndexEntry> mEntries;
+    QMap<QByteArray, UsernameIndexEntry> mPending;
+    quint32 mGeneration;
+};
+
+#endif /* USERNAMEINDEX_H */
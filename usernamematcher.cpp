@@ -0,0 +1,396 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    usernamematcher.cpp
+ * /author  Hackspider
+ * /brief   Source file of the username pattern matcher
+ */
+
+/* Necessary dependencies to the standard library */
+#include <string.h>
+#include <algorithm>
+
+/* Necessary dependencies to Qt framework */
+#include <QHash>
+#include <QQueue>
+
+/* Necessary internal dependencies */
+#include "usernamematcher.h"
+
+/**
+ * /brief  Helper to add a position of a pattern and all positions reachable without input to a state set
+ * /param  items     Items of all patterns
+ * /param  offsets   Index of the first position of every pattern
+ * /param  pattern   Index of the pattern
+ * /param  position  Position within the pattern
+ * /param  marks     Marks of the positions already in the set
+ * /param  mark      Mark of the current set
+ * /param  set       Set of positions
+ */
+static void addPosition(const QList< QVector<UsernamePatternItem> >& items, const QVector<int>& offsets,
+                        int pattern, int position, QVector<int>& marks, int mark, QVector<int>* set)
+{
+    const QVector<UsernamePatternItem>& patternItems = items.at(pattern);
+
+    while (true)
+    {
+        int id = offsets.at(pattern) + position;
+        if (marks.at(id) == mark)
+        {
+            return;
+        }
+        marks[id] = mark;
+        set->append(id);
+
+        /* A repeated item may also match nothing, so the next position is reached as well */
+        if ( position < patternItems.count() && patternItems.at(position).repeat )
+        {
+            position++;
+        }
+        else
+        {
+            return;
+        }
+    }
+}
+
+/**
+ * /brief UsernameMatcher definition
+ */
+UsernameMatcher::UsernameMatcher()
+    : mClassCount(1),
+    mDeadState(0)
+{
+    /* Without patterns every byte belongs to class 0 */
+    memset(mClasses, 0, sizeof(mClasses));
+}
+
+/**
+ * /brief parse definition
+ */
+bool UsernameMatcher::parse(const QByteArray& pattern, QVector<UsernamePatternItem>* items)
+{
+    items->clear();
+
+    for (int i=0; i<pattern.size(); i++)
+    {
+        char c = pattern.at(i);
+        UsernamePatternItem item;
+        item.set = QByteArray(256, '\0');
+        item.repeat = false;
+
+        if (c == '*')
+        {
+            /* Any number of any characters */
+            item.set.fill('\1');
+            item.repeat = true;
+        }
+        else if (c == '?')
+        {
+            /* Any single character */
+            item.set.fill('\1');
+        }
+        else if (c == '+')
+        {
+            /* One or more of the preceding item: the item followed by its repetition */
+            if ( items->isEmpty() || items->last().repeat )
+            {
+                return false;
+            }
+            item.set = items->last().set;
+            item.repeat = true;
+        }
+        else if (c == '[')
+        {
+            /* Set of characters with ranges, optionally negated */
+            int end = pattern.indexOf(']', i + 2);
+            if (end < 0)
+            {
+                return false;
+            }
+
+            int start = i + 1;
+            bool negate = ( pattern.at(start) == '^' );
+            if (negate)
+            {
+                start++;
+            }
+
+            for (int j=start; j<end; j++)
+            {
+                unsigned char first = (unsigned char)pattern.at(j);
+                unsigned char last = first;
+                if ( j + 2 < end && pattern.at(j + 1) == '-' )
+                {
+                    last = (unsigned char)pattern.at(j + 2);
+                    j += 2;
+                }
+                for (int b=first; b<=last; b++)
+                {
+                    item.set[b] = '\1';
+                }
+            }
+
+            if (negate)
+            {
+                for (int b=0; b<256; b++)
+                {
+                    item.set[b] = item.set.at(b) ? '\0' : '\1';
+                }
+            }
+
+            i = end;
+        }
+        else
+        {
+            /* The character itself */
+            item.set[(unsigned char)c] = '\1';
+        }
+
+        items->append(item);
+    }
+
+    return !items->isEmpty();
+}
+
+/**
+ * /brief Compile definition
+ */
+bool UsernameMatcher::Compile(const QStringList& patterns, QString* errorString)
+{
+    /* Parse all patterns, every position of every pattern becomes a state of the nondeterministic automaton */
+    QStringList compiledPatterns;
+    QList< QVector<UsernamePatternItem> > items;
+    QVector<int> offsets;
+    QVector<int> patternOf;
+    QVector<int> positionOf;
+
+    foreach (const QString& pattern, patterns)
+    {
+        QString normalized = pattern.trimmed().toLower();
+        if ( normalized.isEmpty() || compiledPatterns.contains(normalized) )
+        {
+            continue;
+        }
+
+        QVector<UsernamePatternItem> patternItems;
+        if ( !parse(normalized.toUtf8(), &patternItems) )
+        {
+            if (errorString != nullptr)
+            {
+                *errorString = "Malformed pattern: " + pattern;
+            }
+            return false;
+        }
+
+        offsets.append(patternOf.count());
+        for (int position=0; position<=patternItems.count(); position++)
+        {
+            patternOf.append(items.count());
+            positionOf.append(position);
+        }
+
+        compiledPatterns << normalized;
+        items.append(patternItems);
+    }
+
+    /* Bytes which are in the same sets of all items share one input class */
+    QHash<QByteArray, int> signatures;
+    unsigned char classes[256];
+    unsigned char representatives[256];
+    int classCount = 0;
+
+    for (int b=0; b<256; b++)
+    {
+        QByteArray signature;
+        for (int p=0; p<items.count(); p++)
+        {
+            for (int i=0; i<items.at(p).count(); i++)
+            {
+                signature.append(items.at(p).at(i).set.at(b));
+            }
+        }
+
+        QHash<QByteArray, int>::const_iterator known = signatures.constFind(signature);
+        if ( known != signatures.constEnd() )
+        {
+            classes[b] = (unsigned char)known.value();
+        }
+        else
+        {
+            signatures.insert(signature, classCount);
+            representatives[classCount] = (unsigned char)b;
+            classes[b] = (unsigned char)classCount++;
+        }
+    }
+
+    /* Upper case ASCII letters share the class of the lower case letter */
+    for (int c='A'; c<='Z'; c++)
+    {
+        classes[c] = classes[c + ('a' - 'A')];
+    }
+
+    /* Subset construction, every deterministic state is a set of positions */
+    QVector<int> marks(patternOf.count(), 0);
+    int mark = 0;
+    QHash<QByteArray, int> stateIds;
+    QList< QVector<int> > stateSets;
+    QQueue<int> queue;
+    QVector<int> transitions;
+    QVector<int> output;
+    int deadState = -1;
+
+    QVector<int> start;
+    mark++;
+    for (int p=0; p<items.count(); p++)
+    {
+        addPosition(items, offsets, p, 0, marks, mark, &start);
+    }
+    std::sort(start.begin(), start.end());
+
+    stateIds.insert(QByteArray((const char*)start.constData(), start.count() * (int)sizeof(int)), 0);
+    stateSets.append(start);
+    queue.enqueue(0);
+
+    while ( !queue.isEmpty() )
+    {
+        int state = queue.dequeue();
+        const QVector<int> set = stateSets.at(state);
+
+        /* The first pattern which is complete in this state is the output */
+        int accepted = -1;
+        foreach (int id, set)
+        {
+            if ( positionOf.at(id) == items.at(patternOf.at(id)).count() &&
+                 ( accepted < 0 || patternOf.at(id) < accepted ) )
+            {
+                accepted = patternOf.at(id);
+            }
+        }
+        output.append(accepted);
+        if ( set.isEmpty() )
+        {
+            deadState = state;
+        }
+        transitions.insert(transitions.count(), classCount, -1);
+
+        for (int c=0; c<classCount; c++)
+        {
+            unsigned char byte = representatives[c];
+            QVector<int> next;
+            mark++;
+
+            foreach (int id, set)
+            {
+                int pattern = patternOf.at(id);
+                int position = positionOf.at(id);
+                const QVector<UsernamePatternItem>& patternItems = items.at(pattern);
+
+                if ( position < patternItems.count() && patternItems.at(position).set.at(byte) )
+                {
+                    /* A repeated item stays, a single item advances */
+                    addPosition(items, offsets, pattern, patternItems.at(position).repeat ? position : position + 1, marks, mark, &next);
+                }
+            }
+            std::sort(next.begin(), next.end());
+
+            QByteArray key((const char*)next.constData(), next.count() * (int)sizeof(int));
+            QHash<QByteArray, int>::const_iterator known = stateIds.constFind(key);
+            int nextState;
+            if ( known != stateIds.constEnd() )
+            {
+                nextState = known.value();
+            }
+            else
+            {
+                nextState = stateSets.count();
+                if (nextState >= USERNAME_PATTERN_MAX_STATES)
+                {
+                    if (errorString != nullptr)
+                    {
+                        *errorString = "Too many states, simplify the patterns";
+                    }
+                    return false;
+                }
+                stateIds.insert(key, nextState);
+                stateSets.append(next);
+                queue.enqueue(nextState);
+            }
+
+            transitions[state * classCount + c] = nextState;
+        }
+    }
+
+    /* Take over the compiled automaton */
+    mPatterns = compiledPatterns;
+    mTransitions = transitions;
+    mOutput = output;
+    memcpy(mClasses, classes, sizeof(mClasses));
+    mClassCount = classCount;
+    mDeadState = deadState;
+
+    return true;
+}
+
+/**
+ * /brief IsEmpty definition
+ */
+bool UsernameMatcher::IsEmpty() const
+{
+    return mPatterns.isEmpty();
+}
+
+/**
+ * /brief Match definition
+ */
+int UsernameMatcher::Match(const char* data, int length) const
+{
+    if ( mPatterns.isEmpty() )
+    {
+        return -1;
+    }
+
+    const int* transitions = mTransitions.constData();
+    int state = 0;
+
+    /* One table lookup per byte, stop as soon as no pattern can match anymore */
+    for (int i=0; i<length && state!=mDeadState; i++)
+    {
+        state = transitions[state * mClassCount + mClasses[(unsigned char)data[i]]];
+    }
+
+    return mOutput.at(state);
+}
+
+/**
+ * /brief Pattern definition
+ */
+QString UsernameMatcher::Pattern(int index) const
+{
+    return mPatterns.value(index);
+}
+
+/**
+ * /brief StateCount definition
+ */
+int UsernameMatcher::StateCount() const
+{
+    return mOutput.count();
+}
@@ -0,0 +1,122 @@
+/****************************************************************************
+ * Copyright (C) 2018 by Sebastian Ziganki                                  *
+ *                                                                          *
+ * This file is part of Lpz3ncLittleHelper.                                 *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is free software: you can redistribute it and/or    *
+ *   modify it under the terms of the GNU Lesser General Public License as  *
+ *   published by the Free Software Foundation, either version 3 of the     *
+ *   License.                                                               *
+ *                                                                          *
+ *   Lpz3ncLittleHelper is distributed in the hope that it will be useful,  *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the           *
+ *   GNU Lesser General Public License for more details.                    *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with Box. If not, see  http://www.gnu.org/licenses .     *
+ ****************************************************************************/
+
+/**
+ * /file    usernamematcher.h
+ * /author  Hackspider
+ * /brief   Header file of the username pattern matcher
+ */
+
+/* Include Guard */
+#ifndef USERNAMEMATCHER_H
+#define USERNAMEMATCHER_H
+
+/* Necessary dependencies to Qt framework */
+#include <QStringList>
+#include <QVector>
+
+/* Maximum number of states of the compiled automaton */
+#define USERNAME_PATTERN_MAX_STATES 20000
+
+/* Type of a single item of a parsed pattern */
+typedef struct
+{
+    QByteArray set;
+    bool repeat;
+} UsernamePatternItem;
+
+/**
+ * /brief  The UsernameMatcher class declaration.
+ *
+ * Compiles a set of username patterns into a single deterministic automaton
+ * which checks a name against all patterns with one table lookup per byte.
+ * A pattern has to match the whole name (case insensitive for ASCII):
+ *
+ *     abc      the characters themselves
+ *     ?        any single character
+ *     *        any number of any characters
+ *     [a-z_]   one character of the set, [^...] one character not in the set
+ *     x+       one or more of the preceding character, ? or set
+ *
+ * e.g. "hoss00312_*" or "coolbot[0-9]+".
+ */
+class UsernameMatcher
+{
+public:
+    /**
+     * /brief  Constructor of the UsernameMatcher class
+     */
+    UsernameMatcher(void);
+
+    /**
+     * /brief   Method to compile a list of patterns, replaces the previously compiled patterns
+     * /param   patterns      List of patterns (empty patterns are ignored)
+     * /param   errorString   Returns the reason if the patterns couldn't be compiled (may be nullptr)
+     * /return  Returns false if a pattern is malformed or the automaton gets too large, the previous patterns are kept
+     */
+    bool Compile(const QStringList& patterns, QString* errorString);
+
+    /**
+     * /brief   Method to check if there is any pattern compiled
+     * /return  Returns true if there is no pattern
+     */
+    bool IsEmpty(void) const;
+
+    /**
+     * /brief   Method to check a name against all patterns
+     * /param   data    Pointer to the name
+     * /param   length  Length of the name
+     * /return  Returns the index of the first matching pattern or -1 if no pattern matches
+     */
+    int Match(const char* data, int length) const;
+
+    /**
+     * /brief   Method to get a compiled pattern
+     * /param   index  Index of the pattern as returned by Match
+     * /return  Returns the pattern
+     */
+    QString Pattern(int index) const;
+
+    /**
+     * /brief   Method to get the number of states of the compiled automaton
+     * /return  Returns the number of states
+     */
+    int StateCount(void) const;
+
+private:
+    /**
+     * /brief   Internally used method to parse a pattern into items
+     * /param   pattern  Lower case pattern
+     * /param   items    Returns the items of the pattern
+     * /return  Returns false if the pattern is malformed
+     */
+    static bool parse(const QByteArray& pattern, QVector<UsernamePatternItem>* items);
+
+    /**
+     * /brief Internal used variables
+     */
+    QStringList mPatterns;
+    QVector<int> mTransitions;
+    QVector<int> mOutput;
+    unsigned char mClasses[256];
+    int mClassCount;
+    int mDeadState;
+};
+
+#endif /* USERNAMEMATCHER_H */